@@ -5,6 +5,8 @@
 #include "AccelByteUe4SdkModule.h"
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteTimerService.h"
+#include "Core/AccelByteMultiRegistry.h"
 #include "CoreUObject.h"
 #include "Api/AccelByteGameTelemetryApi.h"
 #include "Core/AccelByteReport.h"
@@ -65,16 +67,28 @@ void FAccelByteUe4SdkModule::StartupModule()
 
 	FRegistry::HttpRetryScheduler.Startup();
 	FRegistry::Credentials.Startup();
-	FRegistry::GameTelemetry.Startup();
 	FRegistry::ServerCredentials.Startup();
+	FRegistry::HttpRetryScheduler.AddAuthorization(FRegistry::Credentials.GetAuthorization());
+	FRegistry::HttpRetryScheduler.AddAuthorization(FRegistry::ServerCredentials.GetClientAuthorization());
+
+	// API services are constructed on first use, only the listed ones are built now
+	FRegistry::WarmUp(GetDefault<UAccelByteSettings>()->WarmUpServices);
+#if WITH_EDITOR || UE_SERVER
+	FRegistry::WarmUp(GetDefault<UAccelByteServerSettings>()->WarmUpServices);
+#endif
 }
 
 void FAccelByteUe4SdkModule::ShutdownModule()
 {
-	FRegistry::GameTelemetry.Shutdown();
+	FMultiRegistry::Shutdown();
+	if (FRegistry::GameTelemetry.IsConstructed())
+	{
+		FRegistry::GameTelemetry->Shutdown();
+	}
 	FRegistry::Credentials.Shutdown();
 	FRegistry::HttpRetryScheduler.Shutdown();
 	FRegistry::ServerCredentials.Shutdown();
+	FRegistry::TimerService.Shutdown();
 
 	UnregisterSettings();
 }
@@ -153,6 +167,24 @@ bool FAccelByteUe4SdkModule::LoadSettingsFromConfigUobject()
 	FRegistry::Settings.UGCServerUrl = GetDefaultAPIUrl(GetDefault<UAccelByteSettings>()->UGCServerUrl, TEXT("ugc"));
 	FRegistry::Settings.AppId = GetDefault<UAccelByteSettings>()->AppId;
 	FRegistry::Credentials.SetClientCredentials(FRegistry::Settings.ClientId, FRegistry::Settings.ClientSecret);
+	FRegistry::HttpRetryScheduler.SetDefaultMaxInFlightRequests(GetDefault<UAccelByteSettings>()->HttpMaxInFlightRequests);
+	FRegistry::HttpRetryScheduler.SetCoalescingEnabled(GetDefault<UAccelByteSettings>()->bHttpCoalesceGetRequests);
+	FAsyncJsonDecoding::SetEnabled(GetDefault<UAccelByteSettings>()->bHttpAsyncJsonDecoding);
+	FAsyncJsonDecoding::SetSizeThreshold(GetDefault<UAccelByteSettings>()->HttpAsyncJsonDecodingThreshold);
+	FAsyncJsonDecoding::SetParseStatsEnabled(GetDefault<UAccelByteSettings>()->bHttpJsonParseStats);
+
+	// mostly static data, served locally or revalidated with a 304 instead of downloaded again
+	const float CatalogCacheTtl = GetDefault<UAccelByteSettings>()->HttpCatalogCacheTtl;
+	FHttpResponseCache& ResponseCache = FRegistry::HttpRetryScheduler.GetResponseCache();
+	ResponseCache.SetMemoryBudget(static_cast<int64>(GetDefault<UAccelByteSettings>()->HttpCacheMemoryBudgetKB) * 1024);
+	ResponseCache.SetDiskCacheDirectory(GetDefault<UAccelByteSettings>()->bHttpDiskCacheEnabled ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AccelByte"), TEXT("HttpCache")) : FString());
+	ResponseCache.SetTtl(FString::Printf(TEXT("%s/public/namespaces/%s/categories"), *FRegistry::Settings.PlatformServerUrl, *FRegistry::Settings.Namespace), CatalogCacheTtl);
+	ResponseCache.SetTtl(FString::Printf(TEXT("%s/public/namespaces/%s/items/byCriteria"), *FRegistry::Settings.PlatformServerUrl, *FRegistry::Settings.Namespace), CatalogCacheTtl);
+	ResponseCache.SetTtl(FString::Printf(TEXT("%s/public/namespaces/%s/items/search"), *FRegistry::Settings.PlatformServerUrl, *FRegistry::Settings.Namespace), CatalogCacheTtl);
+	ResponseCache.SetTtl(FString::Printf(TEXT("%s/v1/public/namespaces/%s/tags"), *FRegistry::Settings.UGCServerUrl, *FRegistry::Settings.Namespace), CatalogCacheTtl);
+	ResponseCache.SetTtl(FString::Printf(TEXT("%s/v1/public/namespaces/%s/types"), *FRegistry::Settings.UGCServerUrl, *FRegistry::Settings.Namespace), CatalogCacheTtl);
+	ResponseCache.SetTtl(FString::Printf(TEXT("%s/public/policies/"), *FRegistry::Settings.AgreementServerUrl), 3600.0);
+	ResponseCache.SetTtl(FString::Printf(TEXT("%s/public/qos"), *FRegistry::Settings.QosManagerServerUrl), 60.0);
 	
 	return true;
 }
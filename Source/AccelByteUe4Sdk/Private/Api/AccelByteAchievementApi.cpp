@@ -7,6 +7,7 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "JsonUtilities.h"
 #include "Core/AccelByteSettings.h"
 
@@ -14,7 +15,15 @@ namespace AccelByte
 {
 namespace Api
 {
-Achievement::Achievement(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting) : Credentials(Credentials), Settings(Setting){}
+namespace
+{
+	constexpr FHttpEndpoint QueryAchievementsEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/achievements"));
+	constexpr FHttpEndpoint GetAchievementEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/achievements/{achievementCode}"));
+	constexpr FHttpEndpoint QueryUserAchievementsEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/users/{userId}/achievements"));
+	constexpr FHttpEndpoint UnlockAchievementEndpoint(EHttpVerb::Put, TEXT("/v1/public/namespaces/{namespace}/users/{userId}/achievements/{achievementCode}/unlock"));
+}
+
+Achievement::Achievement(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting, FHttpRetryScheduler& HttpRef) : Credentials(Credentials), Settings(Setting), HttpRef(HttpRef){}
 
 Achievement::~Achievement(){}
 
@@ -47,50 +56,31 @@ FString Achievement::ConvertAchievementSortByToString(const EAccelByteAchievemen
 void Achievement::QueryAchievements(const FString& Language, const EAccelByteAchievementListSortBy& SortBy, const THandler<FAccelByteModelsPaginatedPublicAchievement>& OnSuccess, const FErrorHandler& OnError,
 	const int32& Offset, const int32& Limit)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/v1/public/namespaces/%s/achievements"), *Settings.AchievementServerUrl, *Credentials.GetNamespace());
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Query			= TEXT("");
-
-	if (!Language.IsEmpty())
-	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("language=%s"), *Language));
-	}
+	FHttpRequestBuilder Request(QueryAchievementsEndpoint, Settings.AchievementServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Query(TEXT("language"), Language)
+		.Authorization(Credentials.GetAuthorization());
 	if (SortBy != EAccelByteAchievementListSortBy::NONE)
 	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("sortBy=%s"), *ConvertAchievementSortByToString(SortBy)));
+		Request.Query(TEXT("sortBy"), ConvertAchievementSortByToString(SortBy));
 	}
 	if (Offset >= 0)
 	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("offset=%d"), Offset));
+		Request.Query(TEXT("offset"), Offset);
 	}
 	if (Limit >= 0)
 	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("limit=%d"), Limit));
+		Request.Query(TEXT("limit"), Limit);
 	}
-	Url.Append(Query.IsEmpty() ? TEXT("") : FString::Printf(TEXT("?%s"), *Query));
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request,  CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Achievement::GetAchievement(const FString& AchievementCode, const THandler<FAccelByteModelsMultiLanguageAchievement>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (AchievementCode.IsEmpty())
 	{
@@ -98,68 +88,43 @@ void Achievement::GetAchievement(const FString& AchievementCode, const THandler<
 		return;
 	}
 
-	FString Authorization	= FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url				= FString::Printf(TEXT("%s/v1/public/namespaces/%s/achievements/%s"), *Settings.AchievementServerUrl, *Credentials.GetNamespace(), *AchievementCode);
-	FString Verb			= TEXT("GET");
-	FString ContentType		= TEXT("application/json");
-	FString Accept			= TEXT("application/json");
+	FHttpRequestBuilder Request(GetAchievementEndpoint, Settings.AchievementServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("achievementCode"), AchievementCode)
+		.Authorization(Credentials.GetAuthorization());
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Achievement::QueryUserAchievements(const EAccelByteAchievementListSortBy& SortBy, const THandler<FAccelByteModelsPaginatedUserAchievement>& OnSuccess, const FErrorHandler& OnError,
 	const int32& Offset, const int32& Limit, bool PreferUnlocked)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/achievements"), *Settings.AchievementServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId());
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Query = TEXT("");
+	ACCELBYTE_LOG_FUNCTION();
 
+	FHttpRequestBuilder Request(QueryUserAchievementsEndpoint, Settings.AchievementServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Authorization(Credentials.GetAuthorization());
 	if (SortBy != EAccelByteAchievementListSortBy::NONE)
 	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("sortBy=%s"), *ConvertAchievementSortByToString(SortBy)));
+		Request.Query(TEXT("sortBy"), ConvertAchievementSortByToString(SortBy));
 	}
 	if (Offset >= 0)
 	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("offset=%d"), Offset));
+		Request.Query(TEXT("offset"), Offset);
 	}
 	if (Limit >= 0)
 	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("limit=%d"), Limit));
-	}
-	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("preferUnlocked=%s"), PreferUnlocked ? TEXT("true"):TEXT("false")));
+		Request.Query(TEXT("limit"), Limit);
 	}
-	Url.Append(Query.IsEmpty() ? TEXT("") : FString::Printf(TEXT("?%s"), *Query));
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	Request.Query(TEXT("preferUnlocked"), PreferUnlocked);
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Achievement::UnlockAchievement(const FString& AchievementCode, const FVoidHandler OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (AchievementCode.IsEmpty())
 	{
@@ -167,20 +132,13 @@ void Achievement::UnlockAchievement(const FString& AchievementCode, const FVoidH
 		return;
 	}
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/achievements/%s/unlock"), *Settings.AchievementServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *AchievementCode);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FHttpRequestBuilder Request(UnlockAchievementEndpoint, Settings.AchievementServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("achievementCode"), AchievementCode)
+		.Authorization(Credentials.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 } // Namespace Api
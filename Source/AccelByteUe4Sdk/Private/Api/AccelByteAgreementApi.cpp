@@ -7,6 +7,7 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteSettings.h"
 #include "Core/AccelByteUtilities.h"
 
@@ -14,8 +15,18 @@ namespace AccelByte
 {
 namespace Api
 {
+namespace
+{
+	constexpr FHttpEndpoint GetLegalPoliciesEndpoint(EHttpVerb::Get, TEXT("/public/policies/namespaces/{namespace}"));
+	constexpr FHttpEndpoint GetLegalPoliciesByCountryEndpoint(EHttpVerb::Get, TEXT("/public/policies/countries/{countryCode}"));
+	constexpr FHttpEndpoint BulkAcceptPolicyVersionsEndpoint(EHttpVerb::Post, TEXT("/public/agreements/policies"));
+	constexpr FHttpEndpoint AcceptPolicyVersionEndpoint(EHttpVerb::Post, TEXT("/public/agreements/localized-policy-versions/{localizedPolicyVersionId}"));
+	constexpr FHttpEndpoint QueryLegalEligibilitiesEndpoint(EHttpVerb::Get, TEXT("/public/eligibilities/namespaces/{namespace}"));
+	// legal documents are served from the URL in the policy, not from the agreement service
+	constexpr FHttpEndpoint GetLegalDocumentEndpoint(EHttpVerb::Get, TEXT(""));
+}
 
-Agreement::Agreement(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting) : Credentials(Credentials), Settings(Setting)
+Agreement::Agreement(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting, FHttpRetryScheduler& HttpRef) : Credentials(Credentials), Settings(Setting), HttpRef(HttpRef)
 {}
 
 Agreement::~Agreement()
@@ -28,7 +39,7 @@ void Agreement::GetLegalPolicies(const EAccelByteAgreementPolicyType& AgreementP
 
 void Agreement::GetLegalPolicies(const FString& Namespace, const EAccelByteAgreementPolicyType& AgreementPolicyType, bool DefaultOnEmpty, const THandler<TArray<FAccelByteModelsPublicPolicy>>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FString AgreementPolicyTypeString = "";
 	switch (AgreementPolicyType)
@@ -46,29 +57,18 @@ void Agreement::GetLegalPolicies(const FString& Namespace, const EAccelByteAgree
 		break;
 	}
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/policies/namespaces/%s?policyType=%s&defaultOnEmpty=%s"),
-		*Settings.AgreementServerUrl,
-		*Namespace,
-		*AgreementPolicyTypeString,
-		DefaultOnEmpty ? TEXT("true") : TEXT("false"));
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(GetLegalPoliciesEndpoint, Settings.AgreementServerUrl);
+	Request.Path(TEXT("namespace"), Namespace)
+		.Query(TEXT("policyType"), AgreementPolicyTypeString)
+		.Query(TEXT("defaultOnEmpty"), DefaultOnEmpty)
+		.Authorization(Credentials.GetAuthorization());
+
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Agreement::GetLegalPolicies(const EAccelByteAgreementPolicyType& AgreementPolicyType, const TArray<FString>& Tags, bool DefaultOnEmpty, const THandler<TArray<FAccelByteModelsPublicPolicy>>& OnSuccess, const FErrorHandler& OnError) 
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FString AgreementPolicyTypeString = "";
 	switch (AgreementPolicyType)
@@ -86,36 +86,19 @@ void Agreement::GetLegalPolicies(const EAccelByteAgreementPolicyType& AgreementP
 		break;
 	}
 
-	FString TagsString = "";
-	for (int i = 0 ; i < Tags.Num() ; i++)
-	{
-		TagsString.Append((i == 0) ? TEXT(""): TEXT(",")).Append(Tags[i]);
-	}
+	FHttpRequestBuilder Request(GetLegalPoliciesEndpoint, Settings.AgreementServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Query(TEXT("policyType"), AgreementPolicyTypeString)
+		.Query(TEXT("tags"), Tags)
+		.Query(TEXT("defaultOnEmpty"), DefaultOnEmpty)
+		.Authorization(Credentials.GetAuthorization());
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/policies/namespaces/%s?policyType=%s&tags=%s&defaultOnEmpty=%s"), 
-		*Settings.AgreementServerUrl, 
-		*Settings.Namespace, 
-		*AgreementPolicyTypeString,
-		*TagsString,
-		DefaultOnEmpty ? TEXT("true") : TEXT("false"));
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Agreement::GetLegalPoliciesByCountry(const FString& CountryCode, const EAccelByteAgreementPolicyType& AgreementPolicyType,  bool DefaultOnEmpty, const THandler<TArray<FAccelByteModelsPublicPolicy>>& OnSuccess, const FErrorHandler& OnError) 
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FString AgreementPolicyTypeString = "";
 	switch (AgreementPolicyType)
@@ -133,29 +116,18 @@ void Agreement::GetLegalPoliciesByCountry(const FString& CountryCode, const EAcc
 		break;
 	}
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/policies/countries/%s?policyType=%s&defaultOnEmpty=%s"), 
-		*Settings.AgreementServerUrl, 
-		*CountryCode,
-		*AgreementPolicyTypeString,
-		DefaultOnEmpty ? TEXT("true") : TEXT("false"));
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(GetLegalPoliciesByCountryEndpoint, Settings.AgreementServerUrl);
+	Request.Path(TEXT("countryCode"), CountryCode)
+		.Query(TEXT("policyType"), AgreementPolicyTypeString)
+		.Query(TEXT("defaultOnEmpty"), DefaultOnEmpty)
+		.Authorization(Credentials.GetAuthorization());
+
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Agreement::GetLegalPoliciesByCountry(const FString& CountryCode, const EAccelByteAgreementPolicyType& AgreementPolicyType, const TArray<FString>& Tags,  bool DefaultOnEmpty, const THandler<TArray<FAccelByteModelsPublicPolicy>>& OnSuccess, const FErrorHandler& OnError) 
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FString AgreementPolicyTypeString = "";
 	switch (AgreementPolicyType)
@@ -173,106 +145,60 @@ void Agreement::GetLegalPoliciesByCountry(const FString& CountryCode, const EAcc
 		break;
 	}
 
-	FString TagsString = "";
-	for (int i = 0 ; i < Tags.Num() ; i++)
-	{
-		TagsString.Append((i == 0) ? TEXT(""): TEXT(",")).Append(Tags[i]);
-	}
+	FHttpRequestBuilder Request(GetLegalPoliciesByCountryEndpoint, Settings.AgreementServerUrl);
+	Request.Path(TEXT("countryCode"), CountryCode)
+		.Query(TEXT("policyType"), AgreementPolicyTypeString)
+		.Query(TEXT("tags"), Tags)
+		.Query(TEXT("defaultOnEmpty"), DefaultOnEmpty)
+		.Authorization(Credentials.GetAuthorization());
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/policies/countries/%s?policyType=%s&tags=%s&defaultOnEmpty=%s"), 
-		*Settings.AgreementServerUrl, 
-		*CountryCode,
-		*AgreementPolicyTypeString,
-		*TagsString,
-		DefaultOnEmpty ? TEXT("true") : TEXT("false"));
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Agreement::BulkAcceptPolicyVersions(const TArray<FAccelByteModelsAcceptAgreementRequest>& AgreementRequests, const THandler<FAccelByteModelsAcceptAgreementResponse>& OnSuccess, const FErrorHandler& OnError) 
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/agreements/policies"), *Settings.AgreementServerUrl);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
-
 	FAccelByteUtilities::TArrayUStructToJsonString(AgreementRequests, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(BulkAcceptPolicyVersionsEndpoint, Settings.AgreementServerUrl);
+	Request.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Agreement::AcceptPolicyVersion(const FString& LocalizedPolicyVersionId, const FVoidHandler& OnSuccess, const FErrorHandler& OnError) 
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/agreements/localized-policy-versions/%s"), *Settings.AgreementServerUrl, *LocalizedPolicyVersionId);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(AcceptPolicyVersionEndpoint, Settings.AgreementServerUrl);
+	Request.Path(TEXT("localizedPolicyVersionId"), LocalizedPolicyVersionId)
+		.Authorization(Credentials.GetAuthorization());
+
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Agreement::QueryLegalEligibilities(const FString& Namespace, const THandler<TArray<FAccelByteModelsRetrieveUserEligibilitiesResponse>>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/eligibilities/namespaces/%s"), *Settings.AgreementServerUrl, *Namespace);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(QueryLegalEligibilitiesEndpoint, Settings.AgreementServerUrl);
+	Request.Path(TEXT("namespace"), Namespace)
+		.Authorization(Credentials.GetAuthorization());
+
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Agreement::GetLegalDocument(const FString & Url, const THandler<FString>& OnSuccess, const FErrorHandler & OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(GetLegalDocumentEndpoint, Url);
+	Request.Accept(TEXT("*/*"));
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetVerb("GET");
-	Request->SetHeader(TEXT("Accept"), "*/*");
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 } // Namespace Api
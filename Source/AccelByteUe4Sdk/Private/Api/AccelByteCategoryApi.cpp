@@ -7,6 +7,7 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "JsonUtilities.h"
 #include "Core/AccelByteSettings.h"
 
@@ -14,96 +15,67 @@ namespace AccelByte
 {
 namespace Api
 {
-Category::Category(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting) : Credentials(Credentials), Settings(Setting){}
+namespace
+{
+	constexpr FHttpEndpoint GetRootCategoriesEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/categories"));
+	constexpr FHttpEndpoint GetCategoryEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/categories/{categoryPath}"));
+	constexpr FHttpEndpoint GetChildCategoriesEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/categories/{categoryPath}/children"));
+	constexpr FHttpEndpoint GetDescendantCategoriesEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/categories/{categoryPath}/descendants"));
+}
+
+Category::Category(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting, FHttpRetryScheduler& HttpRef) : Credentials(Credentials), Settings(Setting), HttpRef(HttpRef){}
 
 Category::~Category(){}
 
 void Category::GetRootCategories(const FString& Language, const THandler<TArray<FAccelByteModelsCategoryInfo>>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/categories?language=%s"), *Settings.PlatformServerUrl, *Credentials.GetNamespace(), *Language);
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content         = TEXT("");
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(GetRootCategoriesEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Query(TEXT("language"), Language)
+		.Authorization(Credentials.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request,  CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Category::GetCategory(const FString& CategoryPath, const FString& Language, const THandler<FAccelByteModelsCategoryInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/categories/%s?language=%s"), *Settings.PlatformServerUrl, *Credentials.GetNamespace(), *FGenericPlatformHttp::UrlEncode(CategoryPath), *Language);
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content         = TEXT("");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(GetCategoryEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("categoryPath"), FGenericPlatformHttp::UrlEncode(CategoryPath))
+		.Query(TEXT("language"), Language)
+		.Authorization(Credentials.GetAuthorization());
 	
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Category::GetChildCategories(const FString& Language, const FString& CategoryPath, const THandler<TArray<FAccelByteModelsCategoryInfo>>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/categories/%s/children?language=%s"), *Settings.PlatformServerUrl, *Credentials.GetNamespace(), *FGenericPlatformHttp::UrlEncode(CategoryPath), *Language);
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(GetChildCategoriesEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("categoryPath"), FGenericPlatformHttp::UrlEncode(CategoryPath))
+		.Query(TEXT("language"), Language)
+		.Authorization(Credentials.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Category::GetDescendantCategories(const FString& Language, const FString& CategoryPath, const THandler<TArray<FAccelByteModelsCategoryInfo>>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/categories/%s/descendants?language=%s"), *Settings.PlatformServerUrl, *Credentials.GetNamespace(), *FGenericPlatformHttp::UrlEncode(CategoryPath), *Language);
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(GetDescendantCategoriesEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("categoryPath"), FGenericPlatformHttp::UrlEncode(CategoryPath))
+		.Query(TEXT("language"), Language)
+		.Authorization(Credentials.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 } // Namespace Api
@@ -7,6 +7,7 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "JsonUtilities.h"
 #include "Core/AccelByteSettings.h"
 
@@ -14,55 +15,56 @@ namespace AccelByte
 {
 namespace Api
 {
-CloudSave::CloudSave(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting) : Credentials(Credentials), Settings(Setting){}
+namespace
+{
+	constexpr FHttpEndpoint SaveUserRecordEndpoint(EHttpVerb::Post, TEXT("/v1/namespaces/{namespace}/users/{userId}/records/{key}"));
+	constexpr FHttpEndpoint SavePublicUserRecordEndpoint(EHttpVerb::Post, TEXT("/v1/namespaces/{namespace}/users/{userId}/records/{key}/public"));
+	constexpr FHttpEndpoint GetUserRecordEndpoint(EHttpVerb::Get, TEXT("/v1/namespaces/{namespace}/users/{userId}/records/{key}"));
+	constexpr FHttpEndpoint GetPublicUserRecordEndpoint(EHttpVerb::Get, TEXT("/v1/namespaces/{namespace}/users/{userId}/records/{key}/public"));
+	constexpr FHttpEndpoint ReplaceUserRecordEndpoint(EHttpVerb::Put, TEXT("/v1/namespaces/{namespace}/users/{userId}/records/{key}"));
+	constexpr FHttpEndpoint ReplacePublicUserRecordEndpoint(EHttpVerb::Put, TEXT("/v1/namespaces/{namespace}/users/{userId}/records/{key}/public"));
+	constexpr FHttpEndpoint ReplaceUserRecordConcurrentEndpoint(EHttpVerb::Put, TEXT("/v1/namespaces/{namespace}/users/{userId}/concurrent/records/{key}/public"));
+	constexpr FHttpEndpoint DeleteUserRecordEndpoint(EHttpVerb::Delete, TEXT("/v1/namespaces/{namespace}/users/{userId}/records/{key}"));
+	constexpr FHttpEndpoint SaveGameRecordEndpoint(EHttpVerb::Post, TEXT("/v1/namespaces/{namespace}/records/{key}"));
+	constexpr FHttpEndpoint GetGameRecordEndpoint(EHttpVerb::Get, TEXT("/v1/namespaces/{namespace}/records/{key}"));
+	constexpr FHttpEndpoint ReplaceGameRecordEndpoint(EHttpVerb::Put, TEXT("/v1/namespaces/{namespace}/records/{key}"));
+	constexpr FHttpEndpoint ReplaceGameRecordConcurrentEndpoint(EHttpVerb::Put, TEXT("/v1/namespaces/{namespace}/concurrent/records/{key}"));
+	constexpr FHttpEndpoint DeleteGameRecordEndpoint(EHttpVerb::Delete, TEXT("/v1/namespaces/{namespace}/records/{key}"));
+}
+
+CloudSave::CloudSave(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting, FHttpRetryScheduler& HttpRef) : Credentials(Credentials), Settings(Setting), HttpRef(HttpRef){}
 
 CloudSave::~CloudSave(){}
 
 void CloudSave::SaveUserRecord(const FString& Key, FJsonObject RecordRequest, bool IsPublic, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/v1/namespaces/%s/users/%s/records/%s%s"), *Settings.CloudSaveServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *Key, (IsPublic ? TEXT("/public") : TEXT("")));
-	FString Verb            = TEXT("POST");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content         = TEXT("");
-	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>(RecordRequest);
+	ACCELBYTE_LOG_FUNCTION();
+
+	FString Content;
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
-	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+	FJsonSerializer::Serialize(MakeShared<FJsonObject>(RecordRequest), Writer);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(IsPublic ? SavePublicUserRecordEndpoint : SaveUserRecordEndpoint, Settings.CloudSaveServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("key"), Key)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request,  CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void CloudSave::GetUserRecord(const FString& Key, const THandler<FAccelByteModelsUserRecord>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/namespaces/%s/users/%s/records/%s"), *Settings.CloudSaveServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *Key);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content = TEXT("");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(GetUserRecordEndpoint, Settings.CloudSaveServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("key"), Key)
+		.Authorization(Credentials.GetAuthorization());
+
+	HttpRef.ProcessRequest(
 		Request,
 		CreateHttpResultHandler(THandler<FJsonObject>::CreateLambda([OnSuccess](const FJsonObject& jsonObject)
 		{
@@ -87,24 +89,15 @@ void CloudSave::GetUserRecord(const FString& Key, const THandler<FAccelByteModel
 
 void CloudSave::GetPublicUserRecord(const FString& Key, const FString& UserId, const THandler<FAccelByteModelsUserRecord>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/namespaces/%s/users/%s/records/%s/public"), *Settings.CloudSaveServerUrl, *Credentials.GetNamespace(), *UserId, *Key);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content = TEXT("");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(GetPublicUserRecordEndpoint, Settings.CloudSaveServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Path(TEXT("key"), Key)
+		.Authorization(Credentials.GetAuthorization());
+
+	HttpRef.ProcessRequest(
 		Request,
 		CreateHttpResultHandler(THandler<FJsonObject>::CreateLambda([OnSuccess](const FJsonObject& jsonObject)
 	{
@@ -129,55 +122,41 @@ void CloudSave::GetPublicUserRecord(const FString& Key, const FString& UserId, c
 
 void CloudSave::ReplaceUserRecord(const FString& Key, FJsonObject RecordRequest, bool IsPublic, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/namespaces/%s/users/%s/records/%s%s"), *Settings.CloudSaveServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *Key, (IsPublic ? TEXT("/public") : TEXT("")));
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content = TEXT("");
-	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>(RecordRequest);
+	ACCELBYTE_LOG_FUNCTION();
+
+	FString Content;
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
-	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+	FJsonSerializer::Serialize(MakeShared<FJsonObject>(RecordRequest), Writer);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(IsPublic ? ReplacePublicUserRecordEndpoint : ReplaceUserRecordEndpoint, Settings.CloudSaveServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("key"), Key)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void CloudSave::ReplaceUserRecord(int TryAttempt, const FString& Key, const FAccelByteModelsConcurrentReplaceRequest& Data, const THandlerPayloadModifier<FJsonObject, FJsonObject>& PayloadModifier, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/namespaces/%s/users/%s/concurrent/records/%s/public"), *Settings.CloudSaveServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *Key);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content = TEXT("");
+	ACCELBYTE_LOG_FUNCTION();
+
 	FJsonObject DataJson;
 	DataJson.SetStringField("updatedAt", Data.UpdatedAt.ToIso8601());
 	DataJson.SetObjectField("value", MakeShared<FJsonObject>(Data.Value));
-	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>(DataJson);
+	FString Content;
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
-	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+	FJsonSerializer::Serialize(MakeShared<FJsonObject>(DataJson), Writer);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(ReplaceUserRecordConcurrentEndpoint, Settings.CloudSaveServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("key"), Key)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, FErrorHandler::CreateLambda([this, TryAttempt, Key, Data, PayloadModifier, OnSuccess, OnError](int32 Code, const FString& Message)
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, FErrorHandler::CreateLambda([this, TryAttempt, Key, Data, PayloadModifier, OnSuccess, OnError](int32 Code, const FString& Message)
 	{
 		if (Code == (int32)ErrorCodes::PlayerRecordPreconditionFailedException)
 		{
@@ -259,71 +238,44 @@ void CloudSave::ReplaceUserRecordCheckLatest(int TryAttempt, const FString& Key,
 
 void CloudSave::DeleteUserRecord(const FString& Key, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/namespaces/%s/users/%s/records/%s"), *Settings.CloudSaveServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *Key);
-	FString Verb = TEXT("DELETE");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content = TEXT("");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(DeleteUserRecordEndpoint, Settings.CloudSaveServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("key"), Key)
+		.Authorization(Credentials.GetAuthorization());
+
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void CloudSave::SaveGameRecord(const FString& Key, FJsonObject RecordRequest, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/namespaces/%s/records/%s"), *Settings.CloudSaveServerUrl, *Credentials.GetNamespace(), *Key);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content = TEXT("");
-	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>(RecordRequest);
+	ACCELBYTE_LOG_FUNCTION();
+
+	FString Content;
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
-	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+	FJsonSerializer::Serialize(MakeShared<FJsonObject>(RecordRequest), Writer);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(SaveGameRecordEndpoint, Settings.CloudSaveServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("key"), Key)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void CloudSave::GetGameRecord(const FString& Key, const THandler<FAccelByteModelsGameRecord>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/namespaces/%s/records/%s"), *Settings.CloudSaveServerUrl, *Credentials.GetNamespace(), *Key);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content = TEXT("");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(GetGameRecordEndpoint, Settings.CloudSaveServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("key"), Key)
+		.Authorization(Credentials.GetAuthorization());
+
+	HttpRef.ProcessRequest(
 		Request,
 		CreateHttpResultHandler(THandler<FJsonObject>::CreateLambda([OnSuccess](const FJsonObject& jsonObject)
 		{
@@ -346,55 +298,39 @@ void CloudSave::GetGameRecord(const FString& Key, const THandler<FAccelByteModel
 
 void CloudSave::ReplaceGameRecord(const FString& Key, FJsonObject RecordRequest, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/namespaces/%s/records/%s"), *Settings.CloudSaveServerUrl, *Credentials.GetNamespace(), *Key);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content = TEXT("");
-	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>(RecordRequest);
+	ACCELBYTE_LOG_FUNCTION();
+
+	FString Content;
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
-	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+	FJsonSerializer::Serialize(MakeShared<FJsonObject>(RecordRequest), Writer);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(ReplaceGameRecordEndpoint, Settings.CloudSaveServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("key"), Key)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void CloudSave::ReplaceGameRecord(int TryAttempt, const FString& Key, const FAccelByteModelsConcurrentReplaceRequest& Data, const THandlerPayloadModifier<FJsonObject, FJsonObject>& PayloadModifier, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/namespaces/%s/concurrent/records/%s"), *Settings.CloudSaveServerUrl, *Credentials.GetNamespace(), *Key);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content = TEXT("");
+	ACCELBYTE_LOG_FUNCTION();
+
 	FJsonObject DataJson;
 	DataJson.SetStringField("updatedAt", Data.UpdatedAt.ToIso8601());
 	DataJson.SetObjectField("value", MakeShared<FJsonObject>(Data.Value));
-	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>(DataJson);
+	FString Content;
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
-	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+	FJsonSerializer::Serialize(MakeShared<FJsonObject>(DataJson), Writer);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(ReplaceGameRecordConcurrentEndpoint, Settings.CloudSaveServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("key"), Key)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, FErrorHandler::CreateLambda([this, TryAttempt, Key, Data, PayloadModifier, OnSuccess, OnError](int32 Code, const FString& Message)
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, FErrorHandler::CreateLambda([this, TryAttempt, Key, Data, PayloadModifier, OnSuccess, OnError](int32 Code, const FString& Message)
 	{
 		if (Code == (int32)ErrorCodes::GameRecordPreconditionFailedException)
 		{
@@ -476,24 +412,14 @@ void CloudSave::ReplaceGameRecordCheckLatest(int TryAttempt, const FString& Key,
 
 void CloudSave::DeleteGameRecord(const FString& Key, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/namespaces/%s/records/%s"), *Settings.CloudSaveServerUrl, *Credentials.GetNamespace(), *Key);
-	FString Verb = TEXT("DELETE");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content = TEXT("");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(DeleteGameRecordEndpoint, Settings.CloudSaveServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("key"), Key)
+		.Authorization(Credentials.GetAuthorization());
+
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 } // Namespace Api
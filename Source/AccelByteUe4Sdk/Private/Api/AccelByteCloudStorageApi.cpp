@@ -4,6 +4,8 @@
 
 #include "Api/AccelByteCloudStorageApi.h"
 #include "Core/AccelByteError.h"
+#include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "JsonUtilities.h"
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
@@ -13,138 +15,102 @@ namespace AccelByte
 {
 namespace Api
 {
-	CloudStorage::CloudStorage(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Settings) : Credentials(Credentials), Settings(Settings){}
+namespace
+{
+	constexpr FHttpEndpoint GetAllSlotsEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/users/{userId}/slots"));
+	constexpr FHttpEndpoint CreateSlotEndpoint(EHttpVerb::Post, TEXT("/public/namespaces/{namespace}/users/{userId}/slots"));
+	constexpr FHttpEndpoint GetSlotEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/users/{userId}/slots/{slotId}"));
+	constexpr FHttpEndpoint UpdateSlotEndpoint(EHttpVerb::Put, TEXT("/public/namespaces/{namespace}/users/{userId}/slots/{slotId}"));
+	constexpr FHttpEndpoint UpdateSlotMetadataEndpoint(EHttpVerb::Put, TEXT("/public/namespaces/{namespace}/users/{userId}/slots/{slotId}/metadata"));
+	constexpr FHttpEndpoint DeleteSlotEndpoint(EHttpVerb::Delete, TEXT("/public/namespaces/{namespace}/users/{userId}/slots/{slotId}"));
+}
+
+	CloudStorage::CloudStorage(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Settings, FHttpRetryScheduler& HttpRef) : Credentials(Credentials), Settings(Settings), HttpRef(HttpRef){}
 
 	CloudStorage::~CloudStorage(){}
 
 	void CloudStorage::GetAllSlots(const THandler<TArray<FAccelByteModelsSlot>>& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/slots"), *Settings.CloudStorageServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId());
-		FString Verb            = TEXT("GET");
-		FString ContentType     = TEXT("application/json");
-		FString Accept          = TEXT("application/json");
-		FString Content         = TEXT("");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
-		Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-		Request->ProcessRequest();
+		ACCELBYTE_LOG_FUNCTION();
+
+		FHttpRequestBuilder Request(GetAllSlotsEndpoint, Settings.CloudStorageServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+			.Path(TEXT("userId"), Credentials.GetUserId())
+			.Authorization(Credentials.GetAuthorization());
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void CloudStorage::CreateSlot(TArray<uint8> BinaryData, const FString& FileName, const TArray<FString>& Tags, const FString& Label, const FString& CustomAttribute, const THandler<FAccelByteModelsSlot>& OnSuccess, FHttpRequestProgressDelegate OnProgress, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 		
-		FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/slots"), *Settings.CloudStorageServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId());
-
-		if (Tags.Num() != 0 || !Label.IsEmpty())
-		{
-			Url.Append(TEXT("?"));
-		}
+		FString BoundaryGuid = FGuid::NewGuid().ToString();
+		TArray<uint8> Content = CustomAttributeFormDataBuilder(CustomAttribute, BoundaryGuid, false);
+		Content.Append(FormDataBuilder(BinaryData, BoundaryGuid, FileName));
 
-		if (Tags.Num() != 0)
+		FHttpRequestBuilder Request(CreateSlotEndpoint, Settings.CloudStorageServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+			.Path(TEXT("userId"), Credentials.GetUserId())
+			.Authorization(Credentials.GetAuthorization())
+			.ContentType(FString::Printf(TEXT("multipart/form-data; boundary=%s"), *BoundaryGuid))
+			.Accept(TEXT("*/*"))
+			.Content(MoveTemp(Content))
+			.Progress(OnProgress);
+		for (const FString& Tag : Tags)
 		{
-			for (int i = 0; i < Tags.Num(); i++)
-			{
-				Url.Append(FString::Printf(TEXT("tags=%s&"), *FGenericPlatformHttp::UrlEncode(Tags[i])));
-			}
+			Request.Query(TEXT("tags"), FGenericPlatformHttp::UrlEncode(Tag));
 		}
 		if (!Label.IsEmpty())
 		{
-			Url.Append(FString::Printf(TEXT("label=%s"), *FGenericPlatformHttp::UrlEncode(Label)));
+			Request.Query(TEXT("label"), FGenericPlatformHttp::UrlEncode(Label));
 		}
-
-		FString Verb            = TEXT("POST");
-		FString Accept          = TEXT("*/*");
-		FString BoundaryGuid    = FGuid::NewGuid().ToString();
-		TArray<uint8> Content   = CustomAttributeFormDataBuilder(CustomAttribute, BoundaryGuid, false);
-		Content.Append(FormDataBuilder(BinaryData, BoundaryGuid, FileName));
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetHeader(TEXT("Content-Type"), FString::Printf(TEXT("multipart/form-data; boundary=%s"), *BoundaryGuid));
-		Request->SetContent(Content);
-		Request->OnRequestProgress() = OnProgress;
-		Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-		Request->ProcessRequest();
-		FReport::Log(TEXT("[AccelByte] Cloud Storage Start uploading..."));
+		// a create that reached the server must not be sent twice
+		FHttpRetryPolicy RetryPolicy = FHttpRetryPolicy::Transfer();
+		RetryPolicy.bIdempotent = false;
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), RetryPolicy);
+		ACCELBYTE_LOG(TEXT("[AccelByte] Cloud Storage Start uploading..."));
 	}
 
 	void CloudStorage::GetSlot(FString SlotID, const THandler<TArray<uint8>> & OnSuccess, const FErrorHandler & OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/slots/%s"), *Settings.CloudStorageServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *SlotID);
-		FString Verb            = TEXT("GET");
-		FString ContentType     = TEXT("application/json");
-		FString Accept          = TEXT("*/*");
-		FString Content         = TEXT("");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
-		Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-		Request->ProcessRequest();
+		ACCELBYTE_LOG_FUNCTION();
+
+		FHttpRequestBuilder Request(GetSlotEndpoint, Settings.CloudStorageServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+			.Path(TEXT("userId"), Credentials.GetUserId())
+			.Path(TEXT("slotId"), SlotID)
+			.Authorization(Credentials.GetAuthorization())
+			.Accept(TEXT("*/*"));
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), FHttpRetryPolicy::Transfer());
 	}
 
 	void CloudStorage::UpdateSlot(FString SlotID, const TArray<uint8> BinaryData, const FString& FileName, const TArray<FString> & Tags, const FString& Label, const FString& CustomAttribute, const THandler<FAccelByteModelsSlot> & OnSuccess, FHttpRequestProgressDelegate OnProgress, const FErrorHandler & OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());	
-		FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/slots/%s"), *Settings.CloudStorageServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *SlotID);
+		ACCELBYTE_LOG_FUNCTION();
 
-		if (Tags.Num() != 0 || !Label.IsEmpty())
-		{
-			Url.Append(TEXT("?"));
-		}
+		FString BoundaryGuid = FGuid::NewGuid().ToString();
+		TArray<uint8> Content = CustomAttributeFormDataBuilder(CustomAttribute, BoundaryGuid, false);
+		Content.Append(FormDataBuilder(BinaryData, BoundaryGuid, FileName));
 
-		if (Tags.Num() != 0)
+		FHttpRequestBuilder Request(UpdateSlotEndpoint, Settings.CloudStorageServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+			.Path(TEXT("userId"), Credentials.GetUserId())
+			.Path(TEXT("slotId"), SlotID)
+			.Authorization(Credentials.GetAuthorization())
+			.ContentType(FString::Printf(TEXT("multipart/form-data; boundary=%s"), *BoundaryGuid))
+			.Accept(TEXT("*/*"))
+			.Content(MoveTemp(Content))
+			.Progress(OnProgress);
+		for (const FString& Tag : Tags)
 		{
-			for (int i = 0; i < Tags.Num(); i++)
-			{
-				Url.Append(FString::Printf(TEXT("tags=%s&"), *FGenericPlatformHttp::UrlEncode(Tags[i])));
-			}
+			Request.Query(TEXT("tags"), FGenericPlatformHttp::UrlEncode(Tag));
 		}
 		if (!Label.IsEmpty())
 		{
-			Url.Append(FString::Printf(TEXT("label=%s"), *FGenericPlatformHttp::UrlEncode(Label)));
+			Request.Query(TEXT("label"), FGenericPlatformHttp::UrlEncode(Label));
 		}
-
-		FString Verb            = TEXT("PUT");
-		FString Accept          = TEXT("*/*");
-		FString BoundaryGuid    = FGuid::NewGuid().ToString();
-		TArray<uint8> Content   = CustomAttributeFormDataBuilder(CustomAttribute, BoundaryGuid, false);
-		Content.Append(FormDataBuilder(BinaryData, BoundaryGuid, FileName));
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetHeader(TEXT("Content-Type"), FString::Printf(TEXT("multipart/form-data; boundary=%s"), *BoundaryGuid));
-		Request->SetContent(Content);
-		Request->OnRequestProgress() = OnProgress;
-		Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-		Request->ProcessRequest();
-		FReport::Log(TEXT("[AccelByte] Cloud Storage Start uploading..."));
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), FHttpRetryPolicy::Transfer());
+		ACCELBYTE_LOG(TEXT("[AccelByte] Cloud Storage Start uploading..."));
 	}
 
 	void CloudStorage::UpdateSlotMetadata(const FString& SlotId, const FString& FileName, const TArray<FString>& Tags, const FString& Label, const FString& CustomAttribute, const THandler<FAccelByteModelsSlot>& OnSuccess, FHttpRequestProgressDelegate OnProgress, const FErrorHandler& OnError)
@@ -154,52 +120,36 @@ namespace Api
 
 	void CloudStorage::UpdateSlotMetadata(const FString& SlotId, const TArray<FString>& Tags, const FString& Label, const FString& CustomAttribute, const THandler<FAccelByteModelsSlot>& OnSuccess, FHttpRequestProgressDelegate OnProgress, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString Url           = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/slots/%s/metadata"), *Settings.CloudStorageServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *SlotId);
-		FString Verb          = TEXT("PUT");
-		FString Accept        = TEXT("application/json");
-		FString ContentType   = TEXT("application/json");
-		FString Content;
 		FAccelByteModelsUpdateMetadataRequest UpdateMedataRequest;
 		UpdateMedataRequest.Tags = Tags;
 		UpdateMedataRequest.Label = Label;
 		UpdateMedataRequest.CustomAttribute = CustomAttribute;
+		FString Content;
 		FJsonObjectConverter::UStructToJsonObjectString(UpdateMedataRequest, Content);
 
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetContentAsString(Content);
-		Request->OnRequestProgress() = OnProgress;
-		Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-		Request->ProcessRequest();
+		FHttpRequestBuilder Request(UpdateSlotMetadataEndpoint, Settings.CloudStorageServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+			.Path(TEXT("userId"), Credentials.GetUserId())
+			.Path(TEXT("slotId"), SlotId)
+			.Authorization(Credentials.GetAuthorization())
+			.Content(MoveTemp(Content))
+			.Progress(OnProgress);
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void CloudStorage::DeleteSlot(FString SlotID, const FVoidHandler & OnSuccess, const FErrorHandler & OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/slots/%s"), *Settings.CloudStorageServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *SlotID);
-		FString Verb            = TEXT("DELETE");
-		FString ContentType     = TEXT("application/json");
-		FString Accept          = TEXT("*/*");
-		FString Content         = TEXT("");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
-		Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-		Request->ProcessRequest();
+		ACCELBYTE_LOG_FUNCTION();
+
+		FHttpRequestBuilder Request(DeleteSlotEndpoint, Settings.CloudStorageServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+			.Path(TEXT("userId"), Credentials.GetUserId())
+			.Path(TEXT("slotId"), SlotID)
+			.Authorization(Credentials.GetAuthorization())
+			.Accept(TEXT("*/*"));
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	TArray<uint8> CloudStorage::FormDataBuilder(TArray<uint8> BinaryData, FString BoundaryGuid, FString FileName)
@@ -7,6 +7,7 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "JsonUtilities.h"
 #include "EngineMinimal.h"
 #include "Core/AccelByteSettings.h"
@@ -15,196 +16,131 @@ namespace AccelByte
 {
 namespace Api
 {
-Entitlement::Entitlement(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting) : Credentials(Credentials), Settings(Setting){}
+namespace
+{
+	constexpr FHttpEndpoint QueryUserEntitlementsEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/users/{userId}/entitlements"));
+	constexpr FHttpEndpoint GetUserEntitlementByIdEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/users/{userId}/entitlements/{entitlementId}"));
+	constexpr FHttpEndpoint GetOwnershipByAppIdEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/users/me/entitlements/ownership/byAppId"));
+	constexpr FHttpEndpoint GetOwnershipBySkuEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/users/me/entitlements/ownership/bySku"));
+	constexpr FHttpEndpoint GetOwnershipAnyEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/users/me/entitlements/ownership/any"));
+	constexpr FHttpEndpoint ConsumeUserEntitlementEndpoint(EHttpVerb::Put, TEXT("/public/namespaces/{namespace}/users/{userId}/entitlements/{entitlementId}/decrement"));
+	constexpr FHttpEndpoint CreateDistributionReceiverEndpoint(EHttpVerb::Post, TEXT("/public/namespaces/{namespace}/users/{userId}/entitlements/receivers/{extUserId}"));
+	constexpr FHttpEndpoint DeleteDistributionReceiverEndpoint(EHttpVerb::Delete, TEXT("/public/namespaces/{namespace}/users/{userId}/entitlements/receivers/{extUserId}"));
+	constexpr FHttpEndpoint GetDistributionReceiverEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/users/{userId}/entitlements/receivers"));
+	constexpr FHttpEndpoint UpdateDistributionReceiverEndpoint(EHttpVerb::Put, TEXT("/public/namespaces/{namespace}/users/{userId}/entitlements/receivers/{extUserId}"));
+	constexpr FHttpEndpoint SyncPlatformPurchaseEndpoint(EHttpVerb::Put, TEXT("/public/namespaces/{namespace}/users/{userId}/iap/{platform}/sync"));
+}
+
+Entitlement::Entitlement(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting, FHttpRetryScheduler& HttpRef) : Credentials(Credentials), Settings(Setting), HttpRef(HttpRef){}
 
 Entitlement::~Entitlement(){}
 
 void Entitlement::QueryUserEntitlements(const FString& EntitlementName, const FString& ItemId, const int32& Offset, const int32& Limit, const THandler<FAccelByteModelsEntitlementPagingSlicedResult>& OnSuccess, const FErrorHandler& OnError, EAccelByteEntitlementClass EntitlementClass = EAccelByteEntitlementClass::NONE, EAccelByteAppType AppType = EAccelByteAppType::NONE )
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/entitlements"), *Settings.PlatformServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId());
-	
-	FString Query = TEXT("");
-	if (!EntitlementName.IsEmpty())
-	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("entitlementName=%s"), *EntitlementName));
-	}
-	if (!ItemId.IsEmpty())
-	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("itemId=%s"), *ItemId));
-	}
-	if (Offset>=0)
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(QueryUserEntitlementsEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Query(TEXT("entitlementName"), EntitlementName)
+		.Authorization(Credentials.GetAuthorization());
+	Request.Query(TEXT("itemId"), ItemId);
+	if (Offset >= 0)
 	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("offset=%d"), Offset));
+		Request.Query(TEXT("offset"), Offset);
 	}
-	if (Limit>=0)
+	if (Limit >= 0)
 	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("limit=%d"), Limit));
+		Request.Query(TEXT("limit"), Limit);
 	}
 	if (EntitlementClass != EAccelByteEntitlementClass::NONE)
 	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("entitlementClazz=%s"), *FindObject<UEnum>(ANY_PACKAGE, TEXT("EAccelByteEntitlementClass"), true)->GetNameStringByValue((int32)EntitlementClass)));
+		Request.Query(TEXT("entitlementClazz"), FindObject<UEnum>(ANY_PACKAGE, TEXT("EAccelByteEntitlementClass"), true)->GetNameStringByValue((int32)EntitlementClass));
 	}
 	if (AppType != EAccelByteAppType::NONE)
 	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("appType=%s"), *FindObject<UEnum>(ANY_PACKAGE, TEXT("EAccelByteAppType"), true)->GetNameStringByValue((int32)AppType)));
+		Request.Query(TEXT("appType"), FindObject<UEnum>(ANY_PACKAGE, TEXT("EAccelByteAppType"), true)->GetNameStringByValue((int32)AppType));
 	}
-
-	Url.Append(Query.IsEmpty() ? TEXT("") : FString::Printf(TEXT("?%s"),*Query));
 	
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-	
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Entitlement::QueryUserEntitlements(const FString& EntitlementName, const TArray<FString>& ItemIds,
 	const int32& Offset, const int32& Limit, const THandler<FAccelByteModelsEntitlementPagingSlicedResult>& OnSuccess,
 	const FErrorHandler& OnError, EAccelByteEntitlementClass EntitlementClass, EAccelByteAppType AppType)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/entitlements"), *Settings.PlatformServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId());
-	
-	FString Query = TEXT("");
-	if (!EntitlementName.IsEmpty())
-	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("entitlementName=%s"), *EntitlementName));
-	}
+	FHttpRequestBuilder Request(QueryUserEntitlementsEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Query(TEXT("entitlementName"), EntitlementName)
+		.Authorization(Credentials.GetAuthorization());
 	for (const FString& ItemId : ItemIds)
 	{
-		if (!ItemId.IsEmpty())
-		{
-			Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-			Query.Append(FString::Printf(TEXT("itemId=%s"), *ItemId));
-		}
+		Request.Query(TEXT("itemId"), ItemId);
 	}
-	if (Offset>=0)
+	if (Offset >= 0)
 	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("offset=%d"), Offset));
+		Request.Query(TEXT("offset"), Offset);
 	}
-	if (Limit>=0)
+	if (Limit >= 0)
 	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("limit=%d"), Limit));
+		Request.Query(TEXT("limit"), Limit);
 	}
 	if (EntitlementClass != EAccelByteEntitlementClass::NONE)
 	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("entitlementClazz=%s"), *FindObject<UEnum>(ANY_PACKAGE, TEXT("EAccelByteEntitlementClass"), true)->GetNameStringByValue((int32)EntitlementClass)));
+		Request.Query(TEXT("entitlementClazz"), FindObject<UEnum>(ANY_PACKAGE, TEXT("EAccelByteEntitlementClass"), true)->GetNameStringByValue((int32)EntitlementClass));
 	}
 	if (AppType != EAccelByteAppType::NONE)
 	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("appType=%s"), *FindObject<UEnum>(ANY_PACKAGE, TEXT("EAccelByteAppType"), true)->GetNameStringByValue((int32)AppType)));
+		Request.Query(TEXT("appType"), FindObject<UEnum>(ANY_PACKAGE, TEXT("EAccelByteAppType"), true)->GetNameStringByValue((int32)AppType));
 	}
-
-	Url.Append(Query.IsEmpty() ? TEXT("") : FString::Printf(TEXT("?%s"),*Query));
 	
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-	
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Entitlement::GetUserEntitlementById(const FString& Entitlementid, const THandler<FAccelByteModelsEntitlementInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/entitlements/%s"), *Settings.PlatformServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *Entitlementid);
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
+	FHttpRequestBuilder Request(GetUserEntitlementByIdEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("entitlementId"), Entitlementid)
+		.Authorization(Credentials.GetAuthorization());
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Entitlement::GetUserEntitlementOwnershipByAppId(const FString& AppId, const THandler<FAccelByteModelsEntitlementOwnership>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/me/entitlements/ownership/byAppId?appId=%s"), *Settings.PlatformServerUrl, *Settings.PublisherNamespace, *AppId);
-
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FHttpRequestBuilder Request(GetOwnershipByAppIdEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Settings.PublisherNamespace)
+		.Query(TEXT("appId"), AppId)
+		.Authorization(Credentials.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Entitlement::GetUserEntitlementOwnershipBySku(const FString& Sku, const THandler<FAccelByteModelsEntitlementOwnership>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/me/entitlements/ownership/bySku?sku=%s"), *Settings.PlatformServerUrl, *Settings.PublisherNamespace, *Sku);
+	FHttpRequestBuilder Request(GetOwnershipBySkuEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Settings.PublisherNamespace)
+		.Query(TEXT("sku"), Sku)
+		.Authorization(Credentials.GetAuthorization());
 
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Entitlement::GetUserEntitlementOwnershipAny(const TArray<FString> ItemIds, const TArray<FString> AppIds, const TArray<FString> Skus,
 	const THandler<FAccelByteModelsEntitlementOwnership> OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (ItemIds.Num() < 1
 		&& AppIds.Num() < 1
@@ -214,175 +150,113 @@ void Entitlement::GetUserEntitlementOwnershipAny(const TArray<FString> ItemIds,
 	}
 	else
 	{
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/me/entitlements/ownership/any"), *Settings.PlatformServerUrl, *Settings.PublisherNamespace);
-
-		int paramCount = 0;
-		for (int i = 0; i < ItemIds.Num(); i++)
+		FHttpRequestBuilder Request(GetOwnershipAnyEndpoint, Settings.PlatformServerUrl);
+		Request.Path(TEXT("namespace"), Settings.PublisherNamespace)
+			.Authorization(Credentials.GetAuthorization());
+		for (const FString& ItemId : ItemIds)
 		{
-			Url.Append((paramCount == 0) ? TEXT("?") : TEXT("&")).Append(TEXT("itemIds=")).Append(ItemIds[i]);
-			paramCount++;
+			Request.Query(TEXT("itemIds"), ItemId);
 		}
-		for (int i = 0; i < AppIds.Num(); i++)
+		for (const FString& AppId : AppIds)
 		{
-			Url.Append((paramCount == 0) ? TEXT("?") : TEXT("&")).Append(TEXT("appIds=")).Append(AppIds[i]);
-			paramCount++;
+			Request.Query(TEXT("appIds"), AppId);
 		}
-		for (int i = 0; i < Skus.Num(); i++)
+		for (const FString& Sku : Skus)
 		{
-			Url.Append((paramCount == 0) ? TEXT("?") : TEXT("&")).Append(TEXT("skus=")).Append(Skus[i]);
-			paramCount++;
+			Request.Query(TEXT("skus"), Sku);
 		}
 
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-
-		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 }
 
 void Entitlement::ConsumeUserEntitlement(const FString& EntitlementId, const int32& UseCount, const THandler<FAccelByteModelsEntitlementInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FAccelByteModelsConsumeUserEntitlementRequest ConsumeUserEntitlementRequest;
 	ConsumeUserEntitlementRequest.UseCount = UseCount;
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/entitlements/%s/decrement"), *Settings.PlatformServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *EntitlementId);
-
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(ConsumeUserEntitlementRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(ConsumeUserEntitlementEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("entitlementId"), EntitlementId)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), FHttpRetryPolicy::NonIdempotent());
 }
 
 void Entitlement::CreateDistributionReceiver(const FString& ExtUserId, const FAccelByteModelsAttributes Attributes, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/entitlements/receivers/%s"), *Settings.PlatformServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *ExtUserId);
+	ACCELBYTE_LOG_FUNCTION();
 
 	FAccelByteModelsDistributionAttributes DistributionAttributes;
 	DistributionAttributes.Attributes = Attributes;
-
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(DistributionAttributes, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(CreateDistributionReceiverEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("extUserId"), ExtUserId)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Entitlement::DeleteDistributionReceiver(const FString& ExtUserId, const FString& UserId, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/entitlements/receivers/%s"), *Settings.PlatformServerUrl, *Credentials.GetNamespace(), *UserId, *ExtUserId);
+	FHttpRequestBuilder Request(DeleteDistributionReceiverEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Path(TEXT("extUserId"), ExtUserId)
+		.Authorization(Credentials.GetAuthorization());
 
-	FString Verb = TEXT("DELETE");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Entitlement::GetDistributionReceiver(const FString& PublisherNamespace, const FString& PublisherUserId, const THandler<TArray<FAccelByteModelsDistributionReceiver>>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/entitlements/receivers"), *Settings.PlatformServerUrl, *PublisherNamespace, *PublisherUserId);
-	
-	FString Query = TEXT("");
-	if (!Credentials.GetNamespace().IsEmpty())
-	{
-		Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-		Query.Append(FString::Printf(TEXT("targetNamespace=%s"), *Credentials.GetNamespace()));
-	}
-	Url.Append(Query.IsEmpty() ? TEXT("") : FString::Printf(TEXT("?%s"),*Query));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
+	FHttpRequestBuilder Request(GetDistributionReceiverEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), PublisherNamespace)
+		.Path(TEXT("userId"), PublisherUserId)
+		.Query(TEXT("targetNamespace"), Credentials.GetNamespace())
+		.Authorization(Credentials.GetAuthorization());
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Entitlement::UpdateDistributionReceiver(const FString& ExtUserId, const FAccelByteModelsAttributes Attributes, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/entitlements/receivers/%s"), *Settings.PlatformServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *ExtUserId);
+	ACCELBYTE_LOG_FUNCTION();
 
 	FAccelByteModelsDistributionAttributes DistributionAttributes;
 	DistributionAttributes.Attributes = Attributes;
-
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(DistributionAttributes, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(UpdateDistributionReceiverEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("extUserId"), ExtUserId)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Entitlement::SyncPlatformPurchase(EAccelBytePlatformSync PlatformType, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FString PlatformText = TEXT("");
 	FString Content = TEXT("{}");
@@ -409,22 +283,14 @@ void Entitlement::SyncPlatformPurchase(EAccelBytePlatformSync PlatformType, cons
 		return;
 	}
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/iap/%s/sync"), *Settings.PlatformServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *PlatformText);
-
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(SyncPlatformPurchaseEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("platform"), PlatformText)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 } // Namespace Api
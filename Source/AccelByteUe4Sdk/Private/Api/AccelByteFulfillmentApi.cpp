@@ -7,26 +7,26 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteSettings.h"
 
 namespace AccelByte
 {
 namespace Api
 {
-Fulfillment::Fulfillment(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting) : Credentials(Credentials), Settings(Setting){}
+namespace
+{
+	constexpr FHttpEndpoint RedeemCodeEndpoint(EHttpVerb::Post, TEXT("/public/namespaces/{namespace}/users/{userId}/fulfillment/code"));
+}
+
+Fulfillment::Fulfillment(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting, FHttpRetryScheduler& HttpRef) : Credentials(Credentials), Settings(Setting), HttpRef(HttpRef){}
 
 Fulfillment::~Fulfillment(){}
 
 void Fulfillment::RedeemCode(const FString& Code, const FString& Region, const FString& Language, THandler<FAccelByteModelsFulfillmentResult> OnSuccess, FErrorHandler OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/fulfillment/code"), *Settings.PlatformServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId());
-	
-	FString Verb            = TEXT("POST");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
 	FString Content = FString::Printf(TEXT("{\"code\":\"%s\""), *Code);
 	if(!Region.IsEmpty())
 	{
@@ -38,15 +38,13 @@ void Fulfillment::RedeemCode(const FString& Code, const FString& Region, const F
 	}
 	Content += "}";
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(RedeemCodeEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 	
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), FHttpRetryPolicy::NonIdempotent());
 }
 
 } // Namespace Api
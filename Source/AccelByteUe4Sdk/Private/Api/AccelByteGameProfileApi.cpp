@@ -6,14 +6,26 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteSettings.h"
 
 namespace AccelByte
 {
 namespace Api
 {
+namespace
+{
+	constexpr FHttpEndpoint BatchGetPublicGameProfilesEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/profiles"));
+	constexpr FHttpEndpoint GetAllGameProfilesEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/users/{userId}/profiles"));
+	constexpr FHttpEndpoint CreateGameProfileEndpoint(EHttpVerb::Post, TEXT("/public/namespaces/{namespace}/users/{userId}/profiles"));
+	constexpr FHttpEndpoint GetGameProfileEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/users/{userId}/profiles/{profileId}"));
+	constexpr FHttpEndpoint UpdateGameProfileEndpoint(EHttpVerb::Put, TEXT("/public/namespaces/{namespace}/users/{userId}/profiles/{profileId}"));
+	constexpr FHttpEndpoint DeleteGameProfileEndpoint(EHttpVerb::Delete, TEXT("/public/namespaces/{namespace}/users/{userId}/profiles/{profileId}"));
+	constexpr FHttpEndpoint GetGameProfileAttributeEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/users/{userId}/profiles/{profileId}/attributes/{attributeName}"));
+	constexpr FHttpEndpoint UpdateGameProfileAttributeEndpoint(EHttpVerb::Put, TEXT("/public/namespaces/{namespace}/users/{userId}/profiles/{profileId}/attributes/{attributeName}"));
+}
 
-GameProfile::GameProfile(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting) : Credentials(Credentials), Settings(Setting)
+GameProfile::GameProfile(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting, FHttpRetryScheduler& HttpRef) : Credentials(Credentials), Settings(Setting), HttpRef(HttpRef)
 {
 }
 
@@ -21,7 +33,7 @@ GameProfile::~GameProfile() { }
 
 void GameProfile::BatchGetPublicGameProfiles(TArray<FString> UserIds, const THandler<TArray<FAccelByteModelsPublicGameProfile>>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (UserIds.Num() < 1)
 	{
@@ -29,177 +41,111 @@ void GameProfile::BatchGetPublicGameProfiles(TArray<FString> UserIds, const THan
 	}
 	else
 	{
-		FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/profiles"), *Settings.GameProfileServerUrl, *Credentials.GetNamespace());
-		FString Verb            = TEXT("GET");
-		FString ContentType     = TEXT("application/json");
-		FString Accept          = TEXT("application/json");
-		FString Content;
-
-		for (int i = 0 ; i < UserIds.Num() ; i++)
+		FHttpRequestBuilder Request(BatchGetPublicGameProfilesEndpoint, Settings.GameProfileServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+			.Authorization(Credentials.GetAuthorization());
+		for (const FString& UserId : UserIds)
 		{
-			Url.Append((i == 0) ? TEXT("?") : TEXT("&")).Append(TEXT("userIds=")).Append(UserIds[i]);
+			Request.Query(TEXT("userIds"), UserId);
 		}
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
-		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 }
 
 void GameProfile::GetAllGameProfiles(const THandler<TArray<FAccelByteModelsGameProfile>>& OnSuccess, const FErrorHandler & OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/profiles"), *Settings.GameProfileServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId());
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(GetAllGameProfilesEndpoint, Settings.GameProfileServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Authorization(Credentials.GetAuthorization());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void GameProfile::CreateGameProfile(const FAccelByteModelsGameProfileRequest & GameProfileRequest, const THandler<FAccelByteModelsGameProfile>& OnSuccess, const FErrorHandler & OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/profiles"), *Settings.GameProfileServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId());
-	FString Verb            = TEXT("POST");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString<FAccelByteModelsGameProfileRequest>(GameProfileRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(CreateGameProfileEndpoint, Settings.GameProfileServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void GameProfile::GetGameProfile(const FString & ProfileId, const THandler<FAccelByteModelsGameProfile>& OnSuccess, const FErrorHandler & OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/profiles/%s"), *Settings.GameProfileServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *ProfileId);
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(GetGameProfileEndpoint, Settings.GameProfileServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("profileId"), ProfileId)
+		.Authorization(Credentials.GetAuthorization());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void GameProfile::UpdateGameProfile(const FString & ProfileId, const FAccelByteModelsGameProfileRequest & GameProfileRequest, const THandler<FAccelByteModelsGameProfile>& OnSuccess, const FErrorHandler & OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/profiles/%s"), *Settings.GameProfileServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *ProfileId);
-	FString Verb            = TEXT("PUT");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(GameProfileRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(UpdateGameProfileEndpoint, Settings.GameProfileServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("profileId"), ProfileId)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void GameProfile::DeleteGameProfile(const FString & ProfileId, const FVoidHandler& OnSuccess, const FErrorHandler & OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/profiles/%s"), *Settings.GameProfileServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *ProfileId);
-	FString Verb            = TEXT("DELETE");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(DeleteGameProfileEndpoint, Settings.GameProfileServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("profileId"), ProfileId)
+		.Authorization(Credentials.GetAuthorization());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void GameProfile::GetGameProfileAttribute(const FString & ProfileId, const FString & AttributeName, const THandler<FAccelByteModelsGameProfileAttribute>& OnSuccess, const FErrorHandler & OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/profiles/%s/attributes/%s"), *Settings.GameProfileServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *ProfileId, *AttributeName);
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(GetGameProfileAttributeEndpoint, Settings.GameProfileServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("profileId"), ProfileId)
+		.Path(TEXT("attributeName"), AttributeName)
+		.Authorization(Credentials.GetAuthorization());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void GameProfile::UpdateGameProfileAttribute(const FString & ProfileId, const FAccelByteModelsGameProfileAttribute& Attribute, const THandler<FAccelByteModelsGameProfile>& OnSuccess, const FErrorHandler & OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/profiles/%s/attributes/%s"), *Settings.GameProfileServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId(), *ProfileId, *Attribute.name);
-	FString Verb            = TEXT("PUT");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(Attribute, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(UpdateGameProfileAttributeEndpoint, Settings.GameProfileServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("profileId"), ProfileId)
+		.Path(TEXT("attributeName"), Attribute.name)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 } // Namespace Api
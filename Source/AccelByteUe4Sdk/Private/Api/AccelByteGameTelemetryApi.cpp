@@ -5,8 +5,10 @@
 #include "Api/AccelByteGameTelemetryApi.h"
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteTimerService.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "JsonUtilities.h"
 #include "Core/AccelByteSettings.h"
 
@@ -14,10 +16,15 @@ namespace AccelByte
 {
 namespace Api
 {
+namespace
+{
+	constexpr FHttpEndpoint SendProtectedEventsEndpoint(EHttpVerb::Post, TEXT("/v1/protected/events"));
+}
 
-GameTelemetry::GameTelemetry(const AccelByte::Credentials & Credentials, const AccelByte::Settings & Settings)
+GameTelemetry::GameTelemetry(const AccelByte::Credentials & Credentials, const AccelByte::Settings & Settings, FHttpRetryScheduler& HttpRef)
 : Credentials(Credentials)
 , Settings(Settings)
+, HttpRef(HttpRef)
 , ShuttingDown(false)
 {
 }
@@ -52,7 +59,7 @@ void GameTelemetry::Send(FAccelByteModelsTelemetryBody TelemetryBody, const FVoi
 		return;
 	}
 
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (ImmediateEvents.Contains(TelemetryBody.EventName))
 	{
@@ -65,7 +72,7 @@ void GameTelemetry::Send(FAccelByteModelsTelemetryBody TelemetryBody, const FVoi
 		{
 			bTelemetryJobStarted = true;
 			GameTelemetryTickDelegate = FTickerDelegate::CreateRaw(this, &GameTelemetry::PeriodicTelemetry);
-			GameTelemetryTickDelegateHandle = FTicker::GetCoreTicker().AddTicker(GameTelemetryTickDelegate, (float)TelemetryInterval.GetSeconds());
+			GameTelemetryTickDelegateHandle = FRegistry::TimerService.AddTicker(GameTelemetryTickDelegate, (float)TelemetryInterval.GetSeconds());
 		}
 	}
 }
@@ -80,11 +87,7 @@ void GameTelemetry::Shutdown()
 	ShuttingDown = true;
 	if(UObjectInitialized())
 	{
-		if (GameTelemetryTickDelegateHandle.IsValid())
-		{
-			FTicker::GetCoreTicker().RemoveTicker(GameTelemetryTickDelegateHandle);
-			GameTelemetryTickDelegateHandle.Reset();
-		}
+		FRegistry::TimerService.RemoveTimer(GameTelemetryTickDelegateHandle);
 		// flush events
 		PeriodicTelemetry(0);
 	}
@@ -94,7 +97,7 @@ bool GameTelemetry::PeriodicTelemetry(float DeltaTime)
 {
 	if (!JobQueue.IsEmpty())
 	{
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 
 		TArray<FAccelByteModelsTelemetryBody> TelemetryBodies;
 		TArray<FVoidHandler> OnSuccessCallbacks;
@@ -134,13 +137,8 @@ void GameTelemetry::SendProtectedEvents(TArray<FAccelByteModelsTelemetryBody> Ev
 		return;
 	}
 
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/protected/events"), *Settings.GameTelemetryServerUrl);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content = TEXT("");
 
 	TArray<TSharedPtr<FJsonValue>> JsonArray;
@@ -156,15 +154,11 @@ void GameTelemetry::SendProtectedEvents(TArray<FAccelByteModelsTelemetryBody> Ev
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(JsonArray, Writer);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(SendProtectedEventsEndpoint, Settings.GameTelemetryServerUrl);
+	Request.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Telemetry);
 }
 
 } 
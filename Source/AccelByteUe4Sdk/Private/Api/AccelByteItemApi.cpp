@@ -8,13 +8,22 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteSettings.h"
 
 namespace AccelByte
 {
 namespace Api
 {
-Item::Item(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Settings) : Credentials(Credentials), Settings(Settings){}
+namespace
+{
+	constexpr FHttpEndpoint GetItemByIdEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/items/{itemId}/locale"));
+	constexpr FHttpEndpoint GetItemByAppIdEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/items/byAppId"));
+	constexpr FHttpEndpoint GetItemsByCriteriaEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/items/byCriteria"));
+	constexpr FHttpEndpoint SearchItemEndpoint(EHttpVerb::Get, TEXT("/public/namespaces/{namespace}/items/search"));
+}
+
+Item::Item(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Settings, FHttpRetryScheduler& HttpRef) : Credentials(Credentials), Settings(Settings), HttpRef(HttpRef){}
 
 Item::~Item(){}
 
@@ -42,243 +51,83 @@ FString EAccelByteAppTypeToString(const EAccelByteAppType& EnumValue)
 
 void Item::GetItemById(const FString& ItemId, const FString& Language, const FString& Region, const THandler<FAccelByteModelsPopulatedItemInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/items/%s/locale"), *Settings.PlatformServerUrl, *Credentials.GetNamespace(), *ItemId);
-	if (!Region.IsEmpty() || !Language.IsEmpty())
-	{
-		Url.Append(FString::Printf(TEXT("?")));
-		if (!Region.IsEmpty())
-		{
-			Url.Append(FString::Printf(TEXT("region=%s"), *Region));
-			if (!Language.IsEmpty())
-			{
-				Url.Append(FString::Printf(TEXT("&language=%s"), *Language));
-			}
-		}
-		else if (!Language.IsEmpty())
-		{
-			Url.Append(FString::Printf(TEXT("language=%s"), *Language));
-		}
-	}
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content;
+	FHttpRequestBuilder Request(GetItemByIdEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("itemId"), ItemId)
+		.Query(TEXT("region"), Region)
+		.Query(TEXT("language"), Language)
+		.Authorization(Credentials.GetAuthorization());
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Item::GetItemByAppId(const FString& AppId, const FString& Language, const FString& Region, const THandler<FAccelByteModelsItemInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/items/byAppId?appId=%s"), *Settings.PlatformServerUrl, *Settings.PublisherNamespace, *AppId);
-	if (!Region.IsEmpty() || !Language.IsEmpty())
-	{
-		Url.Append(FString::Printf(TEXT("&")));
-		if (!Region.IsEmpty())
-		{
-			Url.Append(FString::Printf(TEXT("region=%s"), *Region));
-			if (!Language.IsEmpty())
-			{
-				Url.Append(FString::Printf(TEXT("&language=%s"), *Language));
-			}
-		}
-		else if (!Language.IsEmpty())
-		{
-			Url.Append(FString::Printf(TEXT("language=%s"), *Language));
-		}
-	}
-
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(GetItemByAppIdEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Settings.PublisherNamespace)
+		.Query(TEXT("appId"), AppId)
+		.Query(TEXT("region"), Region)
+		.Query(TEXT("language"), Language);
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Item::GetItemsByCriteria(const FAccelByteModelsItemCriteria& ItemCriteria, const int32& Offset, const int32& Limit, const THandler<FAccelByteModelsItemPagingSlicedResult>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-    FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/items/byCriteria"), *Settings.PlatformServerUrl, *Settings.Namespace);
-    bool bIsNotFirst = false;
-    if (!ItemCriteria.CategoryPath.IsEmpty())
-    {
-        bIsNotFirst = true; Url.Append("?");
-        Url.Append(FString::Printf(TEXT("categoryPath=%s"), *FGenericPlatformHttp::UrlEncode(ItemCriteria.CategoryPath)));
-    }
-    if (!ItemCriteria.Region.IsEmpty())
-    {
-        if (bIsNotFirst)
-        {
-            Url.Append("&");
-        }
-        else
-        {
-            bIsNotFirst = true; Url.Append("?");
-        }
-        Url.Append(FString::Printf(TEXT("region=%s"), *ItemCriteria.Region));
-    }
-    if (!ItemCriteria.Language.IsEmpty())
-	{
-		if (bIsNotFirst)
-		{
-			Url.Append("&");
-		}
-		else
-		{
-			bIsNotFirst = true; Url.Append("?");
-		}
-		Url.Append(FString::Printf(TEXT("language=%s"), *ItemCriteria.Language));
-	}	
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(GetItemsByCriteriaEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Query(TEXT("categoryPath"), FGenericPlatformHttp::UrlEncode(ItemCriteria.CategoryPath))
+		.Query(TEXT("region"), ItemCriteria.Region)
+		.Query(TEXT("language"), ItemCriteria.Language)
+		.Authorization(Credentials.GetAuthorization());
 	if (ItemCriteria.ItemType != EAccelByteItemType::NONE)
 	{
-		if (bIsNotFirst)
-		{
-			Url.Append("&");
-		}
-		else
-		{
-			bIsNotFirst = true; Url.Append("?");
-		}
-		Url.Append(FString::Printf(TEXT("itemType=%s"), *EAccelByteItemTypeToString(ItemCriteria.ItemType)));
+		Request.Query(TEXT("itemType"), EAccelByteItemTypeToString(ItemCriteria.ItemType));
 	}
 	if (ItemCriteria.AppType != EAccelByteAppType::NONE)
 	{
-		if (bIsNotFirst)
-		{
-			Url.Append("&");
-		}
-		else
-		{
-			bIsNotFirst = true; Url.Append("?");
-		}
-		Url.Append(FString::Printf(TEXT("appType=%s"), *EAccelByteAppTypeToString(ItemCriteria.AppType)));
-	}
-	if (ItemCriteria.Tags.Num() > 0)
-	{
-		if (bIsNotFirst)
-		{
-			Url.Append("&");
-		}
-		else
-		{
-			bIsNotFirst = true; Url.Append("?");
-		}
-		for (int i = 0; i < ItemCriteria.Tags.Num(); i++)
-		{
-			Url.Append((i == 0) ? TEXT("tags=") : TEXT(",")).Append(ItemCriteria.Tags[i]);
-		}
-	}
-	if (ItemCriteria.Features.Num() > 0)
-	{
-		if (bIsNotFirst)
-		{
-			Url.Append("&");
-		}
-		else
-		{
-			bIsNotFirst = true; Url.Append("?");
-		}
-		for (int i = 0; i < ItemCriteria.Features.Num(); i++)
-		{
-			Url.Append((i == 0) ? TEXT("features=") : TEXT(",")).Append(ItemCriteria.Features[i]);
-		}
+		Request.Query(TEXT("appType"), EAccelByteAppTypeToString(ItemCriteria.AppType));
 	}
+	Request.Query(TEXT("tags"), ItemCriteria.Tags)
+		.Query(TEXT("features"), ItemCriteria.Features);
 	if (Offset > 0)
 	{
-		if (bIsNotFirst)
-		{
-			Url.Append("&");
-		}
-		else
-		{
-			bIsNotFirst = true; Url.Append("?");
-		}
-		Url.Append(FString::Printf(TEXT("offset=%d"), Offset));
+		Request.Query(TEXT("offset"), Offset);
 	}
 	if (Limit > 0)
 	{
-		if (bIsNotFirst)
-		{
-			Url.Append("&");
-		}
-		else
-		{
-			bIsNotFirst = true; Url.Append("?");
-		}
-		Url.Append(FString::Printf(TEXT("limit=%d"), Limit));
+		Request.Query(TEXT("limit"), Limit);
 	}
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content         = TEXT("");
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Item::SearchItem(const FString& Language, const FString& Keyword, const int32& Offset, const int32& Limit, const FString& Region, const THandler<FAccelByteModelsItemPagingSlicedResult>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/public/namespaces/%s/items/search?language=%s&keyword=%s"), *Settings.PlatformServerUrl, *Settings.Namespace, *Language, *FGenericPlatformHttp::UrlEncode(Keyword));
-	if (!Region.IsEmpty())
-	{
-		Url.Append(FString::Printf(TEXT("&region=%s"), *Region));
-	}
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(SearchItemEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Query(TEXT("language"), Language)
+		.Query(TEXT("keyword"), FGenericPlatformHttp::UrlEncode(Keyword))
+		.Query(TEXT("region"), Region)
+		.Authorization(Credentials.GetAuthorization());
 	if (Offset > 0)
 	{
-		Url.Append(FString::Printf(TEXT("&offset=%d"), Offset));
+		Request.Query(TEXT("offset"), Offset);
 	}
 	if (Limit > 0)
 	{
-		Url.Append(FString::Printf(TEXT("&limit=%d"), Limit));
+		Request.Query(TEXT("limit"), Limit);
 	}
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content         = TEXT("");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 } // Namespace Api
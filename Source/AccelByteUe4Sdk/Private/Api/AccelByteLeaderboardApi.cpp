@@ -6,14 +6,20 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteSettings.h"
 
 namespace AccelByte
 {
 namespace Api
 {
+namespace
+{
+	constexpr FHttpEndpoint GetRankingsEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/leaderboards/{leaderboardCode}/{timeFrame}"));
+	constexpr FHttpEndpoint GetUserRankingEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/leaderboards/{leaderboardCode}/users/{userId}"));
+}
 
-	Leaderboard::Leaderboard(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting) : Credentials(Credentials), Settings(Setting)
+	Leaderboard::Leaderboard(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting, FHttpRetryScheduler& HttpRef) : Credentials(Credentials), Settings(Setting), HttpRef(HttpRef)
 	{}
 
 	Leaderboard::~Leaderboard()
@@ -21,7 +27,7 @@ namespace Api
 
 	void Leaderboard::GetRankings(const FString& LeaderboardCode, const EAccelByteLeaderboardTimeFrame& TimeFrame, uint32 Offset, uint32 Limit, const THandler<FAccelByteModelsLeaderboardRankingResult>& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 
 		FString TimeFrameString = "";
 		switch (TimeFrame)
@@ -45,53 +51,34 @@ namespace Api
 			break;
 		}
 
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/leaderboards/%s/%s"), *Settings.LeaderboardServerUrl, *Settings.Namespace, *LeaderboardCode, *TimeFrameString);
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-		
-		if (Offset > 0 || Limit > 0)
+		FHttpRequestBuilder Request(GetRankingsEndpoint, Settings.LeaderboardServerUrl);
+		Request.Path(TEXT("namespace"), Settings.Namespace)
+			.Path(TEXT("leaderboardCode"), LeaderboardCode)
+			.Path(TEXT("timeFrame"), TimeFrameString)
+			.Authorization(Credentials.GetAuthorization());
+		if (Offset > 0)
 		{
-			Url.Append("?");
-			if (Offset > 0)
-			{
-				Url.Append(FString::Printf(TEXT("offset=%d&"), Offset));
-			}
-			if (Limit > 0)
-			{
-				Url.Append(FString::Printf(TEXT("limit=%d"), Limit));
-			}
+			Request.Query(TEXT("offset"), Offset);
+		}
+		if (Limit > 0)
+		{
+			Request.Query(TEXT("limit"), Limit);
 		}
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
 		
-		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void Leaderboard::GetUserRanking(const FString& UserId, const FString& LeaderboardCode, const THandler<FAccelByteModelsUserRankingData>& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/leaderboards/%s/users/%s"), *Settings.LeaderboardServerUrl, *Settings.Namespace, *LeaderboardCode, *UserId);
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-		
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
+		FHttpRequestBuilder Request(GetUserRankingEndpoint, Settings.LeaderboardServerUrl);
+		Request.Path(TEXT("namespace"), Settings.Namespace)
+			.Path(TEXT("leaderboardCode"), LeaderboardCode)
+			.Path(TEXT("userId"), UserId)
+			.Authorization(Credentials.GetAuthorization());
 		
-		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 } // Namespace Api
@@ -8,8 +8,11 @@
 #include "WebSocketsModule.h"
 #include "Core/AccelByteCredentials.h"
 #include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteTimerService.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
+#include "Core/AccelByteLobbyMessageParser.h"
 #include "Core/AccelByteSettings.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteLobby, Log, All);
@@ -178,9 +181,20 @@ namespace Api
 		const FString Attribute = TEXT("attribute");
 	}
 
+	namespace
+	{
+		constexpr FHttpEndpoint BulkFriendRequestEndpoint(EHttpVerb::Post, TEXT("/friends/namespaces/{namespace}/users/{userId}/add/bulk"));
+		constexpr FHttpEndpoint GetPartyDataEndpoint(EHttpVerb::Get, TEXT("/lobby/v1/public/party/namespaces/{namespace}/parties/{partyId}"));
+		constexpr FHttpEndpoint BulkGetUserPresenceEndpoint(EHttpVerb::Get, TEXT("/lobby/v1/public/presence/namespaces/{namespace}/users/presence"));
+		constexpr FHttpEndpoint GetListOfBlockedUsersEndpoint(EHttpVerb::Get, TEXT("/lobby/v1/public/player/namespaces/{namespace}/users/{userId}/blocked"));
+		constexpr FHttpEndpoint GetListOfBlockersEndpoint(EHttpVerb::Get, TEXT("/lobby/v1/public/player/namespaces/{namespace}/users/{userId}/blocked-by"));
+		constexpr FHttpEndpoint SendNotificationToUserEndpoint(EHttpVerb::Post, TEXT("/notification/namespaces/{namespace}/users/{userId}/freeform"));
+		constexpr FHttpEndpoint WritePartyStorageEndpoint(EHttpVerb::Put, TEXT("/lobby/v1/public/party/namespaces/{namespace}/parties/{partyId}/attributes"));
+	}
+
 void Lobby::Connect()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (!WebSocket.IsValid())
 	{
@@ -198,13 +212,8 @@ void Lobby::Connect()
 		CreateWebSocket();
 	}
 
-	if (LobbyTickDelegateHandle.IsValid())
-	{
-		FTicker::GetCoreTicker().RemoveTicker(LobbyTickDelegateHandle);
-		LobbyTickDelegateHandle.Reset();
-	}
-
-	LobbyTickDelegateHandle = FTicker::GetCoreTicker().AddTicker(LobbyTickDelegate, LobbyTickPeriod);
+	FRegistry::TimerService.RemoveTimer(LobbyTickDelegateHandle);
+	LobbyTickDelegateHandle = FRegistry::TimerService.AddTicker(LobbyTickDelegate, LobbyTickPeriod);
 
 	WebSocket->Connect();
 	WsEvents |= EWebSocketEvent::Connect;
@@ -213,14 +222,13 @@ void Lobby::Connect()
 
 void Lobby::Disconnect()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	ChannelSlug = "";
-	if (LobbyTickDelegateHandle.IsValid())
-	{
-		FTicker::GetCoreTicker().RemoveTicker(LobbyTickDelegateHandle);
-		LobbyTickDelegateHandle.Reset();
-	}
+	FRegistry::TimerService.RemoveTimer(LobbyTickDelegateHandle);
+	DropOutboundQueue(OutboundQueueStats.DisconnectedCount, static_cast<int32>(ErrorCodes::WebSocketConnectFailed), TEXT("Lobby is disconnected."));
+	DropDelayedMessages(static_cast<int32>(ErrorCodes::WebSocketConnectFailed), TEXT("Lobby is disconnected."));
+	FailPendingRequests(static_cast<int32>(ErrorCodes::WebSocketConnectFailed), TEXT("Lobby is disconnected."));
 
 	if (WebSocket.IsValid())
 	{
@@ -238,14 +246,14 @@ void Lobby::Disconnect()
 
 bool Lobby::IsConnected() const
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return WebSocket.IsValid() && WebSocket->IsConnected();
 }
 
 void Lobby::SendPing()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (WebSocket.IsValid() && WebSocket->IsConnected())
 	{
@@ -253,12 +261,44 @@ void Lobby::SendPing()
 	}
 }
 
+template<typename Model, typename DelegateType>
+FString Lobby::SendRequest(const FString& MessageType, const FString& MessageIDPrefix, const FString& CustomPayload, const DelegateType& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds)
+{
+	const FString MessageID = SendRawRequest(MessageType, MessageIDPrefix, CustomPayload);
+	if (MessageID.IsEmpty())
+	{
+		OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::WebSocketConnectFailed), TEXT("Lobby request not sent."));
+		return MessageID;
+	}
+
+	AddPendingRequest(MessageID, [OnResponse, OnError](const FLobbyMessageParser& Message)
+	{
+		Model Result;
+		const int32 Code = Message.GetIntegerField(TEXT("code"));
+		if (Code != 0)
+		{
+			Result.Code = FString::FromInt(Code);
+			OnResponse.ExecuteIfBound(Result);
+		}
+		else if (Message.Decode(Result))
+		{
+			OnResponse.ExecuteIfBound(Result);
+		}
+		else
+		{
+			OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::JsonDeserializationFailed), FString::Printf(TEXT("Error cannot parse response %s, Raw: %s"), *Message.GetType(), *Message.GetMessage()));
+		}
+	}, OnError, TimeoutSeconds);
+
+	return MessageID;
+}
+
 //-------------------------------------------------------------------------------------------------
 // Chat
 //-------------------------------------------------------------------------------------------------
 FString Lobby::SendPrivateMessage(const FString& UserId, const FString& Message)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::PersonalChat, Prefix::Chat,
 		FString::Printf(TEXT("to: %s\npayload: %s\n"), *UserId, *Message));
@@ -266,7 +306,7 @@ FString Lobby::SendPrivateMessage(const FString& UserId, const FString& Message)
 
 FString Lobby::SendPartyMessage(const FString& Message)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::PartyChat, Prefix::Chat,
 		FString::Printf(TEXT("payload: %s\n"), *Message));
@@ -274,14 +314,14 @@ FString Lobby::SendPartyMessage(const FString& Message)
 
 FString Lobby::SendJoinDefaultChannelChatRequest()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::JoinChannelChat, Prefix::Chat);
 }
 
 FString Lobby::SendChannelMessage(const FString& Message)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (!ChannelSlug.IsEmpty())
 	{
@@ -305,44 +345,81 @@ FString Lobby::SendChannelMessage(const FString& Message)
 //-------------------------------------------------------------------------------------------------
 FString Lobby::SendInfoPartyRequest()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::PartyInfo, Prefix::Party);
 }
 
+FString Lobby::SendInfoPartyRequest(const FPartyInfoResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds)
+{
+	ACCELBYTE_LOG_FUNCTION();
+
+	return SendRequest<FAccelByteModelsInfoPartyResponse>(LobbyRequest::PartyInfo, Prefix::Party, TEXT(""), OnResponse, OnError, TimeoutSeconds);
+}
+
 FString Lobby::SendCreatePartyRequest()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::CreateParty, Prefix::Party);
 }
 
+FString Lobby::SendCreatePartyRequest(const FPartyCreateResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds)
+{
+	ACCELBYTE_LOG_FUNCTION();
+
+	return SendRequest<FAccelByteModelsCreatePartyResponse>(LobbyRequest::CreateParty, Prefix::Party, TEXT(""), OnResponse, OnError, TimeoutSeconds);
+}
+
 FString Lobby::SendLeavePartyRequest()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::LeaveParty, Prefix::Party);
 }
 
+FString Lobby::SendLeavePartyRequest(const FPartyLeaveResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds)
+{
+	ACCELBYTE_LOG_FUNCTION();
+
+	return SendRequest<FAccelByteModelsLeavePartyResponse>(LobbyRequest::LeaveParty, Prefix::Party, TEXT(""), OnResponse, OnError, TimeoutSeconds);
+}
+
 FString Lobby::SendInviteToPartyRequest(const FString& UserId)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::InviteParty, Prefix::Party,
 		FString::Printf(TEXT("friendID: %s"), *UserId));
 }
 
+FString Lobby::SendInviteToPartyRequest(const FString& UserId, const FPartyInviteResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds)
+{
+	ACCELBYTE_LOG_FUNCTION();
+
+	return SendRequest<FAccelByteModelsPartyInviteResponse>(LobbyRequest::InviteParty, Prefix::Party,
+		FString::Printf(TEXT("friendID: %s"), *UserId), OnResponse, OnError, TimeoutSeconds);
+}
+
 FString Lobby::SendAcceptInvitationRequest(const FString& PartyId, const FString& InvitationToken)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::JoinParty, Prefix::Party,
 		FString::Printf(TEXT("partyID: %s\ninvitationToken: %s"), *PartyId, *InvitationToken));
 }
 
+FString Lobby::SendAcceptInvitationRequest(const FString& PartyId, const FString& InvitationToken, const FPartyJoinResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds)
+{
+	ACCELBYTE_LOG_FUNCTION();
+
+	return SendRequest<FAccelByteModelsPartyJoinReponse>(LobbyRequest::JoinParty, Prefix::Party,
+		FString::Printf(TEXT("partyID: %s\ninvitationToken: %s"), *PartyId, *InvitationToken), OnResponse, OnError, TimeoutSeconds);
+}
+
 FString Api::Lobby::SendRejectInvitationRequest(const FString& PartyId, const FString& InvitationToken)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::RejectParty, Prefix::Party,
 		FString::Printf(TEXT("partyID: %s\ninvitationToken: %s"), *PartyId, *InvitationToken));
@@ -350,29 +427,37 @@ FString Api::Lobby::SendRejectInvitationRequest(const FString& PartyId, const FS
 
 FString Lobby::SendKickPartyMemberRequest(const FString& UserId)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::KickParty, Prefix::Party,
 		FString::Printf(TEXT("memberID: %s\n"), *UserId));
 }
 
+FString Lobby::SendKickPartyMemberRequest(const FString& UserId, const FPartyKickResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds)
+{
+	ACCELBYTE_LOG_FUNCTION();
+
+	return SendRequest<FAccelByteModelsKickPartyMemberResponse>(LobbyRequest::KickParty, Prefix::Party,
+		FString::Printf(TEXT("memberID: %s\n"), *UserId), OnResponse, OnError, TimeoutSeconds);
+}
+
 FString Lobby::SendPartyGetCodeRequest()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::PartyGetCodeRequest, Prefix::Party);
 }
 
 FString Lobby::SendPartyDeleteCodeRequest()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::PartyDeleteCodeRequest, Prefix::Party);
 }
 
 FString Lobby::SendPartyJoinViaCodeRequest(const FString& partyCode)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::PartyJoinViaCodeRequest, Prefix::Party,
 		FString::Printf(TEXT("partyCode: %s\n"), *partyCode));
@@ -380,7 +465,7 @@ FString Lobby::SendPartyJoinViaCodeRequest(const FString& partyCode)
 
 FString Lobby::SendPartyPromoteLeaderRequest(const FString& UserId)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::PartyPromoteLeaderRequest, Prefix::Party,
 		FString::Printf(TEXT("newLeaderUserId: %s\n"), *UserId));
@@ -391,7 +476,7 @@ FString Lobby::SendPartyPromoteLeaderRequest(const FString& UserId)
 //-------------------------------------------------------------------------------------------------
 FString Lobby::SendSetPresenceStatus(const Availability Availability, const FString& Activity)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::SetPresence, Prefix::Presence,
 		FString::Printf(TEXT("availability: %d\nactivity: %s\n"), (int)Availability, *Activity));
@@ -399,7 +484,7 @@ FString Lobby::SendSetPresenceStatus(const Availability Availability, const FStr
 
 FString Lobby::SendGetOnlineUsersRequest()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::FriendsPresence, Prefix::Presence);
 }
@@ -409,7 +494,7 @@ FString Lobby::SendGetOnlineUsersRequest()
 //-------------------------------------------------------------------------------------------------
 void Lobby::GetAllAsyncNotification()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (WebSocket.IsValid() && WebSocket->IsConnected())
 	{
@@ -424,7 +509,7 @@ void Lobby::GetAllAsyncNotification()
 //-------------------------------------------------------------------------------------------------
 FString Lobby::SendStartMatchmaking(FString GameMode, FString ServerName, FString ClientVersion, TArray<TPair<FString, float>> Latencies, TMap<FString, FString> PartyAttributes, TArray<FString> TempPartyUserIds, TArray<FString> ExtraAttributes)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	FString Contents = FString::Printf(TEXT("gameMode: %s\n"), *GameMode);
 	if (!ServerName.IsEmpty())
 	{
@@ -523,26 +608,42 @@ FString Lobby::SendStartMatchmaking(FString GameMode, TMap<FString, FString> Par
 
 FString Lobby::SendCancelMatchmaking(FString GameMode, bool IsTempParty)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::CancelMatchmaking, Prefix::Matchmaking,
 		FString::Printf(TEXT("gameMode: %s\nisTempParty: %s"), *GameMode, (IsTempParty ? TEXT("true") : TEXT("false"))));
 }
 
+FString Lobby::SendCancelMatchmaking(FString GameMode, bool IsTempParty, const FMatchmakingResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds)
+{
+	ACCELBYTE_LOG_FUNCTION();
+
+	return SendRequest<FAccelByteModelsMatchmakingResponse>(LobbyRequest::CancelMatchmaking, Prefix::Matchmaking,
+		FString::Printf(TEXT("gameMode: %s\nisTempParty: %s"), *GameMode, (IsTempParty ? TEXT("true") : TEXT("false"))), OnResponse, OnError, TimeoutSeconds);
+}
+
 FString Lobby::SendReadyConsentRequest(FString MatchId)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::ReadyConsent, Prefix::Matchmaking,
 		FString::Printf(TEXT("matchId: %s\n"), *MatchId));
 }
 
+FString Lobby::SendReadyConsentRequest(FString MatchId, const FReadyConsentResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds)
+{
+	ACCELBYTE_LOG_FUNCTION();
+
+	return SendRequest<FAccelByteModelsReadyConsentRequest>(LobbyRequest::ReadyConsent, Prefix::Matchmaking,
+		FString::Printf(TEXT("matchId: %s\n"), *MatchId), OnResponse, OnError, TimeoutSeconds);
+}
+
 //-------------------------------------------------------------------------------------------------
 // Friends
 //-------------------------------------------------------------------------------------------------
 void Lobby::RequestFriend(FString UserId)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	SendRawRequest(LobbyRequest::RequestFriend, Prefix::Friends,
 		FString::Printf(TEXT("friendId: %s"), *UserId));
@@ -550,7 +651,7 @@ void Lobby::RequestFriend(FString UserId)
 
 void Lobby::Unfriend(FString UserId)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	SendRawRequest(LobbyRequest::Unfriend, Prefix::Friends,
 		FString::Printf(TEXT("friendId: %s"), *UserId));
@@ -558,14 +659,14 @@ void Lobby::Unfriend(FString UserId)
 
 void Lobby::ListOutgoingFriends()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	SendRawRequest(LobbyRequest::ListOutgoingFriends, Prefix::Friends);
 }
 
 void Lobby::CancelFriendRequest(FString UserId)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	SendRawRequest(LobbyRequest::CancelFriends, Prefix::Friends,
 		FString::Printf(TEXT("friendId: %s"), *UserId));
@@ -573,14 +674,14 @@ void Lobby::CancelFriendRequest(FString UserId)
 
 void Lobby::ListIncomingFriends()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	SendRawRequest(LobbyRequest::ListIncomingFriends, Prefix::Friends);
 }
 
 void Lobby::AcceptFriend(FString UserId)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	SendRawRequest(LobbyRequest::AcceptFriends, Prefix::Friends,
 		FString::Printf(TEXT("friendId: %s"), *UserId));
@@ -588,7 +689,7 @@ void Lobby::AcceptFriend(FString UserId)
 
 void Lobby::RejectFriend(FString UserId)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	SendRawRequest(LobbyRequest::RejectFriends, Prefix::Friends,
 		FString::Printf(TEXT("friendId: %s"), *UserId));
@@ -596,14 +697,14 @@ void Lobby::RejectFriend(FString UserId)
 
 void Lobby::LoadFriendsList()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	SendRawRequest(LobbyRequest::LoadFriendList, Prefix::Friends);
 }
 
 void Lobby::GetFriendshipStatus(FString UserId)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	SendRawRequest(LobbyRequest::GetFriendshipStatus, Prefix::Friends,
 		FString::Printf(TEXT("friendId: %s"), *UserId));
@@ -611,198 +712,119 @@ void Lobby::GetFriendshipStatus(FString UserId)
 
 void Lobby::BulkFriendRequest(FAccelByteModelsBulkFriendsRequest UserIds, FVoidHandler OnSuccess, FErrorHandler OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/friends/namespaces/%s/users/%s/add/bulk"), *Settings.BaseUrl, *Credentials.GetNamespace(), *Credentials.GetUserId());
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Contents;
-	FJsonObjectConverter::UStructToJsonObjectString(UserIds, Contents);
+	FString Content;
+	FJsonObjectConverter::UStructToJsonObjectString(UserIds, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Contents);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(BulkFriendRequestEndpoint, Settings.BaseUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Lobby::GetPartyData(const FString& PartyId, const THandler<FAccelByteModelsPartyData>& OnSuccess, const FErrorHandler& OnError) const
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	const FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	const FString Url = FString::Printf(TEXT("%s/lobby/v1/public/party/namespaces/%s/parties/%s"), *Settings.BaseUrl, *Credentials.GetNamespace(), *PartyId);
-	const FString Verb = TEXT("GET");
-	const FString Accept = TEXT("application/json");
+	FHttpRequestBuilder Request(GetPartyDataEndpoint, Settings.BaseUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("partyId"), PartyId)
+		.Authorization(Credentials.GetAuthorization());
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Lobby::BulkGetUserPresence(const TArray<FString>& UserIds, const THandler<FAccelByteModelsBulkUserStatusNotif>& OnSuccess, const FErrorHandler& OnError, bool CountOnly)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Query = TEXT("?userIds=");
-	for (int i = 0; i < UserIds.Num(); i++)
-	{
-		Query.Append(FString::Printf(TEXT("%s"), *FGenericPlatformHttp::UrlEncode(UserIds[i])));
-		if (i < UserIds.Num() - 1)
-		{
-			Query.Append(TEXT(","));
-		}
-	}
+	ACCELBYTE_LOG_FUNCTION();
 
-	Query.Append(FString::Printf(TEXT("&countOnly=%s"), CountOnly ? TEXT("true") : TEXT("false")));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/lobby/v1/public/presence/namespaces/%s/users/presence%s"), *Settings.BaseUrl, *Credentials.GetNamespace(), *Query);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(BulkGetUserPresenceEndpoint, Settings.BaseUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Query(TEXT("userIds"), UserIds)
+		.Query(TEXT("countOnly"), CountOnly)
+		.Authorization(Credentials.GetAuthorization());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), FHttpRetryPolicy::LatencySensitive());
 }
 
 void Lobby::GetPartyStorage(const FString & PartyId, const THandler<FAccelByteModelsPartyDataNotif>& OnSuccess, const FErrorHandler & OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/lobby/v1/public/party/namespaces/%s/parties/%s"), *Settings.BaseUrl, *Credentials.GetNamespace(), *PartyId);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FHttpRequestBuilder Request(GetPartyDataEndpoint, Settings.BaseUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("partyId"), PartyId)
+		.Authorization(Credentials.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Lobby::GetListOfBlockedUsers(const FString& UserId, const THandler<FAccelByteModelsListBlockedUserResponse> OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/lobby/v1/public/player/namespaces/%s/users/%s/blocked"), *Settings.BaseUrl, *Credentials.GetNamespace(), *UserId);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
+	FHttpRequestBuilder Request(GetListOfBlockedUsersEndpoint, Settings.BaseUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Authorization(Credentials.GetAuthorization());
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Lobby::GetListOfBlockedUsers(const THandler<FAccelByteModelsListBlockedUserResponse> OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/lobby/v1/public/player/namespaces/%s/users/me/blocked"), *Settings.BaseUrl, *Credentials.GetNamespace());
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FHttpRequestBuilder Request(GetListOfBlockedUsersEndpoint, Settings.BaseUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), TEXT("me"))
+		.Authorization(Credentials.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 
 }
 
 void Lobby::GetListOfBlockers(const FString& UserId, const THandler<FAccelByteModelsListBlockerResponse> OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/lobby/v1/public/player/namespaces/%s/users/%s/blocked-by"), *Settings.BaseUrl, *Credentials.GetNamespace(), *UserId);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
+	FHttpRequestBuilder Request(GetListOfBlockersEndpoint, Settings.BaseUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Authorization(Credentials.GetAuthorization());
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Lobby::GetListOfBlockers(const THandler<FAccelByteModelsListBlockerResponse> OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/lobby/v1/public/player/namespaces/%s/users/me/blocked-by"), *Settings.BaseUrl, *Credentials.GetNamespace());
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FHttpRequestBuilder Request(GetListOfBlockersEndpoint, Settings.BaseUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), TEXT("me"))
+		.Authorization(Credentials.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Lobby::SendNotificationToUser(const FString& SendToUserId, const FAccelByteModelsFreeFormNotificationRequest& Message, bool bAsync, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/notification/namespaces/%s/users/%s/freeform?async=%s"), *Settings.BaseUrl, *Credentials.GetNamespace(), *SendToUserId, bAsync ? TEXT("true") : TEXT("false"));
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
-
 	FJsonObjectConverter::UStructToJsonObjectString(Message, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(SendNotificationToUserEndpoint, Settings.BaseUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("userId"), SendToUserId)
+		.Query(TEXT("async"), bAsync)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void Lobby::WritePartyStorage(const FString & PartyId, TFunction<FJsonObjectWrapper(FJsonObjectWrapper)> PayloadModifier, const THandler<FAccelByteModelsPartyDataNotif>& OnSuccess, const FErrorHandler & OnError, uint32 RetryAttempt)
@@ -822,7 +844,7 @@ void Lobby::WritePartyStorage(const FString & PartyId, TFunction<FJsonObjectWrap
 
 void Lobby::BlockPlayer(const FString& UserId)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	SendRawRequest(LobbyRequest::BlockPlayer, Prefix::Block,
 		FString::Printf(TEXT("userId: %s\nblockedUserId: %s\nnamespace: %s"), *Credentials.GetUserId(), *UserId, *Credentials.GetNamespace()));
@@ -830,7 +852,7 @@ void Lobby::BlockPlayer(const FString& UserId)
 
 void Lobby::UnblockPlayer(const FString& UserId)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	SendRawRequest(LobbyRequest::UnblockPlayer, Prefix::Friends,
 		FString::Printf(TEXT("userId: %s\nunblockedUserId: %s\nnamespace: %s"), *Credentials.GetUserId(), *UserId, *Credentials.GetNamespace()));
@@ -841,7 +863,7 @@ void Lobby::UnblockPlayer(const FString& UserId)
 //-------------------------------------------------------------------------------------------------
 FString Lobby::SendSignalingMessage(const FString& UserId, const FString& Message) 
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	
 	return SendRawRequest(LobbyRequest::SignalingP2PNotif, Prefix::Signaling,
 		FString::Printf(TEXT("destinationId: %s\nmessage: %s\n"), *UserId, *Message));
@@ -852,7 +874,7 @@ FString Lobby::SendSignalingMessage(const FString& UserId, const FString& Messag
 //-------------------------------------------------------------------------------------------------
 FString Lobby::SetSessionAttribute(const FString& Key, const FString& Value)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::SetSessionAttribute, Prefix::Attribute,
 		FString::Printf(TEXT("namespace: %s\nkey: %s\nvalue: %s"), *Credentials.GetNamespace(), *Key, *Value));
@@ -860,7 +882,7 @@ FString Lobby::SetSessionAttribute(const FString& Key, const FString& Value)
 
 FString Lobby::GetSessionAttribute(const FString& Key)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::GetSessionAttribute, Prefix::Attribute,
 		FString::Printf(TEXT("namespace: %s\nkey: %s"), *Credentials.GetNamespace(), *Key));
@@ -868,7 +890,7 @@ FString Lobby::GetSessionAttribute(const FString& Key)
 
 FString Lobby::GetAllSessionAttribute()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	return SendRawRequest(LobbyRequest::GetAllSessionAttribute, Prefix::Attribute,
 		FString::Printf(TEXT("namespace: %s"), *Credentials.GetNamespace()));
@@ -876,7 +898,7 @@ FString Lobby::GetAllSessionAttribute()
 
 void Lobby::UnbindEvent()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	PartyLeaveNotif.Unbind();
 	PartyInviteNotif.Unbind();
@@ -932,19 +954,312 @@ void Lobby::OnClosed(int32 StatusCode, const FString& Reason, bool WasClean)
 
 FString Lobby::SendRawRequest(FString MessageType, FString MessageIDPrefix, FString CustomPayload)
 {
+	const bool bConnected = WebSocket.IsValid() && WebSocket->IsConnected();
+	// a blip of the connection shouldn't lose the message, it's sent once the lobby is connected again.
+	// the tick is gone once disconnected, nothing would drain the queue then
+	if (!bConnected && (WsState != EWebSocketState::Reconnecting || !LobbyTickDelegateHandle.IsValid()))
+	{
+		return TEXT("");
+	}
+
+	if (!bConnected && OutboundQueue.Num() >= MaxOutboundQueueSize)
+	{
+		OutboundQueueStats.OverflowCount++;
+		UE_LOG(LogAccelByteLobby, Warning, TEXT("Lobby outbound queue is full, %s not sent"), *MessageType);
+		OutboundQueueFull.ExecuteIfBound(MessageType, OutboundQueue.Num());
+		return TEXT("");
+	}
+
+	FString MessageID = GenerateMessageID(MessageIDPrefix);
+	FString Content = FString::Printf(TEXT("type: %s\nid: %s"), *MessageType, *MessageID);
+	if (!CustomPayload.IsEmpty())
+	{
+		Content.Append(FString::Printf(TEXT("\n%s"), *CustomPayload));
+	}
+
+	if (!bConnected)
+	{
+		const double Now = FPlatformTime::Seconds();
+		const float* TTL = OutboundMessageTTLs.Find(MessageType);
+		OutboundQueue.Add({ MessageID, MessageType, MoveTemp(Content), Now, TTL != nullptr && *TTL > 0.f ? Now + *TTL : 0.0 });
+		OutboundQueueStats.QueuedCount++;
+		UE_LOG(LogAccelByteLobby, Display, TEXT("Queued request %s until the lobby is reconnected"), *MessageID);
+		return MessageID;
+	}
+
+	// queued messages go first, the tick may not have drained them yet
+	DrainOutboundQueue();
+
+	if (!SendRateLimited(MessageType, MessageID, Content))
+	{
+		return TEXT("");
+	}
+
+	return MessageID;
+}
+
+namespace
+{
+	const int32 MaxDelayedMessages = 64;
+
+	ELobbyMessageCategory GetMessageCategory(const FString& MessageType)
+	{
+		if (MessageType == LobbyRequest::PersonalChat || MessageType == LobbyRequest::PartyChat || MessageType == LobbyRequest::ChannelChat)
+		{
+			return ELobbyMessageCategory::Chat;
+		}
+		if (MessageType == LobbyRequest::SetPresence)
+		{
+			return ELobbyMessageCategory::Presence;
+		}
+
+		return ELobbyMessageCategory::Other;
+	}
+}
+
+void Lobby::FRateLimiter::Refill(double Now)
+{
+	Tokens = FMath::Min(static_cast<double>(Burst), Tokens + (Now - LastRefillTime) * Rate);
+	LastRefillTime = Now;
+}
+
+bool Lobby::SendRateLimited(const FString& MessageType, const FString& MessageID, const FString& Content)
+{
+	const ELobbyMessageCategory Category = GetMessageCategory(MessageType);
+	FRateLimiter& Limiter = RateLimiters[static_cast<int32>(Category)];
+	const double Now = FPlatformTime::Seconds();
+
+	// messages already waiting go first, so a category keeps its send order
+	if (Limiter.Delayed.Num() == 0)
+	{
+		Limiter.Refill(Now);
+		if (Limiter.Rate <= 0.f || Limiter.Tokens >= 1.0)
+		{
+			Limiter.Tokens -= Limiter.Rate > 0.f ? 1.0 : 0.0;
+			WebSocket->Send(Content);
+			UE_LOG(LogAccelByteLobby, Display, TEXT("Sending request: %s"), *Content);
+			return true;
+		}
+	}
+
+	if (Category == ELobbyMessageCategory::Presence && Limiter.Delayed.Num() > 0)
+	{
+		// only the newest presence matters, the update waiting for a token is replaced and keeps its place
+		FDelayedMessage& Waiting = Limiter.Delayed.Last();
+		Waiting.MessageID = MessageID;
+		Waiting.Content = Content;
+		Limiter.Stats.CoalescedCount++;
+		return true;
+	}
+
+	if (Limiter.Delayed.Num() >= MaxDelayedMessages)
+	{
+		Limiter.Stats.SuppressedCount++;
+		UE_LOG(LogAccelByteLobby, Warning, TEXT("Too many %s requests waiting for the rate limit, %s not sent"), *MessageType, *MessageID);
+		FailPendingRequest(MessageID, static_cast<int32>(ErrorCodes::WebSocketConnectFailed), TEXT("Lobby request rate limited."));
+		return false;
+	}
+
+	Limiter.Delayed.Add({ MessageID, Content, Now });
+	Limiter.Stats.DelayedCount++;
+	ArmRateLimitTimer();
+
+	return true;
+}
+
+void Lobby::SendDelayedMessages()
+{
+	RateLimitTimerHandle.Reset();
+
+	// a reconnecting lobby keeps the delayed messages, the timer tries again
 	if (WebSocket.IsValid() && WebSocket->IsConnected())
 	{
-		FString MessageID = GenerateMessageID(MessageIDPrefix);
-		FString Content = FString::Printf(TEXT("type: %s\nid: %s"), *MessageType, *MessageID);
-		if (!CustomPayload.IsEmpty())
+		const double Now = FPlatformTime::Seconds();
+		for (FRateLimiter& Limiter : RateLimiters)
 		{
-			Content.Append(FString::Printf(TEXT("\n%s"), *CustomPayload));
+			Limiter.Refill(Now);
+
+			int32 SentCount = 0;
+			for (; SentCount < Limiter.Delayed.Num() && (Limiter.Rate <= 0.f || Limiter.Tokens >= 1.0); SentCount++)
+			{
+				const FDelayedMessage& Message = Limiter.Delayed[SentCount];
+				Limiter.Tokens -= Limiter.Rate > 0.f ? 1.0 : 0.0;
+				WebSocket->Send(Message.Content);
+				UE_LOG(LogAccelByteLobby, Display, TEXT("Sending delayed request: %s"), *Message.Content);
+
+				const double Delay = Now - Message.DelayTime;
+				Limiter.Stats.DelayedSentCount++;
+				Limiter.Stats.TotalDelay += Delay;
+				Limiter.Stats.MaxDelay = FMath::Max(Limiter.Stats.MaxDelay, Delay);
+			}
+			Limiter.Delayed.RemoveAt(0, SentCount);
 		}
-		WebSocket->Send(Content);
-		UE_LOG(LogAccelByteLobby, Display, TEXT("Sending request: %s"), *Content);
-		return MessageID;
 	}
-	return TEXT("");
+
+	ArmRateLimitTimer();
+}
+
+void Lobby::ArmRateLimitTimer()
+{
+	double DueTime = 0.0;
+	const double Now = FPlatformTime::Seconds();
+	for (FRateLimiter& Limiter : RateLimiters)
+	{
+		if (Limiter.Delayed.Num() == 0)
+		{
+			continue;
+		}
+
+		Limiter.Refill(Now);
+		const double TokenTime = Limiter.Rate > 0.f ? Now + FMath::Max(1.0 - Limiter.Tokens, 0.0) / Limiter.Rate : Now;
+		DueTime = DueTime > 0.0 ? FMath::Min(DueTime, TokenTime) : TokenTime;
+	}
+
+	if (DueTime <= 0.0)
+	{
+		FRegistry::TimerService.RemoveTimer(RateLimitTimerHandle);
+		return;
+	}
+
+	// not connected, no point waking up before the tick could have reconnected
+	if (!WebSocket.IsValid() || !WebSocket->IsConnected())
+	{
+		DueTime = FMath::Max(DueTime, Now + LobbyTickPeriod);
+	}
+
+	if (RateLimitTimerHandle.IsValid() && FRegistry::TimerService.RescheduleTimer(RateLimitTimerHandle, DueTime))
+	{
+		return;
+	}
+
+	RateLimitTimerHandle = FRegistry::TimerService.AddTimer(DueTime, FSimpleDelegate::CreateRaw(this, &Lobby::SendDelayedMessages));
+}
+
+void Lobby::DropDelayedMessages(int32 ErrorCode, const FString& Reason)
+{
+	FRegistry::TimerService.RemoveTimer(RateLimitTimerHandle);
+
+	TArray<FString> DroppedMessageIDs;
+	for (FRateLimiter& Limiter : RateLimiters)
+	{
+		Limiter.Stats.DroppedCount += Limiter.Delayed.Num();
+		for (const FDelayedMessage& Message : Limiter.Delayed)
+		{
+			DroppedMessageIDs.Add(Message.MessageID);
+		}
+		Limiter.Delayed.Empty();
+	}
+
+	for (const FString& MessageID : DroppedMessageIDs)
+	{
+		FailPendingRequest(MessageID, ErrorCode, Reason);
+	}
+}
+
+void Lobby::FailPendingRequest(const FString& MessageID, int32 ErrorCode, const FString& Reason)
+{
+	FPendingRequest Request;
+	if (PendingRequests.RemoveAndCopyValue(MessageID, Request))
+	{
+		Request.OnError.ExecuteIfBound(ErrorCode, Reason);
+	}
+}
+
+void Lobby::SetRateLimit(ELobbyMessageCategory Category, float MessagesPerSecond, int32 Burst)
+{
+	FRateLimiter& Limiter = RateLimiters[static_cast<int32>(Category)];
+	Limiter.Rate = FMath::Max(MessagesPerSecond, 0.f);
+	Limiter.Burst = FMath::Max(Burst, 1);
+	Limiter.Tokens = Limiter.Burst;
+	Limiter.LastRefillTime = FPlatformTime::Seconds();
+
+	ArmRateLimitTimer();
+}
+
+const FLobbyRateLimitStats& Lobby::GetRateLimitStats(ELobbyMessageCategory Category) const
+{
+	return RateLimiters[static_cast<int32>(Category)].Stats;
+}
+
+void Lobby::DrainOutboundQueue()
+{
+	if (OutboundQueue.Num() == 0 || !WebSocket.IsValid() || !WebSocket->IsConnected())
+	{
+		return;
+	}
+
+	TArray<FOutboundMessage> Messages = MoveTemp(OutboundQueue);
+	OutboundQueue.Reset();
+
+	const double Now = FPlatformTime::Seconds();
+	int32 SentCount = 0;
+	TArray<FString> ExpiredMessageIDs;
+	for (const FOutboundMessage& Message : Messages)
+	{
+		if (Message.ExpireTime > 0.0 && Now > Message.ExpireTime)
+		{
+			OutboundQueueStats.ExpiredCount++;
+			ExpiredMessageIDs.Add(Message.MessageID);
+			continue;
+		}
+
+		if (!SendRateLimited(Message.MessageType, Message.MessageID, Message.Content))
+		{
+			continue;
+		}
+		SentCount++;
+
+		const double QueueTime = Now - Message.QueueTime;
+		OutboundQueueStats.SentCount++;
+		OutboundQueueStats.TotalQueueTime += QueueTime;
+		OutboundQueueStats.MaxQueueTime = FMath::Max(OutboundQueueStats.MaxQueueTime, QueueTime);
+	}
+
+	UE_LOG(LogAccelByteLobby, Display, TEXT("Sent %d queued requests after reconnecting, dropped %d expired ones"), SentCount, ExpiredMessageIDs.Num());
+
+	// a stale request with a callback fails now instead of at its timeout
+	for (const FString& MessageID : ExpiredMessageIDs)
+	{
+		FailPendingRequest(MessageID, static_cast<int32>(ErrorCodes::WebSocketRequestTimeout), TEXT("Lobby request expired while reconnecting."));
+	}
+}
+
+void Lobby::DropOutboundQueue(int64& DropCounter, int32 ErrorCode, const FString& Reason)
+{
+	if (OutboundQueue.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FOutboundMessage> Messages = MoveTemp(OutboundQueue);
+	OutboundQueue.Reset();
+	DropCounter += Messages.Num();
+	UE_LOG(LogAccelByteLobby, Display, TEXT("Dropped %d queued requests: %s"), Messages.Num(), *Reason);
+
+	for (const FOutboundMessage& Message : Messages)
+	{
+		FailPendingRequest(Message.MessageID, ErrorCode, Reason);
+	}
+}
+
+void Lobby::SetMaxOutboundQueueSize(int32 MaxSize)
+{
+	MaxOutboundQueueSize = FMath::Max(MaxSize, 0);
+}
+
+void Lobby::SetOutboundMessageTTL(const FString& MessageType, float Seconds)
+{
+	OutboundMessageTTLs.Add(MessageType, FMath::Max(Seconds, 0.f));
+}
+
+int32 Lobby::GetOutboundQueueSize() const
+{
+	return OutboundQueue.Num();
+}
+
+const FLobbyOutboundQueueStats& Lobby::GetOutboundQueueStats() const
+{
+	return OutboundQueueStats;
 }
 
 bool Lobby::Tick(float DeltaTime)
@@ -1007,6 +1322,7 @@ bool Lobby::Tick(float DeltaTime)
 		{
 			TimeSinceLastPing = FPlatformTime::Seconds();
 			WsState = EWebSocketState::Connected;
+			DrainOutboundQueue();
 		}
 		else if ((WsEvents & EWebSocketEvent::Close) != EWebSocketEvent::None)
 		{
@@ -1018,6 +1334,8 @@ bool Lobby::Tick(float DeltaTime)
 			BackoffDelay = InitialBackoffDelay;
 
 			WsState = EWebSocketState::Closed;
+			DropOutboundQueue(OutboundQueueStats.DisconnectedCount, static_cast<int32>(ErrorCodes::WebSocketConnectFailed), TEXT("Lobby failed to reconnect."));
+			DropDelayedMessages(static_cast<int32>(ErrorCodes::WebSocketConnectFailed), TEXT("Lobby failed to reconnect."));
 		}
 		else if ((FPlatformTime::Seconds() - TimeSinceLastReconnect) >= RandomizedBackoffDelay)
 		{
@@ -1051,7 +1369,127 @@ bool Lobby::Tick(float DeltaTime)
 
 FString Lobby::GenerateMessageID(FString Prefix)
 {
-	return FString::Printf(TEXT("%s-%d"), *Prefix, FMath::RandRange(1000, 9999));
+	// unique for the lifetime of the lobby, responses are matched to their request on it
+	return FString::Printf(TEXT("%s-%llu"), *Prefix, NextMessageID++);
+}
+
+void Lobby::AddPendingRequest(const FString& MessageID, TFunction<void(const FLobbyMessageParser&)>&& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds)
+{
+	PendingRequests.Add(MessageID, { MoveTemp(OnResponse), OnError });
+
+	const double Deadline = FPlatformTime::Seconds() + FMath::Max(TimeoutSeconds, 0.f);
+	PendingRequestDeadlines.HeapPush({ Deadline, MessageID }, [](const FPendingRequestDeadline& A, const FPendingRequestDeadline& B) { return A.Deadline < B.Deadline; });
+	ArmPendingRequestTimer();
+}
+
+bool Lobby::CompletePendingRequest(const FLobbyMessageParser& Message)
+{
+	if (PendingRequests.Num() == 0)
+	{
+		return false;
+	}
+
+	FPendingRequest Request;
+	if (!PendingRequests.RemoveAndCopyValue(Message.GetStringField(TEXT("id")), Request))
+	{
+		return false;
+	}
+
+	Request.OnResponse(Message);
+	return true;
+}
+
+void Lobby::ExpirePendingRequests()
+{
+	PendingRequestTimerHandle.Reset();
+
+	TArray<FPendingRequest> Expired;
+	TSet<FString> ExpiredMessageIDs;
+	const double Now = FPlatformTime::Seconds();
+	while (PendingRequestDeadlines.Num() > 0 && PendingRequestDeadlines.HeapTop().Deadline <= Now)
+	{
+		FPendingRequestDeadline Top;
+		PendingRequestDeadlines.HeapPop(Top, [](const FPendingRequestDeadline& A, const FPendingRequestDeadline& B) { return A.Deadline < B.Deadline; }, false);
+
+		FPendingRequest Request;
+		if (PendingRequests.RemoveAndCopyValue(Top.MessageID, Request))
+		{
+			UE_LOG(LogAccelByteLobby, Display, TEXT("No response to %s"), *Top.MessageID);
+			Expired.Add(MoveTemp(Request));
+			ExpiredMessageIDs.Add(Top.MessageID);
+		}
+	}
+
+	ArmPendingRequestTimer();
+	DropTimedOutMessages(ExpiredMessageIDs);
+
+	// called last, an error handler may send the request again
+	for (const FPendingRequest& Request : Expired)
+	{
+		Request.OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::WebSocketRequestTimeout), ErrorMessages::Default.at(static_cast<int32>(ErrorCodes::WebSocketRequestTimeout)));
+	}
+}
+
+void Lobby::FailPendingRequests(int32 Code, const FString& Message)
+{
+	FRegistry::TimerService.RemoveTimer(PendingRequestTimerHandle);
+	PendingRequestDeadlines.Empty();
+
+	TArray<FPendingRequest> Failed;
+	PendingRequests.GenerateValueArray(Failed);
+	PendingRequests.Empty();
+
+	for (const FPendingRequest& Request : Failed)
+	{
+		Request.OnError.ExecuteIfBound(Code, Message);
+	}
+}
+
+void Lobby::DropTimedOutMessages(const TSet<FString>& MessageIDs)
+{
+	if (MessageIDs.Num() == 0)
+	{
+		return;
+	}
+
+	// the caller was told the request timed out, sending it after a reconnect or a rate limit delay would act on it anyway
+	const int32 DroppedCount = OutboundQueue.RemoveAll([&MessageIDs](const FOutboundMessage& Message)
+	{
+		return MessageIDs.Contains(Message.MessageID);
+	});
+	OutboundQueueStats.ExpiredCount += DroppedCount;
+
+	int32 DelayedDroppedCount = 0;
+	for (FRateLimiter& Limiter : RateLimiters)
+	{
+		const int32 LimiterDroppedCount = Limiter.Delayed.RemoveAll([&MessageIDs](const FDelayedMessage& Message)
+		{
+			return MessageIDs.Contains(Message.MessageID);
+		});
+		Limiter.Stats.DroppedCount += LimiterDroppedCount;
+		DelayedDroppedCount += LimiterDroppedCount;
+	}
+	if (DelayedDroppedCount > 0)
+	{
+		ArmRateLimitTimer();
+	}
+}
+
+void Lobby::ArmPendingRequestTimer()
+{
+	if (PendingRequestDeadlines.Num() == 0)
+	{
+		FRegistry::TimerService.RemoveTimer(PendingRequestTimerHandle);
+		return;
+	}
+
+	const double DueTime = PendingRequestDeadlines.HeapTop().Deadline;
+	if (PendingRequestTimerHandle.IsValid() && FRegistry::TimerService.RescheduleTimer(PendingRequestTimerHandle, DueTime))
+	{
+		return;
+	}
+
+	PendingRequestTimerHandle = FRegistry::TimerService.AddTimer(DueTime, FSimpleDelegate::CreateRaw(this, &Lobby::ExpirePendingRequests));
 }
 
 void Lobby::CreateWebSocket()
@@ -1069,7 +1507,7 @@ void Lobby::CreateWebSocket()
 	}
 
 	TMap<FString, FString> Headers;
-	Headers.Add("Authorization", "Bearer " + Credentials.GetAccessToken());
+	Headers.Add("Authorization", Credentials.GetAuthorizationHeader());
 	Headers.Add("X-Ab-LobbySessionID", LobbySessionId.LobbySessionID);
 	FModuleManager::Get().LoadModuleChecked(FName(TEXT("WebSockets")));
 	WebSocket = FWebSocketsModule::Get().CreateWebSocket(*Settings.LobbyServerUrl, TEXT("wss"), Headers);
@@ -1185,229 +1623,261 @@ FString Lobby::LobbyMessageToJson(FString Message)
 	return Json;
 }
 
-void Lobby::OnMessage(const FString& Message)
+namespace
 {
-	UE_LOG(LogAccelByteLobby, Display, TEXT("Raw Lobby Response\n%s"), *Message);
-	FString ParsedJson = LobbyMessageToJson(Message);
-	UE_LOG(LogAccelByteLobby, Display, TEXT("JSON Version: %s"), *ParsedJson);
-	TSharedPtr<FJsonObject> JsonParsed;
-	TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ParsedJson);
-	if (!FJsonSerializer::Deserialize(JsonReader, JsonParsed))
+	template<typename Model, typename DelegateType>
+	TFunction<void(const FLobbyMessageParser&)> MakeNotifHandler(const FString& MessageType, const DelegateType& Delegate, const FErrorHandler& ParsingError)
 	{
-		UE_LOG(LogAccelByteLobby, Display, TEXT("Failed to Deserialize. Json: %s"), *ParsedJson);
-		return;
+		const bool bIsNotif = MessageType.Contains("Notif");
+		const bool bIsResponse = MessageType.Contains("Response");
+		return [MessageType, &Delegate, &ParsingError, bIsNotif, bIsResponse](const FLobbyMessageParser& Message)
+		{
+			Model Result;
+			if (bIsNotif && Message.Decode(Result))
+			{
+				Delegate.ExecuteIfBound(Result);
+			}
+			else if (bIsResponse)
+			{
+				UE_LOG(LogAccelByteLobby, Display, TEXT("Use MakeResponseHandler to process Type: %s"), *MessageType);
+			}
+			else
+			{
+				ParsingError.ExecuteIfBound(-1, FString::Printf(TEXT("Error cannot parse response %s, Raw: %s"), *MessageType, *Message.GetMessage()));
+			}
+		};
 	}
-	FString lobbyResponseType = JsonParsed->GetStringField("type");
-	int lobbyResponseCode = 0;
-	if (lobbyResponseType.Contains("Response"))
-		lobbyResponseCode = JsonParsed->GetIntegerField("code");
-	UE_LOG(LogAccelByteLobby, Display, TEXT("Type: %s"), *lobbyResponseType);
 
-#define HANDLE_LOBBY_MESSAGE_NOTIF(MessageType, Model, ResponseCallback) \
-if (lobbyResponseType.Equals(MessageType)) \
-{ \
-	Model Result; \
-	bool bSuccess = false; \
-	if(lobbyResponseType.Contains("Notif")) \
-		bSuccess = FJsonObjectConverter::JsonObjectStringToUStruct(ParsedJson, &Result, 0, 0); \
-	if (bSuccess) \
-	{ \
-		ResponseCallback.ExecuteIfBound(Result); \
-	} \
-	else if(lobbyResponseType.Contains("Response")) { \
-		UE_LOG(LogAccelByteLobby, Display, TEXT("Use HANDLE_LOBBY_MESSAGE_RESPONSE to process Type: %s"), *lobbyResponseType); \
-	} \
-	else \
-	{ \
-		ParsingError.ExecuteIfBound(-1, FString::Printf(TEXT("Error cannot parse response %s, Raw: %s"), *MessageType, *ParsedJson)); \
-	} \
-	return; \
-} \
+	template<typename Model, typename DelegateType>
+	TFunction<void(const FLobbyMessageParser&)> MakeResponseHandler(const FString& MessageType, const DelegateType& Delegate, const FErrorHandler& ParsingError)
+	{
+		const bool bIsNotif = MessageType.Contains("Notif");
+		const bool bIsResponse = MessageType.Contains("Response");
+		return [MessageType, &Delegate, &ParsingError, bIsNotif, bIsResponse](const FLobbyMessageParser& Message)
+		{
+			Model Result;
+			bool bSuccess = false;
+			if (bIsResponse)
+			{
+				const int32 Code = Message.GetIntegerField(TEXT("code"));
+				if (Code == 0)
+				{
+					bSuccess = Message.Decode(Result);
+				}
+				else
+				{
+					Result.Code = FString::FromInt(Code);
+					bSuccess = true;
+				}
+			}
+
+			if (bSuccess)
+			{
+				Delegate.ExecuteIfBound(Result);
+			}
+			else if (bIsNotif)
+			{
+				UE_LOG(LogAccelByteLobby, Display, TEXT("Use MakeNotifHandler to process Type: %s"), *MessageType);
+			}
+			else
+			{
+				ParsingError.ExecuteIfBound(-1, FString::Printf(TEXT("Error cannot parse response %s, Raw: %s"), *MessageType, *Message.GetMessage()));
+			}
+		};
+	}
+}
+
+void Lobby::InitMessageHandlers()
+{
+#define ADD_LOBBY_NOTIF_HANDLER(MessageType, Model, ResponseCallback) \
+	MessageHandlers.Add(FName(*MessageType), MakeNotifHandler<Model>(MessageType, ResponseCallback, ParsingError))
+#define ADD_LOBBY_RESPONSE_HANDLER(MessageType, Model, ResponseCallback) \
+	MessageHandlers.Add(FName(*MessageType), MakeResponseHandler<Model>(MessageType, ResponseCallback, ParsingError))
 
 	// NOTIF
 	// Party
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::DisconnectNotif, FAccelByteModelsDisconnectNotif, DisconnectNotif);
-    HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::PartyLeaveNotif, FAccelByteModelsLeavePartyNotice, PartyLeaveNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::PartyInviteNotif, FAccelByteModelsInvitationNotice, PartyInviteNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::PartyGetInvitedNotif, FAccelByteModelsPartyGetInvitedNotice, PartyGetInvitedNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::PartyJoinNotif, FAccelByteModelsPartyJoinNotice, PartyJoinNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::PartyRejectNotif, FAccelByteModelsPartyRejectNotice, PartyRejectNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::PartyKickNotif, FAccelByteModelsGotKickedFromPartyNotice, PartyKickNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::PartyDataUpdateNotif, FAccelByteModelsPartyDataNotif, PartyDataUpdateNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::DisconnectNotif, FAccelByteModelsDisconnectNotif, DisconnectNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::PartyLeaveNotif, FAccelByteModelsLeavePartyNotice, PartyLeaveNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::PartyInviteNotif, FAccelByteModelsInvitationNotice, PartyInviteNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::PartyGetInvitedNotif, FAccelByteModelsPartyGetInvitedNotice, PartyGetInvitedNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::PartyJoinNotif, FAccelByteModelsPartyJoinNotice, PartyJoinNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::PartyRejectNotif, FAccelByteModelsPartyRejectNotice, PartyRejectNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::PartyKickNotif, FAccelByteModelsGotKickedFromPartyNotice, PartyKickNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::PartyDataUpdateNotif, FAccelByteModelsPartyDataNotif, PartyDataUpdateNotif);
 	// Chat
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::PersonalChatNotif, FAccelByteModelsPersonalMessageNotice, PersonalChatNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::PartyChatNotif, FAccelByteModelsPartyMessageNotice, PartyChatNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::ChannelChatNotif, FAccelByteModelsChannelMessageNotice, ChannelChatNotif);
-	if (lobbyResponseType.Equals(LobbyResponse::JoinChannelChat))
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::PersonalChatNotif, FAccelByteModelsPersonalMessageNotice, PersonalChatNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::PartyChatNotif, FAccelByteModelsPartyMessageNotice, PartyChatNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::ChannelChatNotif, FAccelByteModelsChannelMessageNotice, ChannelChatNotif);
+	MessageHandlers.Add(FName(*LobbyResponse::JoinChannelChat), [this](const FLobbyMessageParser& Message)
 	{
 		FAccelByteModelsJoinDefaultChannelResponse Result;
-		bool bParseSuccess = FJsonObjectConverter::JsonObjectStringToUStruct(ParsedJson, &Result, 0, 0);
-		if (bParseSuccess)
+		if (Message.Decode(Result))
 		{
 			ChannelSlug = Result.ChannelSlug;
 			JoinDefaultChannelResponse.ExecuteIfBound(Result);
-			return;
 		}
-	}
+	});
 	// Presence
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::FriendStatusNotif, FAccelByteModelsUsersPresenceNotice, FriendStatusNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::FriendStatusNotif, FAccelByteModelsUsersPresenceNotice, FriendStatusNotif);
 	// Notification
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::MessageNotif, FAccelByteModelsNotificationMessage, MessageNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::MessageNotif, FAccelByteModelsNotificationMessage, MessageNotif);
 	// Matchmaking
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::MatchmakingNotif, FAccelByteModelsMatchmakingNotice, MatchmakingNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::ReadyConsentNotif, FAccelByteModelsReadyConsentNotice, ReadyConsentNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::RematchmakingNotif, FAccelByteModelsRematchmakingNotice, RematchmakingNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::DsNotif, FAccelByteModelsDsNotice, DsNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::MatchmakingNotif, FAccelByteModelsMatchmakingNotice, MatchmakingNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::ReadyConsentNotif, FAccelByteModelsReadyConsentNotice, ReadyConsentNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::RematchmakingNotif, FAccelByteModelsRematchmakingNotice, RematchmakingNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::DsNotif, FAccelByteModelsDsNotice, DsNotif);
 	// Friends + Notification
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::AcceptFriendsNotif, FAccelByteModelsAcceptFriendsNotif, AcceptFriendsNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::RequestFriendsNotif, FAccelByteModelsRequestFriendsNotif, RequestFriendsNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::UnfriendNotif, FAccelByteModelsUnfriendNotif, UnfriendNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::CancelFriendsNotif, FAccelByteModelsCancelFriendsNotif, CancelFriendsNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::RejectFriendsNotif, FAccelByteModelsRejectFriendsNotif, RejectFriendsNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::AcceptFriendsNotif, FAccelByteModelsAcceptFriendsNotif, AcceptFriendsNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::RequestFriendsNotif, FAccelByteModelsRequestFriendsNotif, RequestFriendsNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::UnfriendNotif, FAccelByteModelsUnfriendNotif, UnfriendNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::CancelFriendsNotif, FAccelByteModelsCancelFriendsNotif, CancelFriendsNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::RejectFriendsNotif, FAccelByteModelsRejectFriendsNotif, RejectFriendsNotif);
 	// Block + Notification
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::BlockPlayerNotif, FAccelByteModelsBlockPlayerNotif, BlockPlayerNotif);
-	HANDLE_LOBBY_MESSAGE_NOTIF(LobbyResponse::UnblockPlayerNotif, FAccelByteModelsUnblockPlayerNotif, UnblockPlayerNotif);
-
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::BlockPlayerNotif, FAccelByteModelsBlockPlayerNotif, BlockPlayerNotif);
+	ADD_LOBBY_NOTIF_HANDLER(LobbyResponse::UnblockPlayerNotif, FAccelByteModelsUnblockPlayerNotif, UnblockPlayerNotif);
 	// Error
-	if(lobbyResponseType.Equals(LobbyResponse::ErrorNotif))
+	MessageHandlers.Add(FName(*LobbyResponse::ErrorNotif), [this](const FLobbyMessageParser& Message)
 	{
-		ErrorNotif.ExecuteIfBound(JsonParsed->GetIntegerField(TEXT("code")), JsonParsed->GetStringField(TEXT("message")));
-	}
-		
+		ErrorNotif.ExecuteIfBound(Message.GetIntegerField(TEXT("code")), Message.GetStringField(TEXT("message")));
+	});
 	// Signaling
-	if (lobbyResponseType.Equals(LobbyResponse::SignalingP2PNotif))
+	MessageHandlers.Add(FName(*LobbyResponse::SignalingP2PNotif), [this](const FLobbyMessageParser& Message)
 	{
-		SignalingP2P.ExecuteIfBound(JsonParsed->GetStringField(TEXT("destinationId")), JsonParsed->GetStringField(TEXT("message")));
-		return;
-	}
-
-#undef HANDLE_LOBBY_MESSAGE_NOTIF
-		
-#define HANDLE_LOBBY_MESSAGE_RESPONSE(MessageType, Model, ResponseCallback) \
-if (lobbyResponseType.Equals(MessageType)) \
-{ \
-	Model Result; \
-	bool bSuccess = false; \
-	if(lobbyResponseType.Contains("Response")) {\
-		if(lobbyResponseCode == 0) \
-			bSuccess = FJsonObjectConverter::JsonObjectStringToUStruct(ParsedJson, &Result, 0, 0); \
-		else { \
-			Result.Code = FString::FromInt(lobbyResponseCode); \
-			bSuccess = true; \
-		} \
-	} \
-	if (bSuccess) \
-	{ \
-		ResponseCallback.ExecuteIfBound(Result); \
-	} \
-	else if(lobbyResponseType.Contains("Notif")) { \
-		UE_LOG(LogAccelByteLobby, Display, TEXT("Use HANDLE_LOBBY_MESSAGE_NOTIF to process Type: %s"), *lobbyResponseType); \
-	} \
-	else \
-	{ \
-		ParsingError.ExecuteIfBound(-1, FString::Printf(TEXT("Error cannot parse response %s, Raw: %s"), *MessageType, *ParsedJson)); \
-	} \
-	return; \
-}\
-
-	if(lobbyResponseType.Equals(LobbyResponse::ConnectedNotif))
+		SignalingP2P.ExecuteIfBound(Message.GetStringField(TEXT("destinationId")), Message.GetStringField(TEXT("message")));
+	});
+	MessageHandlers.Add(FName(*LobbyResponse::ConnectedNotif), [this](const FLobbyMessageParser& Message)
 	{
 		FAccelByteModelsLobbySessionId SessionId;
-		bool bSuccess = FJsonObjectConverter::JsonObjectStringToUStruct(ParsedJson, &SessionId, 0, 0);
-		if(bSuccess)
+		if (Message.Decode(SessionId))
 		{
 			LobbySessionId = SessionId;
 		}
-	}
+	});
 
 	// RESPONSE
 	// Party
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::PartyInfo, FAccelByteModelsInfoPartyResponse, PartyInfoResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::PartyCreate, FAccelByteModelsCreatePartyResponse, PartyCreateResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::PartyLeave, FAccelByteModelsLeavePartyResponse, PartyLeaveResponse);
-    HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::PartyInvite, FAccelByteModelsPartyInviteResponse, PartyInviteResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::PartyJoin, FAccelByteModelsPartyJoinReponse, PartyJoinResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::PartyReject, FAccelByteModelsPartyRejectResponse, PartyRejectResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::PartyKick, FAccelByteModelsKickPartyMemberResponse, PartyKickResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::PartyGetCode, FAccelByteModelsPartyGetCodeResponse, PartyGetCodeResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::PartyDeleteCode, FAccelByteModelsPartyDeleteCodeResponse, PartyDeleteCodeResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::PartyJoinViaCode, FAccelByteModelsPartyJoinReponse, PartyJoinViaCodeResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::PartyPromoteLeader, FAccelByteModelsPartyPromoteLeaderResponse, PartyPromoteLeaderResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::PartyInfo, FAccelByteModelsInfoPartyResponse, PartyInfoResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::PartyCreate, FAccelByteModelsCreatePartyResponse, PartyCreateResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::PartyLeave, FAccelByteModelsLeavePartyResponse, PartyLeaveResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::PartyInvite, FAccelByteModelsPartyInviteResponse, PartyInviteResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::PartyJoin, FAccelByteModelsPartyJoinReponse, PartyJoinResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::PartyReject, FAccelByteModelsPartyRejectResponse, PartyRejectResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::PartyKick, FAccelByteModelsKickPartyMemberResponse, PartyKickResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::PartyGetCode, FAccelByteModelsPartyGetCodeResponse, PartyGetCodeResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::PartyDeleteCode, FAccelByteModelsPartyDeleteCodeResponse, PartyDeleteCodeResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::PartyJoinViaCode, FAccelByteModelsPartyJoinReponse, PartyJoinViaCodeResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::PartyPromoteLeader, FAccelByteModelsPartyPromoteLeaderResponse, PartyPromoteLeaderResponse);
 	// Chat
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::PersonalChat, FAccelByteModelsPersonalMessageResponse, PersonalChatResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::PartyChat, FAccelByteModelsPartyMessageResponse, PartyChatResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::ChannelChat, FAccelByteModelsChannelMessageResponse, ChannelChatResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::PersonalChat, FAccelByteModelsPersonalMessageResponse, PersonalChatResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::PartyChat, FAccelByteModelsPartyMessageResponse, PartyChatResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::ChannelChat, FAccelByteModelsChannelMessageResponse, ChannelChatResponse);
 	// Presence
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::SetUserPresence, FAccelByteModelsSetOnlineUsersResponse, SetUserPresenceResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::FriendsPresence, FAccelByteModelsGetOnlineUsersResponse, GetAllFriendsStatusResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::SetUserPresence, FAccelByteModelsSetOnlineUsersResponse, SetUserPresenceResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::FriendsPresence, FAccelByteModelsGetOnlineUsersResponse, GetAllFriendsStatusResponse);
 	// Matchmaking
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::StartMatchmaking, FAccelByteModelsMatchmakingResponse, MatchmakingStartResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::CancelMatchmaking, FAccelByteModelsMatchmakingResponse, MatchmakingCancelResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::ReadyConsentResponse, FAccelByteModelsReadyConsentRequest, ReadyConsentResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::StartMatchmaking, FAccelByteModelsMatchmakingResponse, MatchmakingStartResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::CancelMatchmaking, FAccelByteModelsMatchmakingResponse, MatchmakingCancelResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::ReadyConsentResponse, FAccelByteModelsReadyConsentRequest, ReadyConsentResponse);
 	// Friends
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::RequestFriends, FAccelByteModelsRequestFriendsResponse, RequestFriendsResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::Unfriend, FAccelByteModelsUnfriendResponse, UnfriendResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::ListOutgoingFriends, FAccelByteModelsListOutgoingFriendsResponse, ListOutgoingFriendsResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::CancelFriends, FAccelByteModelsCancelFriendsResponse, CancelFriendsResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::ListIncomingFriends, FAccelByteModelsListIncomingFriendsResponse, ListIncomingFriendsResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::AcceptFriends, FAccelByteModelsAcceptFriendsResponse, AcceptFriendsResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::RejectFriends, FAccelByteModelsRejectFriendsResponse, RejectFriendsResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::LoadFriendList, FAccelByteModelsLoadFriendListResponse, LoadFriendListResponse);
-	if (lobbyResponseType.Equals(LobbyResponse::GetFriendshipStatus))
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::RequestFriends, FAccelByteModelsRequestFriendsResponse, RequestFriendsResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::Unfriend, FAccelByteModelsUnfriendResponse, UnfriendResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::ListOutgoingFriends, FAccelByteModelsListOutgoingFriendsResponse, ListOutgoingFriendsResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::CancelFriends, FAccelByteModelsCancelFriendsResponse, CancelFriendsResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::ListIncomingFriends, FAccelByteModelsListIncomingFriendsResponse, ListIncomingFriendsResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::AcceptFriends, FAccelByteModelsAcceptFriendsResponse, AcceptFriendsResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::RejectFriends, FAccelByteModelsRejectFriendsResponse, RejectFriendsResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::LoadFriendList, FAccelByteModelsLoadFriendListResponse, LoadFriendListResponse);
+	MessageHandlers.Add(FName(*LobbyResponse::GetFriendshipStatus), [this](const FLobbyMessageParser& Message)
 	{
 		FAccelByteModelsGetFriendshipStatusStringResponse StringResult;
-		bool bParseSuccess = FJsonObjectConverter::JsonObjectStringToUStruct(ParsedJson, &StringResult, 0, 0);
-		if (bParseSuccess)
+		if (Message.Decode(StringResult))
 		{
 			FAccelByteModelsGetFriendshipStatusResponse Result;
 			Result.Code = StringResult.Code;
 			Result.friendshipStatus = (ERelationshipStatusCode)FCString::Atoi(*StringResult.friendshipStatus);
 			GetFriendshipStatusResponse.ExecuteIfBound(Result);
-			return;
 		}
-	}
+	});
 	// Block
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::BlockPlayer, FAccelByteModelsBlockPlayerResponse, BlockPlayerResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::UnblockPlayer, FAccelByteModelsUnblockPlayerResponse, UnblockPlayerResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::BlockPlayer, FAccelByteModelsBlockPlayerResponse, BlockPlayerResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::UnblockPlayer, FAccelByteModelsUnblockPlayerResponse, UnblockPlayerResponse);
 	// Session Attribute
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::SessionAttributeSet, FAccelByteModelsSetSessionAttributesResponse, SetSessionAttributeResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::SessionAttributeGet, FAccelByteModelsGetSessionAttributesResponse, GetSessionAttributeResponse);
-	HANDLE_LOBBY_MESSAGE_RESPONSE(LobbyResponse::SessionAttributeGetAll, FAccelByteModelsGetAllSessionAttributesResponse, GetAllSessionAttributeResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::SessionAttributeSet, FAccelByteModelsSetSessionAttributesResponse, SetSessionAttributeResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::SessionAttributeGet, FAccelByteModelsGetSessionAttributesResponse, GetSessionAttributeResponse);
+	ADD_LOBBY_RESPONSE_HANDLER(LobbyResponse::SessionAttributeGetAll, FAccelByteModelsGetAllSessionAttributesResponse, GetAllSessionAttributeResponse);
+
+#undef ADD_LOBBY_NOTIF_HANDLER
+#undef ADD_LOBBY_RESPONSE_HANDLER
+}
+
+void Lobby::SetMessageHandler(const FString& MessageType, const FMessageHandler& Handler)
+{
+	const FName TypeName(*MessageType);
+	if (!Handler.IsBound())
+	{
+		MessageHandlerOverrides.Remove(TypeName);
+		return;
+	}
+
+	MessageHandlerOverrides.Add(TypeName, Handler);
+}
+
+void Lobby::OnMessage(const FString& Message)
+{
+	UE_LOG(LogAccelByteLobby, Display, TEXT("Raw Lobby Response\n%s"), *Message);
+	// fields are decoded straight from the frame into the models, no JSON text or FJsonObject in between
+	const FLobbyMessageParser LobbyMessage(Message);
+	const FString& lobbyResponseType = LobbyMessage.GetType();
+	if (lobbyResponseType.IsEmpty() || lobbyResponseType.Len() >= NAME_SIZE)
+	{
+		UE_LOG(LogAccelByteLobby, Display, TEXT("Failed to parse lobby message type. Raw: %s"), *Message);
+		return;
+	}
+	UE_LOG(LogAccelByteLobby, Display, TEXT("Type: %s"), *lobbyResponseType);
+
+	// a response to a request sent with its own callback only goes to that callback
+	if (CompletePendingRequest(LobbyMessage))
+	{
+		return;
+	}
+
+	// every registered type is already a name, a type that isn't can't have a handler
+	const FName TypeName(*lobbyResponseType, FNAME_Find);
+	if (const FMessageHandler* Override = TypeName.IsNone() ? nullptr : MessageHandlerOverrides.Find(TypeName))
+	{
+		Override->ExecuteIfBound(LobbyMessage);
+		return;
+	}
+	if (const TFunction<void(const FLobbyMessageParser&)>* Handler = TypeName.IsNone() ? nullptr : MessageHandlers.Find(TypeName))
+	{
+		(*Handler)(LobbyMessage);
+		return;
+	}
 
-#undef HANDLE_LOBBY_MESSAGE_RESPONSE
-		
 #ifdef DEBUG_LOBBY_MESSAGE
-	ParsingError.ExecuteIfBound(-1, FString::Printf(TEXT("Warning: Unhandled message %s, Raw: %s"), *lobbyResponseType, *ParsedJson));
+	ParsingError.ExecuteIfBound(-1, FString::Printf(TEXT("Warning: Unhandled message %s, Raw: %s"), *lobbyResponseType, *Message));
 #endif
 }
 
 void Lobby::RequestWritePartyStorage(const FString& PartyId, const FAccelByteModelsPartyDataUpdateRequest& Data, const THandler<FAccelByteModelsPartyDataNotif>& OnSuccess, const FErrorHandler& OnError, FSimpleDelegate OnConflicted)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/lobby/v1/public/party/namespaces/%s/parties/%s/attributes"), *Settings.BaseUrl, *Credentials.GetNamespace(), *PartyId);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Contents = "{\n";
+	FString Content = "{\n";
 	FString CustomAttribute;
 	FJsonObjectConverter::UStructToJsonObjectString(Data.Custom_attribute, CustomAttribute);
 	FString UpdatedAt = FString::Printf(TEXT("\"updatedAt\": %lld"), Data.UpdatedAt);
 	FString CustomString = FString::Printf(TEXT("\"custom_attribute\": %s"), *CustomAttribute);
-	Contents += UpdatedAt;
-	Contents += ",\n";
-	Contents += CustomString;
-	Contents += "}";
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Contents);
+	Content += UpdatedAt;
+	Content += ",\n";
+	Content += CustomString;
+	Content += "}";
+
+	FHttpRequestBuilder Request(WritePartyStorageEndpoint, Settings.BaseUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Path(TEXT("partyId"), PartyId)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
 	FErrorHandler ErrorHandler = AccelByte::FErrorHandler::CreateLambda([OnConflicted](int32 Code, FString Message)
 	{
@@ -1417,7 +1887,7 @@ void Lobby::RequestWritePartyStorage(const FString& PartyId, const FAccelByteMod
 		}
 	});
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, ErrorHandler), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, ErrorHandler), FPlatformTime::Seconds());
 }
 
 void Lobby::WritePartyStorageRecursive(TSharedPtr<PartyStorageWrapper> DataWrapper)
@@ -1451,7 +1921,7 @@ void Lobby::WritePartyStorageRecursive(TSharedPtr<PartyStorageWrapper> DataWrapp
 
 void Lobby::SetRetryParameters(int32 NewTotalTimeout, int32 NewBackoffDelay, int32 NewMaxDelay)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (WebSocket.IsValid())
 	{
@@ -1464,9 +1934,13 @@ void Lobby::SetRetryParameters(int32 NewTotalTimeout, int32 NewBackoffDelay, int
 	Lobby::MaxBackoffDelay = NewMaxDelay;
 }
 
-Lobby::Lobby(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Settings, float PingDelay, float InitialBackoffDelay, float MaxBackoffDelay, float TotalTimeout, TSharedPtr<IWebSocket> WebSocket)
+const float Lobby::DefaultRequestTimeout = 30.f;
+const int32 Lobby::DefaultMaxOutboundQueueSize = 64;
+
+Lobby::Lobby(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Settings, FHttpRetryScheduler& HttpRef, float PingDelay, float InitialBackoffDelay, float MaxBackoffDelay, float TotalTimeout, TSharedPtr<IWebSocket> WebSocket)
 	: Credentials(Credentials)
 	, Settings(Settings)
+	, HttpRef(HttpRef)
 	, PingDelay(PingDelay)
 	, InitialBackoffDelay(InitialBackoffDelay)
 	, MaxBackoffDelay(MaxBackoffDelay)
@@ -1481,10 +1955,24 @@ Lobby::Lobby(const AccelByte::Credentials& Credentials, const AccelByte::Setting
 {
 	LobbyTickDelegate = FTickerDelegate::CreateRaw(this, &Lobby::Tick);
 	LobbyTickDelegateHandle.Reset();
+	InitMessageHandlers();
+
+	// a matchmaking request sent long before the reconnection is likely not wanted anymore
+	OutboundMessageTTLs.Add(LobbyRequest::StartMatchmaking, 10.f);
+	OutboundMessageTTLs.Add(LobbyRequest::CancelMatchmaking, 10.f);
+	OutboundMessageTTLs.Add(LobbyRequest::ReadyConsent, 10.f);
+
+	// below the server rate limits, bursts are spread out instead of getting the client disconnected
+	SetRateLimit(ELobbyMessageCategory::Chat, 5.f, 10);
+	SetRateLimit(ELobbyMessageCategory::Presence, 0.5f, 1);
+	SetRateLimit(ELobbyMessageCategory::Other, 20.f, 40);
 }
 
 Lobby::~Lobby()
 {
+	FRegistry::TimerService.RemoveTimer(PendingRequestTimerHandle);
+	FRegistry::TimerService.RemoveTimer(RateLimitTimerHandle);
+
 	// only disconnect when engine is still valid
 	if(UObjectInitialized())
 	{
@@ -6,6 +6,7 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "JsonUtilities.h"
 #include "Runtime/Core/Public/Misc/Base64.h"
 
@@ -26,53 +27,55 @@ namespace AccelByte
 {
 namespace Api
 {
+namespace
+{
+	constexpr FHttpEndpoint TokenEndpoint(EHttpVerb::Post, TEXT("/v3/oauth/token"));
+	constexpr FHttpEndpoint LegacyTokenEndpoint(EHttpVerb::Post, TEXT("/oauth/token"));
+	constexpr FHttpEndpoint PlatformTokenEndpoint(EHttpVerb::Post, TEXT("/v3/oauth/platforms/{platformId}/token"));
+	constexpr FHttpEndpoint RevokeTokenEndpoint(EHttpVerb::Post, TEXT("/v3/oauth/revoke"));
+
+	const FString FormContentType = TEXT("application/x-www-form-urlencoded");
+}
+
 void Oauth2::GetTokenWithAuthorizationCode(const FString& ClientId, const FString& ClientSecret, const FString& AuthorizationCode, const FString& RedirectUri, const THandler<FOauth2Token>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetVerb(TEXT("POST"));
-	Request->SetURL(FString::Printf(TEXT("%s/v3/oauth/token"), *FRegistry::Settings.IamServerUrl));
-	Request->SetHeader(TEXT("Authorization"), TEXT("Basic " + FBase64::Encode(ClientId + ":" + ClientSecret)));
-	Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/x-www-form-urlencoded"));
-	Request->SetContentAsString(FString::Printf(TEXT("grant_type=authorization_code&code=%s&redirect_uri=%s"), *AuthorizationCode, *RedirectUri));
+	FHttpRequestBuilder Request(TokenEndpoint, FRegistry::Settings.IamServerUrl);
+	Request.Authorization(TEXT("Basic ") + FBase64::Encode(ClientId + ":" + ClientSecret))
+		.ContentType(FormContentType)
+		.Content(FString::Printf(TEXT("grant_type=authorization_code&code=%s&redirect_uri=%s"), *AuthorizationCode, *RedirectUri));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Auth);
 }
 
 void Oauth2::GetTokenWithPasswordCredentials(const FString& ClientId, const FString& ClientSecret, const FString& Username, const FString& Password, const THandler<FOauth2Token>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetVerb(TEXT("POST"));
-	Request->SetURL(FString::Printf(TEXT("%s/oauth/token"), *FRegistry::Settings.IamServerUrl));
-	Request->SetHeader(TEXT("Authorization"), TEXT("Basic " + FBase64::Encode(ClientId + ":" + ClientSecret)));
-	Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/x-www-form-urlencoded"));
+	ACCELBYTE_LOG_FUNCTION();
+
 	const TCHAR Format[] = TEXT("grant_type=password&username=%s&password=%s&device_id=%s");
 	const FString EncodedUsername = FGenericPlatformHttp::UrlEncode(Username);
 	const FString EncodedPassword =  FGenericPlatformHttp::UrlEncode(Password);
 	const FString EncodedDeviceId = FGenericPlatformHttp::UrlEncode(GetDeviceId());
-	Request->SetContentAsString(FString::Printf(Format, *EncodedUsername, *EncodedPassword, *EncodedDeviceId));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(LegacyTokenEndpoint, FRegistry::Settings.IamServerUrl);
+	Request.Authorization(TEXT("Basic ") + FBase64::Encode(ClientId + ":" + ClientSecret))
+		.ContentType(FormContentType)
+		.Content(FString::Printf(Format, *EncodedUsername, *EncodedPassword, *EncodedDeviceId));
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Auth);
 }
 
 void Oauth2::GetTokenWithClientCredentials(const FString& ClientId, const FString& ClientSecret, const THandler<FOauth2Token>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetVerb(TEXT("POST"));
-	Request->SetURL(FString::Printf(TEXT("%s/v3/oauth/token"), *FRegistry::Settings.IamServerUrl));
-	Request->SetHeader(TEXT("Authorization"), TEXT("Basic " + FBase64::Encode(ClientId + ":" + ClientSecret)));
-	Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/x-www-form-urlencoded"));
-	Request->SetContentAsString(FString::Printf(TEXT("grant_type=client_credentials")));
+	FHttpRequestBuilder Request(TokenEndpoint, FRegistry::Settings.IamServerUrl);
+	Request.Authorization(TEXT("Basic ") + FBase64::Encode(ClientId + ":" + ClientSecret))
+		.ContentType(FormContentType)
+		.Content(TEXT("grant_type=client_credentials"));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Auth);
 }
 
 //
@@ -81,66 +84,55 @@ void Oauth2::GetTokenWithClientCredentials(const FString& ClientId, const FStrin
 
 void Oauth2::GetTokenWithDeviceId(const FString& ClientId, const FString& ClientSecret, const THandler<FOauth2Token>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetVerb(TEXT("POST"));
-	Request->SetURL(FString::Printf(TEXT("%s/v3/oauth/platforms/device/token"), *FRegistry::Settings.IamServerUrl));
-	Request->SetHeader(TEXT("Authorization"), TEXT("Basic " + FBase64::Encode(ClientId + ":" + ClientSecret)));
-	Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/x-www-form-urlencoded"));
+	ACCELBYTE_LOG_FUNCTION();
 
-	Request->SetContentAsString(FString::Printf(TEXT("device_id=%s"), *FGenericPlatformHttp::UrlEncode(*GetDeviceId())));
+	FHttpRequestBuilder Request(PlatformTokenEndpoint, FRegistry::Settings.IamServerUrl);
+	Request.Path(TEXT("platformId"), TEXT("device"))
+		.Authorization(TEXT("Basic ") + FBase64::Encode(ClientId + ":" + ClientSecret))
+		.ContentType(FormContentType)
+		.Content(FString::Printf(TEXT("device_id=%s"), *FGenericPlatformHttp::UrlEncode(*GetDeviceId())));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Auth);
 }
 
 void Oauth2::GetTokenWithOtherPlatformToken(const FString& ClientId, const FString& ClientSecret, const FString& PlatformId, const FString& PlatformToken, const THandler<FOauth2Token>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetVerb(TEXT("POST"));
-	Request->SetURL(FString::Printf(TEXT("%s/v3/oauth/platforms/%s/token"), *FRegistry::Settings.IamServerUrl, *PlatformId));
-	Request->SetHeader(TEXT("Authorization"), TEXT("Basic " + FBase64::Encode(ClientId + ":" + ClientSecret)));
-	Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/x-www-form-urlencoded"));
-	Request->SetContentAsString(FString::Printf(TEXT("platform_token=%s"), *FGenericPlatformHttp::UrlEncode(PlatformToken)));
+	FHttpRequestBuilder Request(PlatformTokenEndpoint, FRegistry::Settings.IamServerUrl);
+	Request.Path(TEXT("platformId"), PlatformId)
+		.Authorization(TEXT("Basic ") + FBase64::Encode(ClientId + ":" + ClientSecret))
+		.ContentType(FormContentType)
+		.Content(FString::Printf(TEXT("platform_token=%s"), *FGenericPlatformHttp::UrlEncode(PlatformToken)));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Auth);
 }
 
 void Oauth2::GetTokenWithRefreshToken(const FString& ClientId, const FString& ClientSecret, const FString& RefreshId, const THandler<FOauth2Token>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetVerb(TEXT("POST"));
-	Request->SetURL(FString::Printf(TEXT("%s/v3/oauth/token"), *FRegistry::Settings.IamServerUrl));
-	Request->SetHeader(TEXT("Authorization"), TEXT("Basic " + FBase64::Encode(ClientId + ":" + ClientSecret)));
-	Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/x-www-form-urlencoded"));
-	Request->SetContentAsString(FString::Printf(TEXT("grant_type=refresh_token&refresh_token=%s"), *RefreshId));
+	FHttpRequestBuilder Request(TokenEndpoint, FRegistry::Settings.IamServerUrl);
+	Request.Authorization(TEXT("Basic ") + FBase64::Encode(ClientId + ":" + ClientSecret))
+		.ContentType(FormContentType)
+		.Content(FString::Printf(TEXT("grant_type=refresh_token&refresh_token=%s"), *RefreshId));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Auth);
 }
 
 void Oauth2::RevokeToken(const FString& AccessToken, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetVerb(TEXT("POST"));
-	Request->SetURL(FString::Printf(TEXT("%s/v3/oauth/revoke"), *FRegistry::Settings.IamServerUrl));
-	Request->SetHeader(TEXT("Authorization"), TEXT("Bearer " + AccessToken));
-	Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/x-www-form-urlencoded"));
-	Request->SetContentAsString(FString::Printf(TEXT("token=%s"), *FGenericPlatformHttp::UrlEncode(*AccessToken)));
+	FHttpRequestBuilder Request(RevokeTokenEndpoint, FRegistry::Settings.IamServerUrl);
+	Request.Bearer(AccessToken)
+		.ContentType(FormContentType)
+		.Content(FString::Printf(TEXT("token=%s"), *FGenericPlatformHttp::UrlEncode(*AccessToken)));
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(FVoidHandler::CreateLambda([OnSuccess]() { 
 		FRegistry::Credentials.ForgetAll();
 		OnSuccess.ExecuteIfBound();
-	}), OnError), FPlatformTime::Seconds());
+	}), OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Auth);
 }
 
 } // Namespace Api
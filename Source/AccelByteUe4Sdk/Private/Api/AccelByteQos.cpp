@@ -5,7 +5,6 @@
 #include "Api/AccelByteQos.h"
 #include "Api/AccelByteQosManagerApi.h"
 #include "Modules/ModuleManager.h"
-#include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
 
 namespace AccelByte
@@ -13,7 +12,7 @@ namespace AccelByte
 namespace Api
 {
 
-	Qos::Qos()
+	Qos::Qos(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Settings, FHttpRetryScheduler& HttpRef) : Credentials(Credentials), Settings(Settings), HttpRef(HttpRef)
 	{}
 
 	Qos::~Qos()
@@ -22,7 +21,8 @@ namespace Api
 	void Qos::GetServerLatencies(const THandler<TArray<TPair<FString, float>>>& OnSuccess, const FErrorHandler& OnError)
 	{
 		Latencies.Empty();
-		FRegistry::QosManager.GetQosServers(THandler<FAccelByteModelsQosServerList>::CreateLambda([this, OnSuccess](const FAccelByteModelsQosServerList Result)
+		// QosManager only holds references, a temporary one queries through this client's credentials and scheduler
+		QosManager(Credentials, Settings, HttpRef).GetQosServers(THandler<FAccelByteModelsQosServerList>::CreateLambda([this, OnSuccess](const FAccelByteModelsQosServerList Result)
 		{
 			for (int i=0;i< Result.Servers.Num();i++)
 			{
@@ -6,13 +6,21 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 
 namespace AccelByte
 {
 namespace Api
 {
+namespace
+{
+	constexpr FHttpEndpoint CreateGameSessionEndpoint(EHttpVerb::Post, TEXT("/namespaces/{namespace}/gamesession"));
+	constexpr FHttpEndpoint UpdateGameSessionEndpoint(EHttpVerb::Put, TEXT("/namespaces/{namespace}/gamesession/{sessionId}"));
+	constexpr FHttpEndpoint RemoveGameSessionEndpoint(EHttpVerb::Delete, TEXT("/namespaces/{namespace}/gamesession/{sessionId}"));
+	constexpr FHttpEndpoint GetGameSessionsEndpoint(EHttpVerb::Get, TEXT("/namespaces/{namespace}/gamesession"));
+}
 
-	SessionBrowser::SessionBrowser(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting) : Credentials(Credentials), Settings(Setting)
+	SessionBrowser::SessionBrowser(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting, FHttpRetryScheduler& HttpRef) : Credentials(Credentials), Settings(Setting), HttpRef(HttpRef)
 	{}
 
 	SessionBrowser::~SessionBrowser()
@@ -23,7 +31,7 @@ namespace Api
 	}
 
 	void SessionBrowser::CreateGameSession(const FString& GameMode, const FString& GameMapName, const FString& GameVersion, uint32 BotCount, uint32 MaxPlayer, TSharedPtr<FJsonObject> OtherSettings, const THandler<FAccelByteModelsSessionBrowserData>& OnSuccess, const FErrorHandler& OnError) {
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 
 		if (MaxPlayer == 0)
 		{
@@ -31,13 +39,6 @@ namespace Api
 			return;
 		}
 
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString SessionBrowserServerUrl = GetSessionBrowserUrl();
-		FString Url = FString::Printf(TEXT("%s/namespaces/%s/gamesession"), *SessionBrowserServerUrl, *Credentials.GetNamespace());
-		FString Verb = TEXT("POST");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-
 		FAccelByteModelsSessionBrowserCreateRequest NewGameSession;
 		NewGameSession.Username = Credentials.GetUserDisplayName();
 		NewGameSession.Namespace = Credentials.GetNamespace();
@@ -50,19 +51,17 @@ namespace Api
 		NewGameSession.Game_version = GameVersion;
 		FString Content;
 		FJsonObjectConverter::UStructToJsonObjectString(NewGameSession, Content);
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
-
-		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+
+		FHttpRequestBuilder Request(CreateGameSessionEndpoint, GetSessionBrowserUrl());
+		Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+			.Authorization(Credentials.GetAuthorization())
+			.Content(MoveTemp(Content));
+
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Matchmaking);
 	}
 
 	void SessionBrowser::UpdateGameSession(const FString &SessionId, uint32 MaxPlayer, uint32 CurrentPlayerCount, const THandler<FAccelByteModelsSessionBrowserData>& OnSuccess, const FErrorHandler& OnError) {
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 
 		if (MaxPlayer == 0)
 		{
@@ -75,67 +74,44 @@ namespace Api
 			return;
 		}
 
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString SessionBrowserServerUrl = GetSessionBrowserUrl();
-		FString Url = FString::Printf(TEXT("%s/namespaces/%s/gamesession/%s"), *SessionBrowserServerUrl, *Credentials.GetNamespace(), *SessionId);
-		FString Verb = TEXT("PUT");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-
 		FAccelByteModelsSessionBrowserUpdateRequest NewGameSession;
 		NewGameSession.Game_max_player = MaxPlayer;
 		NewGameSession.Game_current_player = CurrentPlayerCount;
 		FString Content;
 		FJsonObjectConverter::UStructToJsonObjectString(NewGameSession, Content);
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
-
-		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+
+		FHttpRequestBuilder Request(UpdateGameSessionEndpoint, GetSessionBrowserUrl());
+		Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+			.Path(TEXT("sessionId"), SessionId)
+			.Authorization(Credentials.GetAuthorization())
+			.Content(MoveTemp(Content));
+
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Matchmaking);
 	}
 
 	void SessionBrowser::RemoveGameSession(const FString& SessionId, const THandler<FAccelByteModelsSessionBrowserData>& OnSuccess, const FErrorHandler& OnError) {
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString SessionBrowserServerUrl = GetSessionBrowserUrl();
-		FString Url = FString::Printf(TEXT("%s/namespaces/%s/gamesession/%s"), *SessionBrowserServerUrl, *Credentials.GetNamespace(), *SessionId);
-		FString Verb = TEXT("DELETE");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-
-		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+		ACCELBYTE_LOG_FUNCTION();
+
+		FHttpRequestBuilder Request(RemoveGameSessionEndpoint, GetSessionBrowserUrl());
+		Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+			.Path(TEXT("sessionId"), SessionId)
+			.Authorization(Credentials.GetAuthorization());
+
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Matchmaking);
 	}
 
 	void SessionBrowser::GetGameSessions(const FString& SessionType, const FString& GameMode, const THandler<FAccelByteModelsSessionBrowserGetResult>& OnSuccess, const FErrorHandler& OnError, uint32 Offset, uint32 Limit) {
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString SessionBrowserServerUrl = GetSessionBrowserUrl();
-		FString Url = FString::Printf(TEXT("%s/namespaces/%s/gamesession?session_type=%s&game_mode=%s&limit=%d&offset=%d"), *SessionBrowserServerUrl, *Credentials.GetNamespace(), *SessionType, *GameMode, Limit, Offset);
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-
-		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+		ACCELBYTE_LOG_FUNCTION();
+
+		FHttpRequestBuilder Request(GetGameSessionsEndpoint, GetSessionBrowserUrl());
+		Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+			.Query(TEXT("session_type"), SessionType)
+			.Query(TEXT("game_mode"), GameMode)
+			.Query(TEXT("limit"), Limit)
+			.Query(TEXT("offset"), Offset)
+			.Authorization(Credentials.GetAuthorization());
+
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Matchmaking);
 	}
 }
 }
\ No newline at end of file
@@ -6,14 +6,21 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteSettings.h"
 
 namespace AccelByte
 {
 namespace Api
 {
+namespace
+{
+	constexpr FHttpEndpoint CreateUserStatItemsEndpoint(EHttpVerb::Post, TEXT("/v1/public/namespaces/{namespace}/users/{userId}/statitems/bulk"));
+	constexpr FHttpEndpoint GetUserStatItemsEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/users/{userId}/statitems"));
+	constexpr FHttpEndpoint IncrementUserStatItemsEndpoint(EHttpVerb::Put, TEXT("/v1/public/namespaces/{namespace}/users/{userId}/statitems/value/bulk"));
+}
 
-	Statistic::Statistic(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting) : Credentials(Credentials), Settings(Setting)
+	Statistic::Statistic(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting, FHttpRetryScheduler& HttpRef) : Credentials(Credentials), Settings(Setting), HttpRef(HttpRef)
 	{}
 
 	Statistic::~Statistic()
@@ -21,13 +28,8 @@ namespace Api
 
 	void Statistic::CreateUserStatItems(const TArray<FString>& StatCodes, const THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>>& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/statitems/bulk"), *Settings.StatisticServerUrl, *Settings.Namespace, *Credentials.GetUserId());
-		FString Verb = TEXT("POST");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
 		FString Contents = "[";
 		FString Content;
 		FAccelByteModelsBulkStatItemCreate statItemCreate;
@@ -47,63 +49,38 @@ namespace Api
 			}
 		}
 
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Contents);
-		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+		FHttpRequestBuilder Request(CreateUserStatItemsEndpoint, Settings.StatisticServerUrl);
+		Request.Path(TEXT("namespace"), Settings.Namespace)
+			.Path(TEXT("userId"), Credentials.GetUserId())
+			.Authorization(Credentials.GetAuthorization())
+			.Content(Contents);
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void Statistic::GetAllUserStatItems(const THandler<FAccelByteModelsUserStatItemPagingSlicedResult>& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 
 		Statistic::GetUserStatItems({}, {}, OnSuccess, OnError);
 	}
 
 	void Statistic::GetUserStatItems(const TArray<FString>& StatCodes, const TArray<FString>& Tags, const THandler<FAccelByteModelsUserStatItemPagingSlicedResult>& OnSuccess, const FErrorHandler & OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/statitems"), *Settings.StatisticServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId());
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-		FString Content;
-
-		for (int i = 0; i < StatCodes.Num(); i++)
-		{
-			Url.Append((i == 0) ? TEXT("?statCodes=") : TEXT("%2C")).Append(StatCodes[i]);
-		}
-
-		for (int i = 0; i < Tags.Num(); i++)
-		{
-			Url.Append((i == 0) ? TEXT("?tags=") : TEXT("%2C")).Append(Tags[i]);
-		}
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
-		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+		ACCELBYTE_LOG_FUNCTION();
+
+		FHttpRequestBuilder Request(GetUserStatItemsEndpoint, Settings.StatisticServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+			.Path(TEXT("userId"), Credentials.GetUserId())
+			.Query(TEXT("statCodes"), StatCodes)
+			.Query(TEXT("tags"), Tags)
+			.Authorization(Credentials.GetAuthorization());
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void Statistic::IncrementUserStatItems(const TArray<FAccelByteModelsBulkStatItemInc>& Data, const THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>>& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/statitems/value/bulk"), *Settings.StatisticServerUrl, *Credentials.GetNamespace(), *Credentials.GetUserId());
-		FString Verb = TEXT("PUT");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
 		FString Contents = "[";
 		FString Content;
 		for (int i = 0; i < Data.Num(); i++)
@@ -119,14 +96,12 @@ namespace Api
 				Contents += "]";
 			}
 		}
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Contents);
-		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+		FHttpRequestBuilder Request(IncrementUserStatItemsEndpoint, Settings.StatisticServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+			.Path(TEXT("userId"), Credentials.GetUserId())
+			.Authorization(Credentials.GetAuthorization())
+			.Content(Contents);
+		HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), FHttpRetryPolicy::NonIdempotent());
 	}
 
 } // Namespace Api
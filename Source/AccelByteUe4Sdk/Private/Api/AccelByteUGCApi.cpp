@@ -6,6 +6,7 @@
 
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteSettings.h"
 #include "Core/AccelByteUtilities.h"
@@ -14,7 +15,22 @@ namespace AccelByte
 {
 namespace Api
 {
-UGC::UGC(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Settings) : Credentials(Credentials), Settings(Settings)
+namespace
+{
+	constexpr FHttpEndpoint CreateContentEndpoint(EHttpVerb::Post, TEXT("/v1/public/namespaces/{namespace}/users/{userId}/channels/{channelId}/contents/s3"));
+	constexpr FHttpEndpoint ModifyContentEndpoint(EHttpVerb::Put, TEXT("/v1/public/namespaces/{namespace}/users/{userId}/channels/{channelId}/contents/s3/{contentId}"));
+	constexpr FHttpEndpoint DeleteContentEndpoint(EHttpVerb::Delete, TEXT("/v1/public/namespaces/{namespace}/users/{userId}/channels/{channelId}/contents/{contentId}"));
+	constexpr FHttpEndpoint GetContentByContentIdEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/contents/{contentId}"));
+	constexpr FHttpEndpoint GetContentByShareCodeEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/contents/sharecodes/{shareCode}"));
+	constexpr FHttpEndpoint GetContentPreviewEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/contents/{contentId}/preview"));
+	constexpr FHttpEndpoint GetTagsEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/tags"));
+	constexpr FHttpEndpoint GetTypesEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/types"));
+	constexpr FHttpEndpoint CreateChannelEndpoint(EHttpVerb::Post, TEXT("/v1/public/namespaces/{namespace}/users/{userId}/channels"));
+	constexpr FHttpEndpoint GetChannelsEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/users/{userId}/channels"));
+	constexpr FHttpEndpoint DeleteChannelEndpoint(EHttpVerb::Delete, TEXT("/v1/public/namespaces/{namespace}/users/{userId}/channels/{channelId}"));
+}
+
+UGC::UGC(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Settings, FHttpRetryScheduler& HttpRef) : Credentials(Credentials), Settings(Settings), HttpRef(HttpRef)
 {
 }
 	
@@ -23,32 +39,26 @@ UGC::~UGC(){}
 void UGC::CreateContent(const FString& ChannelId, const FAccelByteModelsUGCRequest& CreateRequest,
 						const THandler<FAccelByteModelsUGCResponse>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/channels/%s/contents/s3"), *Settings.UGCServerUrl, *Settings.Namespace, *Credentials.GetUserId(), *ChannelId);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(CreateRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(CreateContentEndpoint, Settings.UGCServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("channelId"), ChannelId)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UGC::CreateContent(const FString& ChannelId, const FString& Name, const FString& Type,
 	const FString& SubType, const TArray<FString>& Tags, const TArray<uint8>& Preview, const FString& FileExtension,
 	const THandler<FAccelByteModelsUGCResponse>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	
 	FAccelByteModelsUGCRequest Req;
 	Req.Name = Name;
@@ -64,32 +74,27 @@ void UGC::CreateContent(const FString& ChannelId, const FString& Name, const FSt
 void UGC::ModifyContent(const FString& ChannelId, const FString& ContentId, const FAccelByteModelsUGCRequest& ModifyRequest,
 	const THandler<FAccelByteModelsUGCResponse>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/channels/%s/contents/s3/%s"), *Settings.UGCServerUrl, *Settings.Namespace, *Credentials.GetUserId(), *ChannelId, *ContentId);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(ModifyRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(ModifyContentEndpoint, Settings.UGCServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("channelId"), ChannelId)
+		.Path(TEXT("contentId"), ContentId)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UGC::ModifyContent(const FString& ChannelId, const FString& ContentId, const FString& Name,
 	const FString& Type, const FString& SubType, const TArray<FString>& Tags, const TArray<uint8>& Preview,
 	const FString& FileExtension, const THandler<FAccelByteModelsUGCResponse>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	
 	FAccelByteModelsUGCRequest Req;
 	Req.Name = Name;
@@ -104,92 +109,54 @@ void UGC::ModifyContent(const FString& ChannelId, const FString& ContentId, cons
 
 void UGC::DeleteContent(const FString& ChannelId, const FString& ContentId,	const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/channels/%s/contents/%s"), *Settings.UGCServerUrl, *Settings.Namespace, *Credentials.GetUserId(), *ChannelId, *ContentId);
-	FString Verb = TEXT("DELETE");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(DeleteContentEndpoint, Settings.UGCServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("channelId"), ChannelId)
+		.Path(TEXT("contentId"), ContentId)
+		.Authorization(Credentials.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UGC::GetContentByContentId(const FString& ContentId,
 								const THandler<FAccelByteModelsUGCContentResponse>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/contents/%s"), *Settings.UGCServerUrl, *Settings.Namespace, *ContentId);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(GetContentByContentIdEndpoint, Settings.UGCServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("contentId"), ContentId)
+		.Authorization(Credentials.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UGC::GetContentByShareCode(const FString& ShareCode,
 	const THandler<FAccelByteModelsUGCContentResponse>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/contents/sharecodes/%s"), *Settings.UGCServerUrl, *Settings.Namespace, *ShareCode);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
+	FHttpRequestBuilder Request(GetContentByShareCodeEndpoint, Settings.UGCServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("shareCode"), ShareCode)
+		.Authorization(Credentials.GetAuthorization());
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UGC::GetContentPreview(const FString& ContentId, const THandler<FAccelByteModelsUGCPreview>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/contents/%s/preview"), *Settings.UGCServerUrl, *Settings.Namespace, *ContentId);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
+	FHttpRequestBuilder Request(GetContentPreviewEndpoint, Settings.UGCServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("contentId"), ContentId)
+		.Authorization(Credentials.GetAuthorization());
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());	
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());	
 }
 
 void UGC::GetContentPreview(const FString& ContentId, const THandler<TArray<uint8>>& OnSuccess,
@@ -207,113 +174,71 @@ void UGC::GetContentPreview(const FString& ContentId, const THandler<TArray<uint
 
 void UGC::GetTags(const THandler<FAccelByteModelsUGCTagsPagingResponse>& OnSuccess, const FErrorHandler& OnError, int32 Limit, int32 Offset)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/tags?limit=%d&offset=%d"), *Settings.UGCServerUrl, *Settings.Namespace, Limit, Offset);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(GetTagsEndpoint, Settings.UGCServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Query(TEXT("limit"), Limit)
+		.Query(TEXT("offset"), Offset)
+		.Authorization(Credentials.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UGC::GetTypes(const THandler<FAccelByteModelsUGCTypesPagingResponse>& OnSuccess, const FErrorHandler& OnError, int32 Limit, int32 Offset)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/types?limit=%d&offset=%d"), *Settings.UGCServerUrl, *Settings.Namespace, Limit, Offset);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(GetTypesEndpoint, Settings.UGCServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Query(TEXT("limit"), Limit)
+		.Query(TEXT("offset"), Offset)
+		.Authorization(Credentials.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UGC::CreateChannel(const FString& ChannelName, const THandler<FAccelByteModelsUGCChannelResponse>& OnSuccess,
 	const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/channels"), *Settings.UGCServerUrl, *Settings.Namespace, *Credentials.GetUserId());
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content = FString::Printf(TEXT("{\"name\": \"%s\"}"), *ChannelName);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(CreateChannelEndpoint, Settings.UGCServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UGC::GetChannels(const THandler<FAccelByteModelsUGCChannelsPagingResponse>& OnSuccess, const FErrorHandler& OnError, int32 Limit, int32 Offset)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/channels?limit=%d&offset=%d"), *Settings.UGCServerUrl, *Settings.Namespace, *Credentials.GetUserId(), Limit, Offset);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(GetChannelsEndpoint, Settings.UGCServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Query(TEXT("limit"), Limit)
+		.Query(TEXT("offset"), Offset)
+		.Authorization(Credentials.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UGC::DeleteChannel(const FString& ChannelId, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/channels/%s"), *Settings.UGCServerUrl, *Settings.Namespace, *Credentials.GetUserId(), *ChannelId);
-	FString Verb = TEXT("DELETE");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(DeleteChannelEndpoint, Settings.UGCServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Path(TEXT("channelId"), ChannelId)
+		.Authorization(Credentials.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 	
 }
@@ -11,6 +11,7 @@
 #include "Models/AccelByteEcommerceModels.h"
 #include "Core/AccelByteHttpListenerExtension.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteEnvironment.h"
 #include "Api/AccelByteOauth2Api.h"
 #include "Runtime/Core/Public/Misc/Base64.h"
@@ -24,8 +25,32 @@ namespace AccelByte
 {
 namespace Api
 {
-
-User::User(AccelByte::Credentials& Credentials, AccelByte::Settings& Setting) : Creds(Credentials), Settings(Setting)
+namespace
+{
+	constexpr FHttpEndpoint RegisterEndpoint(EHttpVerb::Post, TEXT("/v3/public/namespaces/{namespace}/users"));
+	constexpr FHttpEndpoint Registerv2Endpoint(EHttpVerb::Post, TEXT("/v4/public/namespaces/{namespace}/users"));
+	constexpr FHttpEndpoint GetDataEndpoint(EHttpVerb::Get, TEXT("/v3/public/users/me"));
+	constexpr FHttpEndpoint UpdateUserEndpoint(EHttpVerb::Put, TEXT("/v4/public/namespaces/{namespace}/users/me"));
+	constexpr FHttpEndpoint UpdateEmailEndpoint(EHttpVerb::Put, TEXT("/v4/public/namespaces/{namespace}/users/me/email"));
+	constexpr FHttpEndpoint BulkGetUserByOtherPlatformUserIdsEndpoint(EHttpVerb::Post, TEXT("/v3/public/namespaces/{namespace}/platforms/{platformId}/users"));
+	constexpr FHttpEndpoint UpgradeAndVerifyEndpoint(EHttpVerb::Post, TEXT("/v3/public/namespaces/{namespace}/users/me/headless/code/verify"));
+	constexpr FHttpEndpoint UpgradeEndpoint(EHttpVerb::Post, TEXT("/v3/public/namespaces/{namespace}/users/me/headless/verify"));
+	constexpr FHttpEndpoint Upgradev2Endpoint(EHttpVerb::Post, TEXT("/v4/public/namespaces/{namespace}/users/me/headless/verify"));
+	constexpr FHttpEndpoint VerifyEndpoint(EHttpVerb::Post, TEXT("/v3/public/namespaces/{namespace}/users/me/code/verify"));
+	constexpr FHttpEndpoint SendResetPasswordCodeEndpoint(EHttpVerb::Post, TEXT("/v3/public/namespaces/{namespace}/users/forgot"));
+	constexpr FHttpEndpoint ResetPasswordEndpoint(EHttpVerb::Post, TEXT("/v3/public/namespaces/{namespace}/users/reset"));
+	constexpr FHttpEndpoint GetPlatformLinksEndpoint(EHttpVerb::Get, TEXT("/v3/public/namespaces/{namespace}/users/{userId}/platforms"));
+	constexpr FHttpEndpoint LinkOtherPlatformEndpoint(EHttpVerb::Post, TEXT("/v3/public/namespaces/{namespace}/users/me/platforms/{platformId}"));
+	constexpr FHttpEndpoint ForcedLinkOtherPlatformEndpoint(EHttpVerb::Post, TEXT("/v3/public/namespaces/{namespace}/users/{userId}/platforms/link"));
+	constexpr FHttpEndpoint UnlinkOtherPlatformEndpoint(EHttpVerb::Delete, TEXT("/v3/public/namespaces/{namespace}/users/me/platforms/{platformId}"));
+	constexpr FHttpEndpoint SendVerificationCodeEndpoint(EHttpVerb::Post, TEXT("/v3/public/namespaces/{namespace}/users/me/code/request"));
+	constexpr FHttpEndpoint SearchUsersEndpoint(EHttpVerb::Get, TEXT("/v3/public/namespaces/{namespace}/users"));
+	constexpr FHttpEndpoint GetUserByUserIdEndpoint(EHttpVerb::Get, TEXT("/v3/public/namespaces/{namespace}/users/{userId}"));
+	constexpr FHttpEndpoint GetUserByOtherPlatformUserIdEndpoint(EHttpVerb::Get, TEXT("/v3/public/namespaces/{namespace}/platforms/{platformId}/users/{platformUserId}"));
+	constexpr FHttpEndpoint GetCountryFromIPEndpoint(EHttpVerb::Get, TEXT("/v3/location/country"));
+}
+
+User::User(AccelByte::Credentials& Credentials, AccelByte::Settings& Setting, FHttpRetryScheduler& HttpRef) : Creds(Credentials), Settings(Setting), HttpRef(HttpRef)
 {}
 
 User::~User()
@@ -81,16 +106,20 @@ static FString GetPlatformString(EAccelBytePlatformType PlatformType)
 
 void User::LoginWithOtherPlatform(EAccelBytePlatformType PlatformType, const FString& PlatformToken, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (Creds.GetSessionState() == Credentials::ESessionState::Valid)
 	{
 		Creds.ForgetAll();
 	}
-	Oauth2::GetTokenWithOtherPlatformToken(Settings.ClientId, Settings.ClientSecret, GetPlatformString(PlatformType), PlatformToken, THandler<FOauth2Token>::CreateLambda([this, PlatformType, OnSuccess, OnError](const FOauth2Token& Result)
+	Oauth2::GetTokenWithOtherPlatformToken(Settings.ClientId, Settings.ClientSecret, GetPlatformString(PlatformType), PlatformToken, THandler<FOauth2Token>::CreateLambda([WeakCreds = Creds.AsWeak(), OnSuccess](const FOauth2Token& Result)
 	{
-		Creds.SetAuthToken(Result, FPlatformTime::Seconds());
-		OnSuccess.ExecuteIfBound();
+		// the API client of these credentials may have been removed while logging in
+		if (TSharedPtr<Credentials, ESPMode::ThreadSafe> PinnedCreds = WeakCreds.Pin())
+		{
+			PinnedCreds->SetAuthToken(Result, FPlatformTime::Seconds());
+			OnSuccess.ExecuteIfBound();
+		}
 	}), FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage)
 	{
 		OnError.ExecuteIfBound(ErrorCode, ErrorMessage);
@@ -99,7 +128,7 @@ void User::LoginWithOtherPlatform(EAccelBytePlatformType PlatformType, const FSt
 
 void User::LoginWithUsername(const FString& Username, const FString& Password, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	TempUsername = Username;
 	Creds.SetUserEmailAddress(Username);
@@ -107,10 +136,13 @@ void User::LoginWithUsername(const FString& Username, const FString& Password, c
 	{
 		Creds.ForgetAll();
 	}
-	Oauth2::GetTokenWithPasswordCredentials(Settings.ClientId, Settings.ClientSecret, Username, Password, THandler<FOauth2Token>::CreateLambda([this, OnSuccess, OnError](const FOauth2Token& Result)
+	Oauth2::GetTokenWithPasswordCredentials(Settings.ClientId, Settings.ClientSecret, Username, Password, THandler<FOauth2Token>::CreateLambda([WeakCreds = Creds.AsWeak(), OnSuccess](const FOauth2Token& Result)
 	{
-		Creds.SetAuthToken(Result, FPlatformTime::Seconds());
-		OnSuccess.ExecuteIfBound();
+		if (TSharedPtr<Credentials, ESPMode::ThreadSafe> PinnedCreds = WeakCreds.Pin())
+		{
+			PinnedCreds->SetAuthToken(Result, FPlatformTime::Seconds());
+			OnSuccess.ExecuteIfBound();
+		}
 	}), FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage)
 	{
 		OnError.ExecuteIfBound(ErrorCode, ErrorMessage);
@@ -119,16 +151,19 @@ void User::LoginWithUsername(const FString& Username, const FString& Password, c
 
 void User::LoginWithDeviceId(const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (Creds.GetSessionState() == Credentials::ESessionState::Valid)
 	{
 		Creds.ForgetAll();
 	}
-	Oauth2::GetTokenWithDeviceId(Settings.ClientId, Settings.ClientSecret, THandler<FOauth2Token>::CreateLambda([this, OnSuccess, OnError](const FOauth2Token& Result)
+	Oauth2::GetTokenWithDeviceId(Settings.ClientId, Settings.ClientSecret, THandler<FOauth2Token>::CreateLambda([WeakCreds = Creds.AsWeak(), OnSuccess](const FOauth2Token& Result)
 	{
-		Creds.SetAuthToken(Result, FPlatformTime::Seconds());
-		OnSuccess.ExecuteIfBound();
+		if (TSharedPtr<Credentials, ESPMode::ThreadSafe> PinnedCreds = WeakCreds.Pin())
+		{
+			PinnedCreds->SetAuthToken(Result, FPlatformTime::Seconds());
+			OnSuccess.ExecuteIfBound();
+		}
 	}), FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage)
 	{
 		OnError.ExecuteIfBound(ErrorCode, ErrorMessage);
@@ -137,7 +172,7 @@ void User::LoginWithDeviceId(const FVoidHandler& OnSuccess, const FErrorHandler&
 
 void User::LoginWithLauncher(const FVoidHandler& OnSuccess, const FErrorHandler & OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FString AuthorizationCode = Environment::GetEnvironmentVariable(TEXT("JUSTICE_AUTHORIZATION_CODE"), 1000);
 
@@ -146,9 +181,13 @@ void User::LoginWithLauncher(const FVoidHandler& OnSuccess, const FErrorHandler
 		Creds.ForgetAll();
 	}
 
-	Oauth2::GetTokenWithAuthorizationCode(Settings.ClientId, Settings.ClientSecret, AuthorizationCode, Settings.RedirectURI, THandler<FOauth2Token>::CreateLambda([this, OnSuccess, OnError](const FOauth2Token& Result) {
-		Creds.SetAuthToken(Result, FPlatformTime::Seconds());
-		OnSuccess.ExecuteIfBound();
+	Oauth2::GetTokenWithAuthorizationCode(Settings.ClientId, Settings.ClientSecret, AuthorizationCode, Settings.RedirectURI, THandler<FOauth2Token>::CreateLambda([WeakCreds = Creds.AsWeak(), OnSuccess](const FOauth2Token& Result)
+	{
+		if (TSharedPtr<Credentials, ESPMode::ThreadSafe> PinnedCreds = WeakCreds.Pin())
+		{
+			PinnedCreds->SetAuthToken(Result, FPlatformTime::Seconds());
+			OnSuccess.ExecuteIfBound();
+		}
 	}), FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage)
 	{
 		OnError.ExecuteIfBound(ErrorCode, ErrorMessage);
@@ -157,14 +196,14 @@ void User::LoginWithLauncher(const FVoidHandler& OnSuccess, const FErrorHandler
 
 void User::ForgetAllCredentials()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	Creds.ForgetAll();
 }
 
 void User::Register(const FString& Username, const FString& Password, const FString& DisplayName, const FString& Country, const FString& DateOfBirth, const THandler<FRegisterResponse>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FRegisterRequest NewUserRequest;
 	NewUserRequest.DisplayName  = DisplayName;
@@ -174,26 +213,19 @@ void User::Register(const FString& Username, const FString& Password, const FStr
 	NewUserRequest.Country      = Country;
 	NewUserRequest.DateOfBirth  = DateOfBirth;
 
-	FString Url             = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users"), *Settings.IamServerUrl, *Settings.Namespace);
-	FString Verb            = TEXT("POST");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(NewUserRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(RegisterEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::Registerv2(const FString& EmailAddress, const FString& Username, const FString& Password, const FString& DisplayName, const FString& Country, const FString& DateOfBirth, const THandler<FRegisterResponse>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FRegisterRequestv2 NewUserRequest;
 	NewUserRequest.DisplayName = DisplayName;
@@ -204,26 +236,19 @@ void User::Registerv2(const FString& EmailAddress, const FString& Username, cons
 	NewUserRequest.Country = Country;
 	NewUserRequest.DateOfBirth = DateOfBirth;
 
-	FString Url = FString::Printf(TEXT("%s/v4/public/namespaces/%s/users"), *Settings.IamServerUrl, *Settings.Namespace);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(NewUserRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(Registerv2Endpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::Registerv3(const FRegisterRequestv3& RegisterRequest, const THandler<FRegisterResponse>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FRegisterRequestv3 NewUserRequest;
 	NewUserRequest.AcceptedPolicies = RegisterRequest.AcceptedPolicies;
@@ -235,48 +260,29 @@ void User::Registerv3(const FRegisterRequestv3& RegisterRequest, const THandler<
 	NewUserRequest.Country = RegisterRequest.Country;
 	NewUserRequest.DateOfBirth = RegisterRequest.DateOfBirth;
 
-	FString Url = FString::Printf(TEXT("%s/v4/public/namespaces/%s/users"), *Settings.IamServerUrl, *Settings.Namespace);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(NewUserRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(Registerv2Endpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::GetData(const THandler<FAccountUserData>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/v3/public/users/me"), *Settings.IamServerUrl);
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(GetDataEndpoint, Settings.IamServerUrl);
+	Request.Authorization(Creds.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::UpdateUser(FUserUpdateRequest UpdateRequest, const THandler<FAccountUserData>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (!UpdateRequest.EmailAddress.IsEmpty())
 	{
@@ -284,77 +290,54 @@ void User::UpdateUser(FUserUpdateRequest UpdateRequest, const THandler<FAccountU
 		return;
 	}
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v4/public/namespaces/%s/users/me"), *Settings.IamServerUrl, *Settings.Namespace);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(UpdateRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(UpdateUserEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Authorization(Creds.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::UpdateEmail(FUpdateEmailRequest UpdateEmailRequest, const FVoidHandler & OnSuccess, const FErrorHandler & OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v4/public/namespaces/%s/users/me/email"), *Settings.IamServerUrl, *Settings.Namespace);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(UpdateEmailRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(UpdateEmailEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Authorization(Creds.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::BulkGetUserByOtherPlatformUserIds(EAccelBytePlatformType PlatformType, const TArray<FString>& OtherPlatformUserId, const THandler<FBulkPlatformUserIdResponse>& OnSuccess, const FErrorHandler & OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	const FString PlatformString = GetPlatformString(PlatformType);
 	const FBulkPlatformUserIdRequest UserIdRequests{ OtherPlatformUserId };
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v3/public/namespaces/%s/platforms/%s/users"), *Settings.IamServerUrl, *Settings.Namespace, *PlatformString);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(UserIdRequests, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(BulkGetUserByOtherPlatformUserIdsEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("platformId"), PlatformString)
+		.Authorization(Creds.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::SendVerificationCode(const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (Creds.GetUserEmailAddress().IsEmpty())
 	{
@@ -373,7 +356,7 @@ void User::SendVerificationCode(const FVoidHandler& OnSuccess, const FErrorHandl
 
 void User::SendUpdateEmailVerificationCode(const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (Creds.GetUserEmailAddress().IsEmpty())
 	{
@@ -392,7 +375,7 @@ void User::SendUpdateEmailVerificationCode(const FVoidHandler& OnSuccess, const
 
 void User::SendUpgradeVerificationCode(const FString& Username, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FVerificationCodeRequest SendUpgradeVerificationCodeRequest
 	{
@@ -406,24 +389,16 @@ void User::SendUpgradeVerificationCode(const FString& Username, const FVoidHandl
 
 void User::UpgradeAndVerify(const FString& Username, const FString& Password, const FString& VerificationCode, const THandler<FAccountUserData>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users/me/headless/code/verify"), *Settings.IamServerUrl, *Creds.GetNamespace(), *Creds.GetUserId());
-	FString Verb            = TEXT("POST");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content         = FString::Printf(TEXT("{ \"code\": \"%s\", \"emailAddress\": \"%s\", \"password\": \"%s\"}"), *VerificationCode, *Username, *Password);
+	FString Content = FString::Printf(TEXT("{ \"code\": \"%s\", \"emailAddress\": \"%s\", \"password\": \"%s\"}"), *VerificationCode, *Username, *Password);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(UpgradeAndVerifyEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Creds.GetNamespace())
+		.Authorization(Creds.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(
+	HttpRef.ProcessRequest(
 		Request,
 		CreateHttpResultHandler(
 			THandler<FAccountUserData>::CreateLambda(
@@ -437,24 +412,16 @@ void User::UpgradeAndVerify(const FString& Username, const FString& Password, co
 
 void User::Upgrade(const FString& Username, const FString& Password, const THandler<FAccountUserData>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users/me/headless/verify"), *Settings.IamServerUrl, *Creds.GetNamespace());
-	FString Verb            = TEXT("POST");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content         = FString::Printf(TEXT("{ \"EmailAddress\": \"%s\", \"Password\": \"%s\"}"), *Username, *Password);
+	FString Content = FString::Printf(TEXT("{ \"EmailAddress\": \"%s\", \"Password\": \"%s\"}"), *Username, *Password);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(UpgradeEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Creds.GetNamespace())
+		.Authorization(Creds.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(
+	HttpRef.ProcessRequest(
 		Request,
 		CreateHttpResultHandler(
 			THandler<FAccountUserData>::CreateLambda(
@@ -468,24 +435,16 @@ void User::Upgrade(const FString& Username, const FString& Password, const THand
 
 void User::Upgradev2(const FString& EmailAddress, const FString& Username, const FString& Password, const THandler<FAccountUserData>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v4/public/namespaces/%s/users/me/headless/verify"), *Settings.IamServerUrl, *Creds.GetNamespace());
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content = FString::Printf(TEXT("{ \"emailAddress\": \"%s\", \"password\": \"%s\", \"username\": \"%s\"}"), *EmailAddress, *Password, *Username);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(Upgradev2Endpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Creds.GetNamespace())
+		.Authorization(Creds.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(
+	HttpRef.ProcessRequest(
 		Request,
 		CreateHttpResultHandler(
 			THandler<FAccountUserData>::CreateLambda(
@@ -499,121 +458,83 @@ void User::Upgradev2(const FString& EmailAddress, const FString& Username, const
 
 void User::Verify(const FString& VerificationCode, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FString ContactType     = TEXT("email");
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users/me/code/verify"), *Settings.IamServerUrl, *Settings.Namespace);
-	FString Verb            = TEXT("POST");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content         = FString::Printf(TEXT("{ \"Code\": \"%s\",\"ContactType\":\"%s\"}"), *VerificationCode, *ContactType);
+	FString Content = FString::Printf(TEXT("{ \"Code\": \"%s\",\"ContactType\":\"%s\"}"), *VerificationCode, *ContactType);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(VerifyEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Authorization(Creds.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::SendResetPasswordCode(const FString& Username, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Url             = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users/forgot"), *Settings.IamServerUrl, *Settings.Namespace);
-	FString Verb            = TEXT("POST");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content         = FString::Printf(TEXT("{\"emailAddress\": \"%s\"}"), *Username);
+	FString Content = FString::Printf(TEXT("{\"emailAddress\": \"%s\"}"), *Username);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(SendResetPasswordCodeEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::ResetPassword(const FString& VerificationCode, const FString& Username, const FString& NewPassword, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FResetPasswordRequest ResetPasswordRequest;
 	ResetPasswordRequest.Code           = VerificationCode;
 	ResetPasswordRequest.EmailAddress   = Username;
 	ResetPasswordRequest.NewPassword    = NewPassword;
-	FString Url             = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users/reset"), *Settings.IamServerUrl, *Settings.Namespace);
-	FString Verb            = TEXT("POST");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(ResetPasswordRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(ResetPasswordEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::GetPlatformLinks(const THandler<FPagedPlatformLinks>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users/%s/platforms"), *Settings.IamServerUrl, *Creds.GetNamespace(), *Creds.GetUserId());
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content;
+	FHttpRequestBuilder Request(GetPlatformLinksEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Creds.GetNamespace())
+		.Path(TEXT("userId"), Creds.GetUserId())
+		.Authorization(Creds.GetAuthorization());
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::LinkOtherPlatform(EAccelBytePlatformType PlatformType, const FString& Ticket, const FVoidHandler& OnSuccess, const FCustomErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	auto PlatformId = GetPlatformString(PlatformType);
 
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users/me/platforms/%s"), *Settings.IamServerUrl, *Creds.GetNamespace(), *PlatformId);
-	FString Verb            = TEXT("POST");
-	FString ContentType     = TEXT("application/x-www-form-urlencoded");
-	FString Accept          = TEXT("application/json");
-	FString Content         = FString::Printf(TEXT("ticket=%s"), *FGenericPlatformHttp::UrlEncode(*Ticket));
+	FString Content = FString::Printf(TEXT("ticket=%s"), *FGenericPlatformHttp::UrlEncode(*Ticket));
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(LinkOtherPlatformEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Creds.GetNamespace())
+		.Path(TEXT("platformId"), PlatformId)
+		.Authorization(Creds.GetAuthorization())
+		.ContentType(TEXT("application/x-www-form-urlencoded"))
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::ForcedLinkOtherPlatform(EAccelBytePlatformType PlatformType, const FString& PlatformUserId, const FVoidHandler& OnSuccess, const FCustomErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	auto PlatformId = GetPlatformString(PlatformType);
 
@@ -621,103 +542,61 @@ void User::ForcedLinkOtherPlatform(EAccelBytePlatformType PlatformType, const FS
 	linkRequest.PlatformId = PlatformId;
 	linkRequest.PlatformUserId = PlatformUserId;
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users/%s/platforms/link"), *Settings.IamServerUrl, *Creds.GetNamespace(), *Creds.GetUserId());
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content = TEXT("");
+	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(linkRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(ForcedLinkOtherPlatformEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Creds.GetNamespace())
+		.Path(TEXT("userId"), Creds.GetUserId())
+		.Authorization(Creds.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::UnlinkOtherPlatform(EAccelBytePlatformType PlatformType, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	auto PlatformId = GetPlatformString(PlatformType);
 
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users/me/platforms/%s"), *Settings.IamServerUrl, *Creds.GetNamespace(), *PlatformId);
-	FString Verb            = TEXT("DELETE");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(UnlinkOtherPlatformEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Creds.GetNamespace())
+		.Path(TEXT("platformId"), PlatformId)
+		.Authorization(Creds.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::SendVerificationCode(const FVerificationCodeRequest& VerificationCodeRequest, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization   = TEXT("");
-	FString Namespace       = TEXT("");
-	
-	Authorization = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	Namespace = Creds.GetNamespace();
-	
-	FString Url             = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users/me/code/request"), *Settings.IamServerUrl, *Namespace);
-	FString Verb            = TEXT("POST");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content         = TEXT("");
+	ACCELBYTE_LOG_FUNCTION();
+
+	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(VerificationCodeRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(SendVerificationCodeEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Creds.GetNamespace())
+		.Authorization(Creds.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::SearchUsers(const FString& Query, EAccelByteSearchType By, const THandler<FPagedPublicUsersInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users?query=%s"), *Settings.IamServerUrl, *Creds.GetNamespace(), *FGenericPlatformHttp::UrlEncode(Query));
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content;
+	ACCELBYTE_LOG_FUNCTION();
 
+	FHttpRequestBuilder Request(SearchUsersEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Creds.GetNamespace())
+		.Query(TEXT("query"), FGenericPlatformHttp::UrlEncode(Query))
+		.Authorization(Creds.GetAuthorization());
 	if (By != EAccelByteSearchType::ALL)
 	{
-		FString SearchId = SearchStrings[static_cast<std::underlying_type<EAccelByteSearchType>::type>(By)];
-		Url.Append(FString::Printf(TEXT("&by=%s"), *SearchId));
+		Request.Query(TEXT("by"), SearchStrings[static_cast<std::underlying_type<EAccelByteSearchType>::type>(By)]);
 	}
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::SearchUsers(const FString& Query, const THandler<FPagedPublicUsersInfo>& OnSuccess, const FErrorHandler& OnError)
@@ -727,64 +606,43 @@ void User::SearchUsers(const FString& Query, const THandler<FPagedPublicUsersInf
 
 void User::GetUserByUserId(const FString& UserID, const THandler<FSimpleUserData>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users/%s"), *Settings.IamServerUrl, *Settings.Namespace, *UserID);
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FHttpRequestBuilder Request(GetUserByUserIdEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("userId"), UserID)
+		.Authorization(Creds.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::GetUserByOtherPlatformUserId(EAccelBytePlatformType PlatformType, const FString& OtherPlatformUserId, const THandler<FAccountUserData>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	FString PlatformId      = GetPlatformString(PlatformType);
 
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/v3/public/namespaces/%s/platforms/%s/users/%s"), *Settings.IamServerUrl, *Settings.Namespace, *PlatformId, *OtherPlatformUserId);
-	FString Verb            = TEXT("GET");
-	FString Accept          = TEXT("application/json");
+	FHttpRequestBuilder Request(GetUserByOtherPlatformUserIdEndpoint, Settings.IamServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("platformId"), PlatformId)
+		.Path(TEXT("platformUserId"), OtherPlatformUserId)
+		.Authorization(Creds.GetAuthorization());
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::GetCountryFromIP(const THandler<FCountryInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Creds.GetAccessToken());
-	FString Url             = FString::Printf(TEXT("%s/v3/location/country"), *Settings.IamServerUrl);
-	FString Verb            = TEXT("GET");
-	FString Accept          = TEXT("application/json");
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FHttpRequestBuilder Request(GetCountryFromIPEndpoint, Settings.IamServerUrl);
+	Request.Authorization(Creds.GetAuthorization());
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::GetUserEligibleToPlay(const THandler<bool>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	auto onItemInfoGot = THandler<FAccelByteModelsItemInfo>::CreateLambda([this, OnSuccess, OnError](const FAccelByteModelsItemInfo& itemInfoResult)
 	{
@@ -794,7 +652,7 @@ void User::GetUserEligibleToPlay(const THandler<bool>& OnSuccess, const FErrorHa
 		TArray<FString> appIds;
 		appIds.Init(*Settings.AppId, 1);
 
-		FRegistry::Entitlement.GetUserEntitlementOwnershipAny(itemIds, appIds, skus, THandler<FAccelByteModelsEntitlementOwnership>::CreateLambda([OnSuccess, OnError](FAccelByteModelsEntitlementOwnership ownership)
+		Entitlement(Creds, Settings, HttpRef).GetUserEntitlementOwnershipAny(itemIds, appIds, skus, THandler<FAccelByteModelsEntitlementOwnership>::CreateLambda([OnSuccess, OnError](FAccelByteModelsEntitlementOwnership ownership)
 		{
 			OnSuccess.ExecuteIfBound(ownership.Owned);
 		}), FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMsg)
@@ -803,7 +661,8 @@ void User::GetUserEligibleToPlay(const THandler<bool>& OnSuccess, const FErrorHa
 		}));
 	});
 
-	FRegistry::Item.GetItemByAppId(*Settings.AppId, "", "", onItemInfoGot, FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMsg)
+	// Item and Entitlement only hold references, temporaries keep the calls on this user's credentials and scheduler
+	Item(Creds, Settings, HttpRef).GetItemByAppId(*Settings.AppId, "", "", onItemInfoGot, FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMsg)
 	{
 		OnError.ExecuteIfBound(ErrorCode, ErrorMsg);
 	}));
@@ -8,6 +8,7 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteSettings.h"
 #include "Core/AccelByteUtilities.h"
 
@@ -15,182 +16,128 @@ namespace AccelByte
 {
 namespace Api
 {
-UserProfile::UserProfile(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting) : Credentials(Credentials), Settings(Setting){}
+namespace
+{
+	constexpr FHttpEndpoint GetUserProfileEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/users/me/profiles"));
+	constexpr FHttpEndpoint GetPublicUserProfileInfoEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/users/{userId}/profiles/public"));
+	constexpr FHttpEndpoint BatchGetPublicUserProfileInfosEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/profiles/public"));
+	constexpr FHttpEndpoint GetCustomAttributesEndpoint(EHttpVerb::Get, TEXT("/v1/public/namespaces/{namespace}/users/{userId}/profiles/customAttributes"));
+	constexpr FHttpEndpoint UpdateUserProfileEndpoint(EHttpVerb::Put, TEXT("/v1/public/namespaces/{namespace}/users/me/profiles"));
+	constexpr FHttpEndpoint UpdateCustomAttributesEndpoint(EHttpVerb::Put, TEXT("/v1/public/namespaces/{namespace}/users/{userId}/profiles/customAttributes"));
+	constexpr FHttpEndpoint CreateUserProfileEndpoint(EHttpVerb::Post, TEXT("/v1/public/namespaces/{namespace}/users/me/profiles"));
+}
+
+UserProfile::UserProfile(const AccelByte::Credentials& Credentials, const AccelByte::Settings& Setting, FHttpRetryScheduler& HttpRef) : Credentials(Credentials), Settings(Setting), HttpRef(HttpRef){}
 
 UserProfile::~UserProfile(){}
 
 void UserProfile::GetUserProfile(const THandler<FAccelByteModelsUserProfileInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization	= FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url				= FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/me/profiles"), *Settings.BasicServerUrl, *Settings.Namespace);
-	FString Verb			= TEXT("GET");
-	FString ContentType		= TEXT("application/json");
-	FString Accept			= TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(GetUserProfileEndpoint, Settings.BasicServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Authorization(Credentials.GetAuthorization());
+
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UserProfile::GetPublicUserProfileInfo(FString UserID, const THandler<FAccelByteModelsPublicUserProfileInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization	= FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url				= FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/profiles/public"), *Settings.BasicServerUrl, *Settings.Namespace, *UserID);
-	FString Verb			= TEXT("GET");
-	FString ContentType		= TEXT("application/json");
-	FString Accept			= TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(GetPublicUserProfileInfoEndpoint, Settings.BasicServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("userId"), UserID)
+		.Authorization(Credentials.GetAuthorization());
+
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UserProfile::BatchGetPublicUserProfileInfos(const FString UserIds, const THandler<TArray<FAccelByteModelsPublicUserProfileInfo>>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	const FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/profiles/public"), *Settings.BasicServerUrl, *Credentials.GetNamespace());
-	const FString UrlEncodedUserIds = FGenericPlatformHttp::UrlEncode(UserIds);
-	const FString QueryString = FString::Printf(TEXT("userIds=%s"), *UrlEncodedUserIds);
-	const FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	const FString ContentType = TEXT("application/json");
-	const FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(FString::Printf(TEXT("%s?%s"), *Url, *QueryString));
-	Request->SetVerb(TEXT("GET"));
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(BatchGetPublicUserProfileInfosEndpoint, Settings.BasicServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetNamespace())
+		.Query(TEXT("userIds"), FGenericPlatformHttp::UrlEncode(UserIds))
+		.Authorization(Credentials.GetAuthorization());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UserProfile::GetCustomAttributes(const THandler<FJsonObject>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization	= FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url				= FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/profiles/customAttributes"), *Settings.BasicServerUrl, *Settings.Namespace, *Credentials.GetUserId());
-	FString Verb			= TEXT("GET");
-	FString ContentType		= TEXT("application/json");
-	FString Accept			= TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(GetCustomAttributesEndpoint, Settings.BasicServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Authorization(Credentials.GetAuthorization());
+
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UserProfile::GetPublicCustomAttributes(const FString& UserId, const THandler<FJsonObject>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization	= FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url				= FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/profiles/customAttributes"), *Settings.BasicServerUrl, *Settings.Namespace, *UserId);
-	FString Verb			= TEXT("GET");
-	FString ContentType		= TEXT("application/json");
-	FString Accept			= TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(GetCustomAttributesEndpoint, Settings.BasicServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("userId"), UserId)
+		.Authorization(Credentials.GetAuthorization());
+
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UserProfile::UpdateUserProfile(const FAccelByteModelsUserProfileUpdateRequest& ProfileUpdateRequest, const THandler<FAccelByteModelsUserProfileInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization	= FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url				= FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/me/profiles"), *Settings.BasicServerUrl, *Settings.Namespace);
-	FString Verb			= TEXT("PUT");
-	FString ContentType		= TEXT("application/json");
-	FString Accept			= TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(ProfileUpdateRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(UpdateUserProfileEndpoint, Settings.BasicServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UserProfile::UpdateCustomAttributes(const FJsonObject& CustomAttributesUpdateRequest, const THandler<FJsonObject>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization	= FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url				= FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/profiles/customAttributes"), *Settings.BasicServerUrl, *Settings.Namespace, *Credentials.GetUserId());
-	FString Verb			= TEXT("PUT");
-	FString ContentType		= TEXT("application/json");
-	FString Accept			= TEXT("application/json");
 	FString Content;
 	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>(CustomAttributesUpdateRequest);
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(UpdateCustomAttributesEndpoint, Settings.BasicServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Path(TEXT("userId"), Credentials.GetUserId())
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void UserProfile::CreateUserProfile(const FAccelByteModelsUserProfileCreateRequest& ProfileCreateRequest, const THandler<FAccelByteModelsUserProfileInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization	= FString::Printf(TEXT("Bearer %s"), *Credentials.GetAccessToken());
-	FString Url				= FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/me/profiles"), *Settings.BasicServerUrl, *Settings.Namespace);
-	FString Verb			= TEXT("POST");
-	FString ContentType		= TEXT("application/json");
-	FString Accept			= TEXT("application/json");
 	FString Content;
 	TSharedPtr<FJsonObject> Json = FJsonObjectConverter::UStructToJsonObject(ProfileCreateRequest);
 	FAccelByteUtilities::RemoveEmptyStrings(Json);
 	TSharedRef<TJsonWriter<>> const Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(Json.ToSharedRef(), Writer);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(CreateUserProfileEndpoint, Settings.BasicServerUrl);
+	Request.Path(TEXT("namespace"), Settings.Namespace)
+		.Authorization(Credentials.GetAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	HttpRef.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 } // Namespace Api
@@ -12,7 +12,7 @@ using AccelByte::THandler;
 
 void UAccelByteBlueprintsAchievement::QueryAchievements(const FString& Language, const EAccelByteAchievementListSortBy& SortBy, const FQueryAchievementsSuccess& OnSuccess, const FDErrorHandler& OnError, const int32& Offset = 0, const int32& Limit = 20)
 {
-	FRegistry::Achievement.QueryAchievements(Language, SortBy, THandler<FAccelByteModelsPaginatedPublicAchievement>::CreateLambda([OnSuccess](const FAccelByteModelsPaginatedPublicAchievement& Result)
+	FRegistry::Achievement->QueryAchievements(Language, SortBy, THandler<FAccelByteModelsPaginatedPublicAchievement>::CreateLambda([OnSuccess](const FAccelByteModelsPaginatedPublicAchievement& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}),
@@ -24,7 +24,7 @@ void UAccelByteBlueprintsAchievement::QueryAchievements(const FString& Language,
 
 void UAccelByteBlueprintsAchievement::GetAchievement(const FString& AchievementCode, const FGetAchievementSuccess& OnSuccess, const FDErrorHandler& OnError)
 {
-	FRegistry::Achievement.GetAchievement(AchievementCode, THandler<FAccelByteModelsMultiLanguageAchievement>::CreateLambda([OnSuccess](const FAccelByteModelsMultiLanguageAchievement& Result)
+	FRegistry::Achievement->GetAchievement(AchievementCode, THandler<FAccelByteModelsMultiLanguageAchievement>::CreateLambda([OnSuccess](const FAccelByteModelsMultiLanguageAchievement& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}),
@@ -36,7 +36,7 @@ void UAccelByteBlueprintsAchievement::GetAchievement(const FString& AchievementC
 
 void UAccelByteBlueprintsAchievement::QueryUserAchievements(const EAccelByteAchievementListSortBy& SortBy, const FQueryUserAchievementsSuccess& OnSuccess, const FDErrorHandler& OnError, const int32& Offset = 0, const int32& Limit = 20)
 {
-	FRegistry::Achievement.QueryUserAchievements(SortBy, THandler<FAccelByteModelsPaginatedUserAchievement>::CreateLambda([OnSuccess](const FAccelByteModelsPaginatedUserAchievement& Result)
+	FRegistry::Achievement->QueryUserAchievements(SortBy, THandler<FAccelByteModelsPaginatedUserAchievement>::CreateLambda([OnSuccess](const FAccelByteModelsPaginatedUserAchievement& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}),
@@ -48,7 +48,7 @@ void UAccelByteBlueprintsAchievement::QueryUserAchievements(const EAccelByteAchi
 
 void UAccelByteBlueprintsAchievement::UnlockAchievement(const FString& AchievementCode, const FDHandler& OnSuccess, const FDErrorHandler& OnError)
 {
-	FRegistry::Achievement.UnlockAchievement(AchievementCode, FVoidHandler::CreateLambda([OnSuccess]()
+	FRegistry::Achievement->UnlockAchievement(AchievementCode, FVoidHandler::CreateLambda([OnSuccess]()
 	{
 		OnSuccess.ExecuteIfBound();
 	}),
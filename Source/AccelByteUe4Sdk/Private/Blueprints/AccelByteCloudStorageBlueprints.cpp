@@ -15,7 +15,7 @@ using AccelByte::Settings;
 
 void UAccelByteBlueprintsCloudStorage::GetAllSlots(const FGetAllSlotsSuccess& OnSuccess, const FBlueprintErrorHandler& OnError)
 {
-	FRegistry::CloudStorage.GetAllSlots(THandler<TArray<FAccelByteModelsSlot>>::CreateLambda([OnSuccess](const TArray<FAccelByteModelsSlot>& Slots)
+	FRegistry::CloudStorage->GetAllSlots(THandler<TArray<FAccelByteModelsSlot>>::CreateLambda([OnSuccess](const TArray<FAccelByteModelsSlot>& Slots)
 	{
 		OnSuccess.ExecuteIfBound(Slots);
 	}),
@@ -27,7 +27,7 @@ void UAccelByteBlueprintsCloudStorage::GetAllSlots(const FGetAllSlotsSuccess& On
 
 void UAccelByteBlueprintsCloudStorage::GetSlot(const FString& SlotId, const FGetSlotSuccess& OnSuccess, const FBlueprintErrorHandler& OnError)
 {
-	FRegistry::CloudStorage.GetSlot(SlotId, THandler<TArray<uint8>>::CreateLambda([OnSuccess](const TArray<uint8>& Data)
+	FRegistry::CloudStorage->GetSlot(SlotId, THandler<TArray<uint8>>::CreateLambda([OnSuccess](const TArray<uint8>& Data)
 	{
 		OnSuccess.ExecuteIfBound(Data);
 	}),
@@ -39,7 +39,7 @@ void UAccelByteBlueprintsCloudStorage::GetSlot(const FString& SlotId, const FGet
 
 void UAccelByteBlueprintsCloudStorage::CreateSlot(const TArray<uint8>& Data, const FString& FileName, const TArray<FString>& Tags, const FString& Label, const FString& CustomAttribute, const FCreateSlotsSuccess& OnSuccess, const FBlueprintErrorHandler& OnError)
 {
-	FRegistry::CloudStorage.CreateSlot(Data, FileName, Tags, Label, CustomAttribute, THandler<FAccelByteModelsSlot>::CreateLambda([OnSuccess](const FAccelByteModelsSlot& CreatedSlot)
+	FRegistry::CloudStorage->CreateSlot(Data, FileName, Tags, Label, CustomAttribute, THandler<FAccelByteModelsSlot>::CreateLambda([OnSuccess](const FAccelByteModelsSlot& CreatedSlot)
 	{
 		OnSuccess.ExecuteIfBound(CreatedSlot);
 	}), nullptr, 
@@ -51,7 +51,7 @@ void UAccelByteBlueprintsCloudStorage::CreateSlot(const TArray<uint8>& Data, con
 
 void UAccelByteBlueprintsCloudStorage::UpdateSlot(const FString& SlotId, const FString& FileName, const TArray<uint8>& Data, const TArray<FString>& Tags, const FString& Label, const FString& CustomAttribute, const FUpdateSlotSuccess& OnSuccess, const FBlueprintErrorHandler& OnError)
 {
-	FRegistry::CloudStorage.UpdateSlot(SlotId, Data, FileName, Tags, Label, CustomAttribute, THandler<FAccelByteModelsSlot>::CreateLambda([OnSuccess](const FAccelByteModelsSlot& UpdatedSlot)
+	FRegistry::CloudStorage->UpdateSlot(SlotId, Data, FileName, Tags, Label, CustomAttribute, THandler<FAccelByteModelsSlot>::CreateLambda([OnSuccess](const FAccelByteModelsSlot& UpdatedSlot)
 	{
 		OnSuccess.ExecuteIfBound(UpdatedSlot);
 	}), nullptr,
@@ -63,7 +63,7 @@ void UAccelByteBlueprintsCloudStorage::UpdateSlot(const FString& SlotId, const F
 
 void UAccelByteBlueprintsCloudStorage::UpdateSlotMetadata(const FString& SlotId, const FString& FileName, const TArray<FString>& Tags, const FString& Label, const FString& CustomAttribute, const FUpdateSlotMetadataSuccess& OnSuccess, const FBlueprintErrorHandler& OnError)
 {
-	FRegistry::CloudStorage.UpdateSlotMetadata(SlotId, Tags, Label, CustomAttribute, THandler<FAccelByteModelsSlot>::CreateLambda([OnSuccess](const FAccelByteModelsSlot& UpdatedSlot)
+	FRegistry::CloudStorage->UpdateSlotMetadata(SlotId, Tags, Label, CustomAttribute, THandler<FAccelByteModelsSlot>::CreateLambda([OnSuccess](const FAccelByteModelsSlot& UpdatedSlot)
 	{
 		OnSuccess.ExecuteIfBound(UpdatedSlot);
 	}), nullptr,
@@ -75,7 +75,7 @@ void UAccelByteBlueprintsCloudStorage::UpdateSlotMetadata(const FString& SlotId,
 
 void UAccelByteBlueprintsCloudStorage::DeleteSlot(const FString& SlotId, const FDeleteSlotSuccees& OnSuccess, const FBlueprintErrorHandler& OnError)
 {
-	FRegistry::CloudStorage.DeleteSlot(SlotId, FVoidHandler::CreateLambda([OnSuccess]()
+	FRegistry::CloudStorage->DeleteSlot(SlotId, FVoidHandler::CreateLambda([OnSuccess]()
 	{
 		OnSuccess.ExecuteIfBound();
 	}),
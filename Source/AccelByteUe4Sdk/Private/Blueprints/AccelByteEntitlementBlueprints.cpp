@@ -16,7 +16,7 @@ using AccelByte::Credentials;
 
 void UAccelByteBlueprintsEntitlement::QueryUserEntitlements(const FString & EntitlementName, const FString & ItemId, int32 Page, int32 Size, const FQueryUserEntitlementSuccess& OnSuccess, const FBlueprintErrorHandler& OnError, EAccelByteEntitlementClass EntitlementClass = EAccelByteEntitlementClass::NONE, EAccelByteAppType AppType = EAccelByteAppType::NONE)
 {
-	FRegistry::Entitlement.QueryUserEntitlements(EntitlementName, ItemId, Page, Size, THandler<FAccelByteModelsEntitlementPagingSlicedResult>::CreateLambda([OnSuccess](const FAccelByteModelsEntitlementPagingSlicedResult& Result)
+	FRegistry::Entitlement->QueryUserEntitlements(EntitlementName, ItemId, Page, Size, THandler<FAccelByteModelsEntitlementPagingSlicedResult>::CreateLambda([OnSuccess](const FAccelByteModelsEntitlementPagingSlicedResult& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}), FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage)
@@ -29,7 +29,7 @@ void UAccelByteBlueprintsEntitlement::QueryUserEntitlementsMany(const FString& E
     const TArray<FString>& ItemIds, int32 Page, int32 Size, const FQueryUserEntitlementSuccess& OnSuccess,
     const FBlueprintErrorHandler& OnError, EAccelByteEntitlementClass EntitlementClass, EAccelByteAppType AppType)
 {
-	FRegistry::Entitlement.QueryUserEntitlements(EntitlementName, ItemIds, Page, Size, THandler<FAccelByteModelsEntitlementPagingSlicedResult>::CreateLambda([OnSuccess](const FAccelByteModelsEntitlementPagingSlicedResult& Result)
+	FRegistry::Entitlement->QueryUserEntitlements(EntitlementName, ItemIds, Page, Size, THandler<FAccelByteModelsEntitlementPagingSlicedResult>::CreateLambda([OnSuccess](const FAccelByteModelsEntitlementPagingSlicedResult& Result)
     {
         OnSuccess.ExecuteIfBound(Result);
     }), FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage)
@@ -11,7 +11,7 @@ using AccelByte::FErrorHandler;
 
 void UAccelByteBlueprintsGameProfile::BatchGetPublicGameProfiles(TArray<FString> UserIds, const FBatchGetPublicGameProfilesSuccess& OnSuccess, const FBlueprintErrorHandler& OnError)
 {
-	FRegistry::GameProfile.BatchGetPublicGameProfiles(UserIds, THandler<TArray<FAccelByteModelsPublicGameProfile>>::CreateLambda([OnSuccess](const TArray<FAccelByteModelsPublicGameProfile>& Result)
+	FRegistry::GameProfile->BatchGetPublicGameProfiles(UserIds, THandler<TArray<FAccelByteModelsPublicGameProfile>>::CreateLambda([OnSuccess](const TArray<FAccelByteModelsPublicGameProfile>& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}),
@@ -23,7 +23,7 @@ void UAccelByteBlueprintsGameProfile::BatchGetPublicGameProfiles(TArray<FString>
 
 void UAccelByteBlueprintsGameProfile::GetAllGameProfiles(const FGetAllGameProfilesSuccess & OnSuccess, const FBlueprintErrorHandler & OnError)
 {
-	FRegistry::GameProfile.GetAllGameProfiles(THandler< TArray<FAccelByteModelsGameProfile>>::CreateLambda([OnSuccess](const TArray<FAccelByteModelsGameProfile>& Result)
+	FRegistry::GameProfile->GetAllGameProfiles(THandler< TArray<FAccelByteModelsGameProfile>>::CreateLambda([OnSuccess](const TArray<FAccelByteModelsGameProfile>& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}),
@@ -35,7 +35,7 @@ void UAccelByteBlueprintsGameProfile::GetAllGameProfiles(const FGetAllGameProfil
 
 void UAccelByteBlueprintsGameProfile::CreateGameProfile(const FAccelByteModelsGameProfileRequest & GameProfileRequest, const FCreateGameProfileSuccess & OnSuccess, const FBlueprintErrorHandler & OnError)
 {
-	FRegistry::GameProfile.CreateGameProfile(GameProfileRequest, THandler<FAccelByteModelsGameProfile>::CreateLambda([OnSuccess](const FAccelByteModelsGameProfile& Result)
+	FRegistry::GameProfile->CreateGameProfile(GameProfileRequest, THandler<FAccelByteModelsGameProfile>::CreateLambda([OnSuccess](const FAccelByteModelsGameProfile& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}),
@@ -47,7 +47,7 @@ void UAccelByteBlueprintsGameProfile::CreateGameProfile(const FAccelByteModelsGa
 
 void UAccelByteBlueprintsGameProfile::GetGameProfile(const FString & ProfileId, const FGetGameProfileSuccess & OnSuccess, const FBlueprintErrorHandler & OnError)
 {
-	FRegistry::GameProfile.GetGameProfile(ProfileId, THandler<FAccelByteModelsGameProfile>::CreateLambda([OnSuccess](const FAccelByteModelsGameProfile& Result)
+	FRegistry::GameProfile->GetGameProfile(ProfileId, THandler<FAccelByteModelsGameProfile>::CreateLambda([OnSuccess](const FAccelByteModelsGameProfile& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}),
@@ -59,7 +59,7 @@ void UAccelByteBlueprintsGameProfile::GetGameProfile(const FString & ProfileId,
 
 void UAccelByteBlueprintsGameProfile::UpdateGameProfile(const FString & ProfileId, const FAccelByteModelsGameProfileRequest & GameProfileRequest, const FUpdateGameProfileSuccess & OnSuccess, const FBlueprintErrorHandler & OnError)
 {
-	FRegistry::GameProfile.UpdateGameProfile(ProfileId, GameProfileRequest, THandler<FAccelByteModelsGameProfile>::CreateLambda([OnSuccess](const FAccelByteModelsGameProfile& Result)
+	FRegistry::GameProfile->UpdateGameProfile(ProfileId, GameProfileRequest, THandler<FAccelByteModelsGameProfile>::CreateLambda([OnSuccess](const FAccelByteModelsGameProfile& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}),
@@ -71,7 +71,7 @@ void UAccelByteBlueprintsGameProfile::UpdateGameProfile(const FString & ProfileI
 
 void UAccelByteBlueprintsGameProfile::DeleteGameProfile(const FString & ProfileId, const FDeleteGameProfileSuccess & OnSuccess, const FBlueprintErrorHandler & OnError)
 {
-	FRegistry::GameProfile.DeleteGameProfile(ProfileId, FVoidHandler::CreateLambda([OnSuccess]()
+	FRegistry::GameProfile->DeleteGameProfile(ProfileId, FVoidHandler::CreateLambda([OnSuccess]()
 	{
 		OnSuccess.ExecuteIfBound();
 	}),
@@ -83,7 +83,7 @@ void UAccelByteBlueprintsGameProfile::DeleteGameProfile(const FString & ProfileI
 
 void UAccelByteBlueprintsGameProfile::GetGameProfileAttribute(const FString & ProfileId, const FString & AttributeName, const FGetGameProfileAttributeSuccess & OnSuccess, const FBlueprintErrorHandler & OnError)
 {
-	FRegistry::GameProfile.GetGameProfileAttribute(ProfileId, AttributeName, THandler<FAccelByteModelsGameProfileAttribute>::CreateLambda([OnSuccess](const FAccelByteModelsGameProfileAttribute& Result)
+	FRegistry::GameProfile->GetGameProfileAttribute(ProfileId, AttributeName, THandler<FAccelByteModelsGameProfileAttribute>::CreateLambda([OnSuccess](const FAccelByteModelsGameProfileAttribute& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}),
@@ -95,7 +95,7 @@ void UAccelByteBlueprintsGameProfile::GetGameProfileAttribute(const FString & Pr
 
 void UAccelByteBlueprintsGameProfile::UpdateGameProfileAttribute(const FString & ProfileId, const FAccelByteModelsGameProfileAttribute& Attribute, const FUpdateGameProfileAttributeSuccess & OnSuccess, const FBlueprintErrorHandler & OnError)
 {
-	FRegistry::GameProfile.UpdateGameProfileAttribute(ProfileId, Attribute, THandler<FAccelByteModelsGameProfile>::CreateLambda([OnSuccess](const FAccelByteModelsGameProfile& Result)
+	FRegistry::GameProfile->UpdateGameProfileAttribute(ProfileId, Attribute, THandler<FAccelByteModelsGameProfile>::CreateLambda([OnSuccess](const FAccelByteModelsGameProfile& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}),
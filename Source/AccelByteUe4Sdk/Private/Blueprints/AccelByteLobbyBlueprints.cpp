@@ -10,130 +10,130 @@ using AccelByte::FErrorHandler;
 
 void UAccelByteBlueprintsLobby::Connect()
 {
-	FRegistry::Lobby.Connect();
+	FRegistry::Lobby->Connect();
 }
 
 void UAccelByteBlueprintsLobby::Disconnect()
 {
-	FRegistry::Lobby.Disconnect();
+	FRegistry::Lobby->Disconnect();
 }
 
 bool UAccelByteBlueprintsLobby::IsConnected()
 {
-	return FRegistry::Lobby.IsConnected();
+	return FRegistry::Lobby->IsConnected();
 }
 
 void UAccelByteBlueprintsLobby::SendPing()
 {
-	FRegistry::Lobby.SendPing();
+	FRegistry::Lobby->SendPing();
 }
 
 void UAccelByteBlueprintsLobby::SendPrivateMessage(const FString& UserId, const FString& Message)
 {
-	FRegistry::Lobby.SendPrivateMessage(UserId, Message);
+	FRegistry::Lobby->SendPrivateMessage(UserId, Message);
 }
 
 void UAccelByteBlueprintsLobby::SendPartyMessage(const FString& Message)
 {
-	FRegistry::Lobby.SendPartyMessage(Message);
+	FRegistry::Lobby->SendPartyMessage(Message);
 }
 
 void UAccelByteBlueprintsLobby::SendInfoPartyRequest()
 {
-	FRegistry::Lobby.SendInfoPartyRequest();
+	FRegistry::Lobby->SendInfoPartyRequest();
 }
 
 void UAccelByteBlueprintsLobby::SendCreatePartyRequest()
 {
-	FRegistry::Lobby.SendCreatePartyRequest();
+	FRegistry::Lobby->SendCreatePartyRequest();
 }
 
 void UAccelByteBlueprintsLobby::SendLeavePartyRequest()
 {
-	FRegistry::Lobby.SendLeavePartyRequest();
+	FRegistry::Lobby->SendLeavePartyRequest();
 }
 
 void UAccelByteBlueprintsLobby::SendInviteToPartyRequest(const FString& UserId)
 {
-	FRegistry::Lobby.SendInviteToPartyRequest(UserId);
+	FRegistry::Lobby->SendInviteToPartyRequest(UserId);
 }
 
 void UAccelByteBlueprintsLobby::SendAcceptInvitationRequest(const FString& PartyId, const FString& InvitationToken)
 {
-	FRegistry::Lobby.SendAcceptInvitationRequest(PartyId, InvitationToken);
+	FRegistry::Lobby->SendAcceptInvitationRequest(PartyId, InvitationToken);
 }
 
 void UAccelByteBlueprintsLobby::SendKickPartyMemberRequest(const FString& UserId)
 {
-	FRegistry::Lobby.SendKickPartyMemberRequest(UserId);
+	FRegistry::Lobby->SendKickPartyMemberRequest(UserId);
 }
 
 void UAccelByteBlueprintsLobby::SendGetOnlineUsersRequest()
 {
-	FRegistry::Lobby.SendGetOnlineUsersRequest();
+	FRegistry::Lobby->SendGetOnlineUsersRequest();
 }
 
 // Matchmaking
 void UAccelByteBlueprintsLobby::SendStartMatchmaking(const FString& GameMode)
 {
-	FRegistry::Lobby.SendStartMatchmaking(GameMode);
+	FRegistry::Lobby->SendStartMatchmaking(GameMode);
 }
 
 void UAccelByteBlueprintsLobby::SendCancelMatchmaking(const FString& GameMode)
 {
-	FRegistry::Lobby.SendCancelMatchmaking(GameMode);
+	FRegistry::Lobby->SendCancelMatchmaking(GameMode);
 }
 
 void UAccelByteBlueprintsLobby::SendReadyConsentRequest(const FString& MatchId)
 {
-	FRegistry::Lobby.SendReadyConsentRequest(MatchId);
+	FRegistry::Lobby->SendReadyConsentRequest(MatchId);
 }
 
 
 // Friends
 void UAccelByteBlueprintsLobby::RequestFriend(FString UserId)
 {
-	FRegistry::Lobby.RequestFriend(UserId);
+	FRegistry::Lobby->RequestFriend(UserId);
 }
 
 void UAccelByteBlueprintsLobby::Unfriend(FString UserId)
 {
-	FRegistry::Lobby.Unfriend(UserId);
+	FRegistry::Lobby->Unfriend(UserId);
 }
 
 void UAccelByteBlueprintsLobby::ListOutgoingFriends()
 {
-	FRegistry::Lobby.ListOutgoingFriends();
+	FRegistry::Lobby->ListOutgoingFriends();
 }
 
 void UAccelByteBlueprintsLobby::CancelFriendRequest(FString UserId)
 {
-	FRegistry::Lobby.CancelFriendRequest(UserId);
+	FRegistry::Lobby->CancelFriendRequest(UserId);
 }
 
 void UAccelByteBlueprintsLobby::ListIncomingFriends()
 {
-	FRegistry::Lobby.ListIncomingFriends();
+	FRegistry::Lobby->ListIncomingFriends();
 }
 
 void UAccelByteBlueprintsLobby::AcceptFriend(FString UserId)
 {
-	FRegistry::Lobby.AcceptFriend(UserId);
+	FRegistry::Lobby->AcceptFriend(UserId);
 }
 
 void UAccelByteBlueprintsLobby::RejectFriend(FString UserId)
 {
-	FRegistry::Lobby.RejectFriend(UserId);
+	FRegistry::Lobby->RejectFriend(UserId);
 }
 
 void UAccelByteBlueprintsLobby::LoadFriendsList()
 {
-	FRegistry::Lobby.LoadFriendsList();
+	FRegistry::Lobby->LoadFriendsList();
 }
 
 void UAccelByteBlueprintsLobby::GetFriendshipStatus(FString UserId)
 {
-	FRegistry::Lobby.GetFriendshipStatus(UserId);
+	FRegistry::Lobby->GetFriendshipStatus(UserId);
 }
 
 void UAccelByteBlueprintsLobby::BindEvent(
@@ -257,29 +257,29 @@ void UAccelByteBlueprintsLobby::BindEvent(
         OnParsingError.ExecuteIfBound(Code, ErrorMessage);
     });
   
-    FRegistry::Lobby.SetConnectSuccessDelegate(OnSuccessDelegate);
-    FRegistry::Lobby.SetConnectFailedDelegate(OnErrorDelegate);
-    FRegistry::Lobby.SetConnectionClosedDelegate(OnConnectionCloseDelegate);
-    FRegistry::Lobby.SetPartyLeaveNotifDelegate(OnLeavePartyNoticeDelegate);
-    FRegistry::Lobby.SetPartyInviteNotifDelegate(OnInvitePartyInvitationNoticeDelegate);
-    FRegistry::Lobby.SetPartyGetInvitedNotifDelegate(OnInvitePartyGetInvitedNoticeDelegate);
-    FRegistry::Lobby.SetPartyJoinNotifDelegate(OnInvitePartyJoinNoticeDelegate);
-    FRegistry::Lobby.SetPartyKickNotifDelegate(OnInvitePartyKickedNoticeDelegate);
-    FRegistry::Lobby.SetPrivateMessageNotifDelegate(OnPrivateMessageNoticeDelegate);
-    FRegistry::Lobby.SetPartyChatNotifDelegate(OnPartyMessageNoticeDelegate);
-    FRegistry::Lobby.SetUserPresenceNotifDelegate(OnOnUserPresenceNoticeDelegate);
-    FRegistry::Lobby.SetMessageNotifDelegate(OnNotificationMessageDelegate);
-	FRegistry::Lobby.SetMatchmakingNotifDelegate(OnMatchmakingNoticeDelegate);
-	FRegistry::Lobby.SetOnFriendRequestAcceptedNotifDelegate(OnAcceptFriendsNotifDelegate);
-	FRegistry::Lobby.SetOnIncomingRequestFriendsNotifDelegate(OnRequestFriendsNotifDelegate);
-    FRegistry::Lobby.SetParsingErrorDelegate(OnParsingErrorDelegate);
-	FRegistry::Lobby.SetReadyConsentNotifDelegate(OnReadyConsentNoticeDelegate);
-	FRegistry::Lobby.SetRematchmakingNotifDelegate(OnRematchmakingNoticeDelegate);
-	FRegistry::Lobby.SetDsNotifDelegate(OnDsNoticeDelegate);
+    FRegistry::Lobby->SetConnectSuccessDelegate(OnSuccessDelegate);
+    FRegistry::Lobby->SetConnectFailedDelegate(OnErrorDelegate);
+    FRegistry::Lobby->SetConnectionClosedDelegate(OnConnectionCloseDelegate);
+    FRegistry::Lobby->SetPartyLeaveNotifDelegate(OnLeavePartyNoticeDelegate);
+    FRegistry::Lobby->SetPartyInviteNotifDelegate(OnInvitePartyInvitationNoticeDelegate);
+    FRegistry::Lobby->SetPartyGetInvitedNotifDelegate(OnInvitePartyGetInvitedNoticeDelegate);
+    FRegistry::Lobby->SetPartyJoinNotifDelegate(OnInvitePartyJoinNoticeDelegate);
+    FRegistry::Lobby->SetPartyKickNotifDelegate(OnInvitePartyKickedNoticeDelegate);
+    FRegistry::Lobby->SetPrivateMessageNotifDelegate(OnPrivateMessageNoticeDelegate);
+    FRegistry::Lobby->SetPartyChatNotifDelegate(OnPartyMessageNoticeDelegate);
+    FRegistry::Lobby->SetUserPresenceNotifDelegate(OnOnUserPresenceNoticeDelegate);
+    FRegistry::Lobby->SetMessageNotifDelegate(OnNotificationMessageDelegate);
+	FRegistry::Lobby->SetMatchmakingNotifDelegate(OnMatchmakingNoticeDelegate);
+	FRegistry::Lobby->SetOnFriendRequestAcceptedNotifDelegate(OnAcceptFriendsNotifDelegate);
+	FRegistry::Lobby->SetOnIncomingRequestFriendsNotifDelegate(OnRequestFriendsNotifDelegate);
+    FRegistry::Lobby->SetParsingErrorDelegate(OnParsingErrorDelegate);
+	FRegistry::Lobby->SetReadyConsentNotifDelegate(OnReadyConsentNoticeDelegate);
+	FRegistry::Lobby->SetRematchmakingNotifDelegate(OnRematchmakingNoticeDelegate);
+	FRegistry::Lobby->SetDsNotifDelegate(OnDsNoticeDelegate);
 }
 void UAccelByteBlueprintsLobby::UnbindDelegates()
 {
-    FRegistry::Lobby.UnbindEvent();
+    FRegistry::Lobby->UnbindEvent();
 }
 
 // Party
@@ -289,7 +289,7 @@ void UAccelByteBlueprintsLobby::SetInfoPartyResponseDelegate(FInfoPartyResponse
         AccelByte::Api::Lobby::FPartyInfoResponse::CreateLambda([OnInfoPartyResponse](const FAccelByteModelsInfoPartyResponse& Result) {
         OnInfoPartyResponse.ExecuteIfBound(Result);
     });
-    FRegistry::Lobby.SetInfoPartyResponseDelegate(OnInfoPartyResponseDelegate);
+    FRegistry::Lobby->SetInfoPartyResponseDelegate(OnInfoPartyResponseDelegate);
 }
 
 void UAccelByteBlueprintsLobby::SetCreatePartyResponseDelegate(FCreatePartyResponse OnCreatePartyResponse)
@@ -298,7 +298,7 @@ void UAccelByteBlueprintsLobby::SetCreatePartyResponseDelegate(FCreatePartyRespo
         AccelByte::Api::Lobby::FPartyCreateResponse::CreateLambda([OnCreatePartyResponse](const FAccelByteModelsCreatePartyResponse& Result) {
         OnCreatePartyResponse.ExecuteIfBound(Result);
     });
-    FRegistry::Lobby.SetCreatePartyResponseDelegate(OnInfoPartyResponseDelegate);
+    FRegistry::Lobby->SetCreatePartyResponseDelegate(OnInfoPartyResponseDelegate);
 }
 
 void UAccelByteBlueprintsLobby::SetLeavePartyResponseDelegate(FLeavePartyResponse OnLeavePartyResponse)
@@ -307,7 +307,7 @@ void UAccelByteBlueprintsLobby::SetLeavePartyResponseDelegate(FLeavePartyRespons
         AccelByte::Api::Lobby::FPartyLeaveResponse::CreateLambda([OnLeavePartyResponse](const FAccelByteModelsLeavePartyResponse& Result) {
         OnLeavePartyResponse.ExecuteIfBound(Result);
     });
-    FRegistry::Lobby.SetLeavePartyResponseDelegate(OnInfoPartyResponseDelegate);
+    FRegistry::Lobby->SetLeavePartyResponseDelegate(OnInfoPartyResponseDelegate);
 }
 
 void UAccelByteBlueprintsLobby::SetInvitePartyResponseDelegate(FInvitePartyResponse OnInvitePartyResponse)
@@ -316,7 +316,7 @@ void UAccelByteBlueprintsLobby::SetInvitePartyResponseDelegate(FInvitePartyRespo
         AccelByte::Api::Lobby::FPartyInviteResponse::CreateLambda([OnInvitePartyResponse](const FAccelByteModelsPartyInviteResponse& Result) {
         OnInvitePartyResponse.ExecuteIfBound(Result);
     });
-    FRegistry::Lobby.SetInvitePartyResponseDelegate(OnInfoPartyResponseDelegate);
+    FRegistry::Lobby->SetInvitePartyResponseDelegate(OnInfoPartyResponseDelegate);
 }
 
 void UAccelByteBlueprintsLobby::SetInvitePartyJoinResponseDelegate(FInvitePartyJoinResponse OnInvitePartyJoinResponse)
@@ -325,7 +325,7 @@ void UAccelByteBlueprintsLobby::SetInvitePartyJoinResponseDelegate(FInvitePartyJ
         AccelByte::Api::Lobby::FPartyJoinResponse::CreateLambda([OnInvitePartyJoinResponse](const FAccelByteModelsPartyJoinReponse& Result) {
         OnInvitePartyJoinResponse.ExecuteIfBound(Result);
     });
-    FRegistry::Lobby.SetInvitePartyJoinResponseDelegate(OnInfoPartyResponseDelegate);
+    FRegistry::Lobby->SetInvitePartyJoinResponseDelegate(OnInfoPartyResponseDelegate);
 }
 
 void UAccelByteBlueprintsLobby::SetInvitePartyKickMemberResponseDelegate(FInvitePartyKickMemberResponse OnInvitePartyKickMemberResponse)
@@ -334,7 +334,7 @@ void UAccelByteBlueprintsLobby::SetInvitePartyKickMemberResponseDelegate(FInvite
         AccelByte::Api::Lobby::FPartyKickResponse::CreateLambda([OnInvitePartyKickMemberResponse](const FAccelByteModelsKickPartyMemberResponse& Result) {
         OnInvitePartyKickMemberResponse.ExecuteIfBound(Result);
     });
-    FRegistry::Lobby.SetInvitePartyKickMemberResponseDelegate(OnInfoPartyResponseDelegate);
+    FRegistry::Lobby->SetInvitePartyKickMemberResponseDelegate(OnInfoPartyResponseDelegate);
 }
 
 // Chat
@@ -344,7 +344,7 @@ void UAccelByteBlueprintsLobby::SetPrivateMessageResponseDelegate(FPrivateMessag
         AccelByte::Api::Lobby::FPersonalChatResponse::CreateLambda([OnPrivateMessageResponse](const FAccelByteModelsPersonalMessageResponse& Result) {
         OnPrivateMessageResponse.ExecuteIfBound(Result);
     });
-    FRegistry::Lobby.SetPrivateMessageResponseDelegate(OnInfoPartyResponseDelegate);
+    FRegistry::Lobby->SetPrivateMessageResponseDelegate(OnInfoPartyResponseDelegate);
 }
 
 void UAccelByteBlueprintsLobby::SetPartyMessageResponseDelegate(FPartyMessageResponse OnPartyMessageResponse)
@@ -353,7 +353,7 @@ void UAccelByteBlueprintsLobby::SetPartyMessageResponseDelegate(FPartyMessageRes
         AccelByte::Api::Lobby::FPartyChatResponse::CreateLambda([OnPartyMessageResponse](const FAccelByteModelsPartyMessageResponse& Result) {
         OnPartyMessageResponse.ExecuteIfBound(Result);
     });
-    FRegistry::Lobby.SetPartyMessageResponseDelegate(OnInfoPartyResponseDelegate);
+    FRegistry::Lobby->SetPartyMessageResponseDelegate(OnInfoPartyResponseDelegate);
 }
 
 // Presence
@@ -363,7 +363,7 @@ void UAccelByteBlueprintsLobby::SetUserPresenceResponseDelegate(FSetUserPresence
         AccelByte::Api::Lobby::FSetUserPresenceResponse::CreateLambda([OnUserPresenceResponse](const FAccelByteModelsSetOnlineUsersResponse& Result) {
         OnUserPresenceResponse.ExecuteIfBound(Result);
     });
-    FRegistry::Lobby.SetUserPresenceResponseDelegate(OnInfoPartyResponseDelegate);
+    FRegistry::Lobby->SetUserPresenceResponseDelegate(OnInfoPartyResponseDelegate);
 }
 
 void UAccelByteBlueprintsLobby::SetGetAllUserPresenceResponseDelegate(FGetAllFriendsStatusResponse OnGetAllUserPresenceResponse)
@@ -372,18 +372,18 @@ void UAccelByteBlueprintsLobby::SetGetAllUserPresenceResponseDelegate(FGetAllFri
         AccelByte::Api::Lobby::FGetAllFriendsStatusResponse::CreateLambda([OnGetAllUserPresenceResponse](const FAccelByteModelsGetOnlineUsersResponse& Result) {
         OnGetAllUserPresenceResponse.ExecuteIfBound(Result);
     });
-    FRegistry::Lobby.SetGetAllUserPresenceResponseDelegate(OnInfoPartyResponseDelegate);
+    FRegistry::Lobby->SetGetAllUserPresenceResponseDelegate(OnInfoPartyResponseDelegate);
 }
 
 void UAccelByteBlueprintsLobby::SetPresenceStatus(Availability State, FString GameName)
 {
-	FRegistry::Lobby.SendSetPresenceStatus(State, GameName);
+	FRegistry::Lobby->SendSetPresenceStatus(State, GameName);
 }
 
 // Notification
 void UAccelByteBlueprintsLobby::GetAllAsyncNotification()
 {
-	FRegistry::Lobby.GetAllAsyncNotification();
+	FRegistry::Lobby->GetAllAsyncNotification();
 }
 
 // Matchmaking
@@ -393,7 +393,7 @@ void UAccelByteBlueprintsLobby::SetStartMatchmakingResponseDelegate(FMatchmaking
 		AccelByte::Api::Lobby::FMatchmakingResponse::CreateLambda([OnMatchmakingStart](const FAccelByteModelsMatchmakingResponse& Result) {
 		OnMatchmakingStart.ExecuteIfBound(Result);
 	});
-	FRegistry::Lobby.SetStartMatchmakingResponseDelegate(OnMatchmakingStartDelegate);
+	FRegistry::Lobby->SetStartMatchmakingResponseDelegate(OnMatchmakingStartDelegate);
 }
 
 void UAccelByteBlueprintsLobby::SetCancelMatchmakingResponseDelegate(FMatchmakingResponse OnMatchmakingCancel)
@@ -402,7 +402,7 @@ void UAccelByteBlueprintsLobby::SetCancelMatchmakingResponseDelegate(FMatchmakin
 		AccelByte::Api::Lobby::FMatchmakingResponse::CreateLambda([OnMatchmakingCancel](const FAccelByteModelsMatchmakingResponse& Result) {
 		OnMatchmakingCancel.ExecuteIfBound(Result);
 	});
-	FRegistry::Lobby.SetCancelMatchmakingResponseDelegate(OnMatchmakingCancelDelegate);
+	FRegistry::Lobby->SetCancelMatchmakingResponseDelegate(OnMatchmakingCancelDelegate);
 }
 
 void UAccelByteBlueprintsLobby::SetReadyConsentResponseDelegate(FReadyConsentResponse OnReadyConsentResponse)
@@ -411,7 +411,7 @@ void UAccelByteBlueprintsLobby::SetReadyConsentResponseDelegate(FReadyConsentRes
 		AccelByte::Api::Lobby::FReadyConsentResponse::CreateLambda([OnReadyConsentResponse](const FAccelByteModelsReadyConsentRequest& Result){
 		OnReadyConsentResponse.ExecuteIfBound(Result);
 	});
-	FRegistry::Lobby.SetReadyConsentResponseDelegate(OnReadyConsentResponseDelegate);
+	FRegistry::Lobby->SetReadyConsentResponseDelegate(OnReadyConsentResponseDelegate);
 }
 
 void UAccelByteBlueprintsLobby::SetMatchmakingNotifDelegate(FMatchmakingNotice OnMatchmakingNotice)
@@ -420,7 +420,7 @@ void UAccelByteBlueprintsLobby::SetMatchmakingNotifDelegate(FMatchmakingNotice O
         AccelByte::Api::Lobby::FMatchmakingNotif::CreateLambda([OnMatchmakingNotice](const FAccelByteModelsMatchmakingNotice& Result) {
         OnMatchmakingNotice.ExecuteIfBound(Result);
     });
-    FRegistry::Lobby.SetMatchmakingNotifDelegate(OnInfoPartyResponseDelegate);
+    FRegistry::Lobby->SetMatchmakingNotifDelegate(OnInfoPartyResponseDelegate);
 }
 
 void UAccelByteBlueprintsLobby::SetReadyConsentNotifDelegate(FReadyConsentNotice OnReadyConsentNotice)
@@ -429,7 +429,7 @@ void UAccelByteBlueprintsLobby::SetReadyConsentNotifDelegate(FReadyConsentNotice
 		AccelByte::Api::Lobby::FReadyConsentNotif::CreateLambda([OnReadyConsentNotice](const FAccelByteModelsReadyConsentNotice& Result) {
 		OnReadyConsentNotice.ExecuteIfBound(Result);
 	});
-	FRegistry::Lobby.SetReadyConsentNotifDelegate(OnReadyConsentNotifDelegate);
+	FRegistry::Lobby->SetReadyConsentNotifDelegate(OnReadyConsentNotifDelegate);
 }
 
 void UAccelByteBlueprintsLobby::SetRematchmakingNotifDelegate(FRematchmakingNotice OnRematchmakingNotice)
@@ -438,7 +438,7 @@ void UAccelByteBlueprintsLobby::SetRematchmakingNotifDelegate(FRematchmakingNoti
 		AccelByte::Api::Lobby::FRematchmakingNotif::CreateLambda([OnRematchmakingNotice](const FAccelByteModelsRematchmakingNotice& Result) {
 		OnRematchmakingNotice.ExecuteIfBound(Result);
 	});
-	FRegistry::Lobby.SetRematchmakingNotifDelegate(OnRematchmakingNotifDelegate);
+	FRegistry::Lobby->SetRematchmakingNotifDelegate(OnRematchmakingNotifDelegate);
 }
 
 void UAccelByteBlueprintsLobby::SetDsNotifDelegate(FDsNotice OnDsNotice)
@@ -447,13 +447,13 @@ void UAccelByteBlueprintsLobby::SetDsNotifDelegate(FDsNotice OnDsNotice)
 		AccelByte::Api::Lobby::FDsNotif::CreateLambda([OnDsNotice](const FAccelByteModelsDsNotice& Result) {
 		OnDsNotice.ExecuteIfBound(Result);
 	});
-	FRegistry::Lobby.SetDsNotifDelegate(OnDsNotifDelegate);
+	FRegistry::Lobby->SetDsNotifDelegate(OnDsNotifDelegate);
 }
 
 // Friends
 void UAccelByteBlueprintsLobby::SetRequestFriendResponseDelegate(FRequestFriendsResponseDelegate OnResponse)
 {
-	FRegistry::Lobby.SetRequestFriendsResponseDelegate(AccelByte::Api::Lobby::FRequestFriendsResponse::CreateLambda([OnResponse](const FAccelByteModelsRequestFriendsResponse& Result)
+	FRegistry::Lobby->SetRequestFriendsResponseDelegate(AccelByte::Api::Lobby::FRequestFriendsResponse::CreateLambda([OnResponse](const FAccelByteModelsRequestFriendsResponse& Result)
 	{
 		OnResponse.ExecuteIfBound(Result);
 	}));
@@ -461,7 +461,7 @@ void UAccelByteBlueprintsLobby::SetRequestFriendResponseDelegate(FRequestFriends
 
 void UAccelByteBlueprintsLobby::SetUnfriendResponseDelegate(FUnfriendResponseDelegate OnResponse)
 {
-	FRegistry::Lobby.SetUnfriendResponseDelegate(AccelByte::Api::Lobby::FUnfriendResponse::CreateLambda([OnResponse](const FAccelByteModelsUnfriendResponse& Result)
+	FRegistry::Lobby->SetUnfriendResponseDelegate(AccelByte::Api::Lobby::FUnfriendResponse::CreateLambda([OnResponse](const FAccelByteModelsUnfriendResponse& Result)
 	{
 		OnResponse.ExecuteIfBound(Result);
 	}));
@@ -469,7 +469,7 @@ void UAccelByteBlueprintsLobby::SetUnfriendResponseDelegate(FUnfriendResponseDel
 
 void UAccelByteBlueprintsLobby::SetListOutgoingFriendsResponseDelegate(FListOutgoingFriendsResponseDelegate OnResponse)
 {
-	FRegistry::Lobby.SetListOutgoingFriendsResponseDelegate(AccelByte::Api::Lobby::FListOutgoingFriendsResponse::CreateLambda([OnResponse](const FAccelByteModelsListOutgoingFriendsResponse& Result)
+	FRegistry::Lobby->SetListOutgoingFriendsResponseDelegate(AccelByte::Api::Lobby::FListOutgoingFriendsResponse::CreateLambda([OnResponse](const FAccelByteModelsListOutgoingFriendsResponse& Result)
 	{
 		OnResponse.ExecuteIfBound(Result);
 	}));
@@ -477,7 +477,7 @@ void UAccelByteBlueprintsLobby::SetListOutgoingFriendsResponseDelegate(FListOutg
 
 void UAccelByteBlueprintsLobby::SetCancelFriendRequestResponseDelegate(FCancelFriendsResponseDelegate OnResponse)
 {
-	FRegistry::Lobby.SetCancelFriendsResponseDelegate(AccelByte::Api::Lobby::FCancelFriendsResponse::CreateLambda([OnResponse](const FAccelByteModelsCancelFriendsResponse& Result)
+	FRegistry::Lobby->SetCancelFriendsResponseDelegate(AccelByte::Api::Lobby::FCancelFriendsResponse::CreateLambda([OnResponse](const FAccelByteModelsCancelFriendsResponse& Result)
 	{
 		OnResponse.ExecuteIfBound(Result);
 	}));
@@ -485,7 +485,7 @@ void UAccelByteBlueprintsLobby::SetCancelFriendRequestResponseDelegate(FCancelFr
 
 void UAccelByteBlueprintsLobby::SetListIncomingFriendsResponseDelegate(FListIncomingFriendsResponseDelegate OnResponse)
 {
-	FRegistry::Lobby.SetListIncomingFriendsResponseDelegate(AccelByte::Api::Lobby::FListIncomingFriendsResponse::CreateLambda([OnResponse](const FAccelByteModelsListIncomingFriendsResponse& Result)
+	FRegistry::Lobby->SetListIncomingFriendsResponseDelegate(AccelByte::Api::Lobby::FListIncomingFriendsResponse::CreateLambda([OnResponse](const FAccelByteModelsListIncomingFriendsResponse& Result)
 	{
 		OnResponse.ExecuteIfBound(Result);
 	}));
@@ -493,7 +493,7 @@ void UAccelByteBlueprintsLobby::SetListIncomingFriendsResponseDelegate(FListInco
 
 void UAccelByteBlueprintsLobby::SetAcceptFriendResponseDelegate(FAcceptFriendsResponseDelegate OnResponse)
 {
-	FRegistry::Lobby.SetAcceptFriendsResponseDelegate(AccelByte::Api::Lobby::FAcceptFriendsResponse::CreateLambda([OnResponse](const FAccelByteModelsAcceptFriendsResponse& Result)
+	FRegistry::Lobby->SetAcceptFriendsResponseDelegate(AccelByte::Api::Lobby::FAcceptFriendsResponse::CreateLambda([OnResponse](const FAccelByteModelsAcceptFriendsResponse& Result)
 	{
 		OnResponse.ExecuteIfBound(Result);
 	}));
@@ -501,7 +501,7 @@ void UAccelByteBlueprintsLobby::SetAcceptFriendResponseDelegate(FAcceptFriendsRe
 
 void UAccelByteBlueprintsLobby::SetRejectFriendResponseDelegate(FRejectFriendsResponseDelegate OnResponse)
 {
-	FRegistry::Lobby.SetRejectFriendsResponseDelegate(AccelByte::Api::Lobby::FRejectFriendsResponse::CreateLambda([OnResponse](const FAccelByteModelsRejectFriendsResponse& Result)
+	FRegistry::Lobby->SetRejectFriendsResponseDelegate(AccelByte::Api::Lobby::FRejectFriendsResponse::CreateLambda([OnResponse](const FAccelByteModelsRejectFriendsResponse& Result)
 	{
 		OnResponse.ExecuteIfBound(Result);
 	}));
@@ -509,7 +509,7 @@ void UAccelByteBlueprintsLobby::SetRejectFriendResponseDelegate(FRejectFriendsRe
 
 void UAccelByteBlueprintsLobby::SetLoadFriendsListResponseDelegate(FLoadFriendListResponseDelegate OnResponse)
 {
-	FRegistry::Lobby.SetLoadFriendListResponseDelegate(AccelByte::Api::Lobby::FLoadFriendListResponse::CreateLambda([OnResponse](const FAccelByteModelsLoadFriendListResponse& Result)
+	FRegistry::Lobby->SetLoadFriendListResponseDelegate(AccelByte::Api::Lobby::FLoadFriendListResponse::CreateLambda([OnResponse](const FAccelByteModelsLoadFriendListResponse& Result)
 	{
 		OnResponse.ExecuteIfBound(Result);
 	}));
@@ -517,7 +517,7 @@ void UAccelByteBlueprintsLobby::SetLoadFriendsListResponseDelegate(FLoadFriendLi
 
 void UAccelByteBlueprintsLobby::SetGetFriendshipStatusResponseDelegate(FGetFriendshipStatusResponseDelegate OnResponse)
 {
-	FRegistry::Lobby.SetGetFriendshipStatusResponseDelegate(AccelByte::Api::Lobby::FGetFriendshipStatusResponse::CreateLambda([OnResponse](const FAccelByteModelsGetFriendshipStatusResponse& Result)
+	FRegistry::Lobby->SetGetFriendshipStatusResponseDelegate(AccelByte::Api::Lobby::FGetFriendshipStatusResponse::CreateLambda([OnResponse](const FAccelByteModelsGetFriendshipStatusResponse& Result)
 	{
 		OnResponse.ExecuteIfBound(Result);
 	}));
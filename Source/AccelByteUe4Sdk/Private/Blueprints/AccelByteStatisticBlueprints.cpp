@@ -11,7 +11,7 @@ using AccelByte::FErrorHandler;
 
 void UAccelByteBlueprintsStatistic::CreateUserStatItems(const TArray<FString>& StatCodes, const FCreateUserStatItemsSuccess& OnSuccess, const FBlueprintErrorHandler& OnError)
 {
-	FRegistry::Statistic.CreateUserStatItems(
+	FRegistry::Statistic->CreateUserStatItems(
 		StatCodes,
 		THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>>::CreateLambda([OnSuccess](const TArray<FAccelByteModelsBulkStatItemOperationResult>& Result)
 		{
@@ -25,7 +25,7 @@ void UAccelByteBlueprintsStatistic::CreateUserStatItems(const TArray<FString>& S
 
 void UAccelByteBlueprintsStatistic::GetAllUserStatItems(const FGetAllUserStatItemsSuccess& OnSuccess, const FBlueprintErrorHandler& OnError)
 {
-	FRegistry::Statistic.GetAllUserStatItems(THandler<FAccelByteModelsUserStatItemPagingSlicedResult>::CreateLambda([OnSuccess](const FAccelByteModelsUserStatItemPagingSlicedResult& Result)
+	FRegistry::Statistic->GetAllUserStatItems(THandler<FAccelByteModelsUserStatItemPagingSlicedResult>::CreateLambda([OnSuccess](const FAccelByteModelsUserStatItemPagingSlicedResult& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}),
@@ -37,7 +37,7 @@ void UAccelByteBlueprintsStatistic::GetAllUserStatItems(const FGetAllUserStatIte
 
 void UAccelByteBlueprintsStatistic::GetUserStatItems(const TArray<FString>& StatCodes, const TArray<FString>& Tags, const FGetUserStatItemsSuccess& OnSuccess, const FBlueprintErrorHandler& OnError)
 {
-	FRegistry::Statistic.GetUserStatItems(
+	FRegistry::Statistic->GetUserStatItems(
 		StatCodes,
 		Tags,
 		THandler<FAccelByteModelsUserStatItemPagingSlicedResult>::CreateLambda([OnSuccess](const FAccelByteModelsUserStatItemPagingSlicedResult& Result)
@@ -52,7 +52,7 @@ void UAccelByteBlueprintsStatistic::GetUserStatItems(const TArray<FString>& Stat
 
 void UAccelByteBlueprintsStatistic::IncrementUserStatItems(const TArray<FAccelByteModelsBulkStatItemInc>& Data, const FBulkAddUserStatItemValueSuccess& OnSuccess, const FBlueprintErrorHandler& OnError)
 {
-	FRegistry::Statistic.IncrementUserStatItems(Data, THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>>::CreateLambda([OnSuccess](const TArray<FAccelByteModelsBulkStatItemOperationResult>& Result)
+	FRegistry::Statistic->IncrementUserStatItems(Data, THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>>::CreateLambda([OnSuccess](const TArray<FAccelByteModelsBulkStatItemOperationResult>& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}),
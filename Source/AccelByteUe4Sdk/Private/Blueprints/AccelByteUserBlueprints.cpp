@@ -13,7 +13,7 @@ using AccelByte::Api::User;
 
 void UBPUser::LoginWithUsername(const FString& Username, const FString& Password, const FDHandler& OnSuccess, const FDErrorHandler& OnError)
 {
-	FRegistry::User.LoginWithUsername(Username, Password, FVoidHandler::CreateLambda([OnSuccess]()
+	FRegistry::User->LoginWithUsername(Username, Password, FVoidHandler::CreateLambda([OnSuccess]()
 	{
 		OnSuccess.ExecuteIfBound();
 	}),
@@ -25,7 +25,7 @@ void UBPUser::LoginWithUsername(const FString& Username, const FString& Password
 
 void UBPUser::LoginWithOtherPlatform(EAccelBytePlatformType PlatformType, const FString& Token, const FDHandler& OnSuccess, const FDErrorHandler& OnError)
 {
-	FRegistry::User.LoginWithOtherPlatform(PlatformType, Token, FVoidHandler::CreateLambda([OnSuccess]()
+	FRegistry::User->LoginWithOtherPlatform(PlatformType, Token, FVoidHandler::CreateLambda([OnSuccess]()
 	{
 		OnSuccess.ExecuteIfBound();
 	}),
@@ -37,7 +37,7 @@ void UBPUser::LoginWithOtherPlatform(EAccelBytePlatformType PlatformType, const
 
 void UBPUser::LoginWithDeviceId(const FDHandler& OnSuccess, const FDErrorHandler& OnError)
 {
-	FRegistry::User.LoginWithDeviceId(FVoidHandler::CreateLambda([OnSuccess]()
+	FRegistry::User->LoginWithDeviceId(FVoidHandler::CreateLambda([OnSuccess]()
 	{
 		OnSuccess.ExecuteIfBound();
 	}),
@@ -49,12 +49,12 @@ void UBPUser::LoginWithDeviceId(const FDHandler& OnSuccess, const FDErrorHandler
 
 void UBPUser::ForgetAllCredentials()
 {
-	FRegistry::User.ForgetAllCredentials();
+	FRegistry::User->ForgetAllCredentials();
 }
 
 void UBPUser::Register(const FString& Username, const FString& Password, const FString& DisplayName, const FString& Country, const FString& DateOfBirth, const FDUserRegisterHandler& OnSuccess, const FDErrorHandler& OnError)
 {
-	FRegistry::User.Register(
+	FRegistry::User->Register(
 		Username, Password, DisplayName, Country, DateOfBirth,
 		THandler<FRegisterResponse>::CreateLambda([OnSuccess](const FRegisterResponse& Result) { OnSuccess.ExecuteIfBound(Result); }),
 		FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage) { OnError.ExecuteIfBound(ErrorCode, ErrorMessage); })
@@ -64,7 +64,7 @@ void UBPUser::Register(const FString& Username, const FString& Password, const F
 
 void UBPUser::Upgrade(const FString& Username, const FString& Password, const FDUserDataHandler& OnSuccess, const FDErrorHandler& OnError)
 {
-	FRegistry::User.Upgrade(
+	FRegistry::User->Upgrade(
 		Username, Password,
 		THandler<FAccountUserData>::CreateLambda([OnSuccess](const FAccountUserData& Result) { OnSuccess.ExecuteIfBound(Result); }),
 		FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage) { OnError.ExecuteIfBound(ErrorCode, ErrorMessage); })
@@ -73,7 +73,7 @@ void UBPUser::Upgrade(const FString& Username, const FString& Password, const FD
 
 void UBPUser::SendUpgradeVerificationCode(const FString & Username, const FDHandler& OnSuccess, const FDErrorHandler& OnError)
 {
-	FRegistry::User.SendUpgradeVerificationCode(
+	FRegistry::User->SendUpgradeVerificationCode(
 		Username,
 		FVoidHandler::CreateLambda([OnSuccess]() { OnSuccess.ExecuteIfBound(); }),
 		FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage) { OnError.ExecuteIfBound(ErrorCode, ErrorMessage); })
@@ -82,7 +82,7 @@ void UBPUser::SendUpgradeVerificationCode(const FString & Username, const FDHand
 
 void UBPUser::UpgradeAndVerify(const FString& Username, const FString& Password, const FString& VerificationCode, const FDUserDataHandler& OnSuccess, const FDErrorHandler& OnError)
 {
-	FRegistry::User.UpgradeAndVerify(
+	FRegistry::User->UpgradeAndVerify(
 		Username, Password, VerificationCode,
 		THandler<FAccountUserData>::CreateLambda([OnSuccess](const FAccountUserData& Result) { OnSuccess.ExecuteIfBound(Result); }),
 		FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage) { OnError.ExecuteIfBound(ErrorCode, ErrorMessage); })
@@ -91,7 +91,7 @@ void UBPUser::UpgradeAndVerify(const FString& Username, const FString& Password,
 
 void UBPUser::SendVerificationCode(const FDHandler& OnSuccess, const FDErrorHandler& OnError)
 {
-	FRegistry::User.SendVerificationCode(
+	FRegistry::User->SendVerificationCode(
 		FVoidHandler::CreateLambda([OnSuccess]() { OnSuccess.ExecuteIfBound(); }),
 		FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage) { OnError.ExecuteIfBound(ErrorCode, ErrorMessage); })
 	);
@@ -100,7 +100,7 @@ void UBPUser::SendVerificationCode(const FDHandler& OnSuccess, const FDErrorHand
 void UBPUser::Verify(const FString& VerificationCode, const FDHandler& OnSuccess, const FDErrorHandler& OnError)
 {
 	
-	FRegistry::User.Verify(
+	FRegistry::User->Verify(
 		VerificationCode,
 		FVoidHandler::CreateLambda([OnSuccess]() { OnSuccess.ExecuteIfBound(); }),
 		FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage) { OnError.ExecuteIfBound(ErrorCode, ErrorMessage); })
@@ -110,7 +110,7 @@ void UBPUser::Verify(const FString& VerificationCode, const FDHandler& OnSuccess
 void UBPUser::SendResetPasswordCode(const FString& Username, const FDHandler& OnSuccess, const FDErrorHandler& OnError)
 {
 	
-	FRegistry::User.SendResetPasswordCode(
+	FRegistry::User->SendResetPasswordCode(
 		Username, 
 		FVoidHandler::CreateLambda([OnSuccess]() { OnSuccess.ExecuteIfBound(); }),
 		FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage) { OnError.ExecuteIfBound(ErrorCode, ErrorMessage); })
@@ -119,7 +119,7 @@ void UBPUser::SendResetPasswordCode(const FString& Username, const FDHandler& On
 
 void UBPUser::ResetPassword(const FString& VerificationCode, const FString& Username, const FString& NewPassword, const FDHandler& OnSuccess, const FDErrorHandler& OnError)
 {
-	FRegistry::User.ResetPassword(
+	FRegistry::User->ResetPassword(
 		VerificationCode, Username, NewPassword,
 		FVoidHandler::CreateLambda([OnSuccess]() { OnSuccess.ExecuteIfBound(); }),
 		FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage) { OnError.ExecuteIfBound(ErrorCode, ErrorMessage); })
@@ -128,7 +128,7 @@ void UBPUser::ResetPassword(const FString& VerificationCode, const FString& User
 
 void UBPUser::GetPlatformLinks(const FDPlatformLinksHandler& OnSuccess, const FDErrorHandler& OnError)
 {
-	FRegistry::User.GetPlatformLinks(
+	FRegistry::User->GetPlatformLinks(
 		THandler<FPagedPlatformLinks>::CreateLambda([OnSuccess](const FPagedPlatformLinks& Result) { OnSuccess.ExecuteIfBound(Result); }),
 		FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage) { OnError.ExecuteIfBound(ErrorCode, ErrorMessage); })
 	);
@@ -136,7 +136,7 @@ void UBPUser::GetPlatformLinks(const FDPlatformLinksHandler& OnSuccess, const FD
 
 void UBPUser::LinkOtherPlatform(EAccelBytePlatformType PlatformType, const FString& Ticket, const FDHandler& OnSuccess, const FDErrorHandler& OnError)
 {
-	FRegistry::User.LinkOtherPlatform(
+	FRegistry::User->LinkOtherPlatform(
 		PlatformType, Ticket,
 		FVoidHandler::CreateLambda([OnSuccess]() { OnSuccess.ExecuteIfBound(); }),
 		FCustomErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage, const FJsonObject& MessageVariables) { OnError.ExecuteIfBound(ErrorCode, ErrorMessage); })
@@ -146,7 +146,7 @@ void UBPUser::LinkOtherPlatform(EAccelBytePlatformType PlatformType, const FStri
 void UBPUser::UnlinkOtherPlatform(EAccelBytePlatformType PlatformType, const FDHandler& OnSuccess, const FDErrorHandler& OnError)
 {
 	
-	FRegistry::User.UnlinkOtherPlatform(
+	FRegistry::User->UnlinkOtherPlatform(
 		PlatformType,
 		FVoidHandler::CreateLambda([OnSuccess]() { OnSuccess.ExecuteIfBound(); }),
 		FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage) { OnError.ExecuteIfBound(ErrorCode, ErrorMessage); })
@@ -155,7 +155,7 @@ void UBPUser::UnlinkOtherPlatform(EAccelBytePlatformType PlatformType, const FDH
 
 void UBPUser::GetUserEligibleToPlay(const FDUserEligiblePlayHandler& OnSuccess, const FDErrorHandler& OnError)
 {
-	FRegistry::User.GetUserEligibleToPlay(
+	FRegistry::User->GetUserEligibleToPlay(
 		THandler<bool>::CreateLambda([OnSuccess](bool result) {OnSuccess.ExecuteIfBound(result); }),
 		FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage) { OnError.ExecuteIfBound(ErrorCode, ErrorMessage); })
 	);
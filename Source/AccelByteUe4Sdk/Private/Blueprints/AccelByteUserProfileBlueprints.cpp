@@ -12,7 +12,7 @@ using AccelByte::FVoidHandler;
 
 void UAccelByteBlueprintsUserProfile::GetUserProfile(const FGetUserProfileSuccess& OnSuccess, const FBlueprintErrorHandler& OnError)
 {
-	FRegistry::UserProfile.GetUserProfile(AccelByte::THandler<FAccelByteModelsUserProfileInfo>::CreateLambda([OnSuccess](const FAccelByteModelsUserProfileInfo& Result)
+	FRegistry::UserProfile->GetUserProfile(AccelByte::THandler<FAccelByteModelsUserProfileInfo>::CreateLambda([OnSuccess](const FAccelByteModelsUserProfileInfo& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}), FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage)
@@ -23,7 +23,7 @@ void UAccelByteBlueprintsUserProfile::GetUserProfile(const FGetUserProfileSucces
 
 void UAccelByteBlueprintsUserProfile::UpdateUserProfile(const FAccelByteModelsUserProfileUpdateRequest& ProfileUpdateRequest, const FUpdateUserProfileSuccess& OnSuccess, const FBlueprintErrorHandler& OnError)
 {
-	FRegistry::UserProfile.UpdateUserProfile(ProfileUpdateRequest, AccelByte::THandler<FAccelByteModelsUserProfileInfo>::CreateLambda([OnSuccess](const FAccelByteModelsUserProfileInfo& Result)
+	FRegistry::UserProfile->UpdateUserProfile(ProfileUpdateRequest, AccelByte::THandler<FAccelByteModelsUserProfileInfo>::CreateLambda([OnSuccess](const FAccelByteModelsUserProfileInfo& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}), FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage)
@@ -34,7 +34,7 @@ void UAccelByteBlueprintsUserProfile::UpdateUserProfile(const FAccelByteModelsUs
 
 void UAccelByteBlueprintsUserProfile::CreateUserProfile(const FAccelByteModelsUserProfileCreateRequest& ProfileCreateRequest, const FCreateUserProfileSuccess& OnSuccess, const FBlueprintErrorHandler& OnError)
 {
-	FRegistry::UserProfile.CreateUserProfile(ProfileCreateRequest, AccelByte::THandler<FAccelByteModelsUserProfileInfo>::CreateLambda([OnSuccess](const FAccelByteModelsUserProfileInfo& Result)
+	FRegistry::UserProfile->CreateUserProfile(ProfileCreateRequest, AccelByte::THandler<FAccelByteModelsUserProfileInfo>::CreateLambda([OnSuccess](const FAccelByteModelsUserProfileInfo& Result)
 	{
 		OnSuccess.ExecuteIfBound(Result);
 	}), FErrorHandler::CreateLambda([OnError](int32 ErrorCode, const FString& ErrorMessage)
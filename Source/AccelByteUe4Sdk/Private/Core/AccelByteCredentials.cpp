@@ -5,6 +5,8 @@
 #include "Core/AccelByteCredentials.h"
 #include "Api/AccelByteOauth2Api.h"
 #include "Models/AccelByteOauth2Models.h"
+#include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteTimerService.h"
 
 using namespace AccelByte::Api;
 
@@ -17,17 +19,29 @@ namespace AccelByte
 
 Credentials::Credentials()
 	: AuthToken()
+	, Authorization(MakeShared<FHttpAuthorization, ESPMode::ThreadSafe>())
 	, UserSessionExpire(0)
 	, UserSessionState(ESessionState::Invalid)
 	, UserRefreshTime(0.0)
 	, UserExpiredTime(0.0)
 	, UserRefreshBackoff(0.0)
+	, Self(this, [](Credentials*) {})
 {
+	Authorization->SetRefreshHandler(FHttpAuthorizationRefreshDelegate::CreateRaw(this, &Credentials::RefreshTokenNow));
+}
+
+Credentials::~Credentials()
+{
+	// the scheduler may hold the authorization longer than these credentials live
+	Authorization->SetRefreshHandler(FHttpAuthorizationRefreshDelegate());
+	FRegistry::TimerService.RemoveTimer(PollRefreshTokenHandle);
 }
 
 void Credentials::ForgetAll()
 {
 	AuthToken = {};
+	Authorization->Reset();
+	FRegistry::TimerService.RemoveTimer(PollRefreshTokenHandle);
 	UserSessionExpire = 0;
 	UserRefreshBackoff = 0.0;
 	UserRefreshTime = 0.0;
@@ -44,9 +58,10 @@ void Credentials::SetClientCredentials(const FString& Id, const FString& Secret)
 void Credentials::SetAuthToken(const FOauth2Token NewAuthToken, float CurrentTime)
 {
 	UserSessionExpire = CurrentTime + (NewAuthToken.Expires_in*FMath::FRandRange(0.7, 0.9));
-	UserRefreshTime = UserSessionExpire;
+	ScheduleRefreshToken(UserSessionExpire);
 	AuthToken = NewAuthToken;
 	UserSessionState = ESessionState::Valid;
+	Authorization->SetAccessToken(AuthToken.Access_token);
 }
 
 void Credentials::SetUserEmailAddress(const FString& EmailAddress)
@@ -59,6 +74,16 @@ const FString& Credentials::GetAccessToken() const
 	return AuthToken.Access_token;
 }
 
+FString Credentials::GetAuthorizationHeader() const
+{
+	return *Authorization->GetHeader();
+}
+
+const FHttpAuthorizationRef& Credentials::GetAuthorization() const
+{
+	return Authorization;
+}
+
 const FString& Credentials::GetRefreshToken() const
 {
 	return AuthToken.Refresh_token;
@@ -79,25 +104,19 @@ Credentials::ESessionState Credentials::GetSessionState() const
 	return UserSessionState;
 }
 
-void Credentials::Startup()
+TWeakPtr<Credentials, ESPMode::ThreadSafe> Credentials::AsWeak()
 {
-	PollRefreshTokenHandle = FTicker::GetCoreTicker().AddTicker(
-        FTickerDelegate::CreateLambda([this](float DeltaTime)
-        {
-            PollRefreshToken(FPlatformTime::Seconds());
+	return Self;
+}
 
-            return true;
-        }),
-        0.2f);
+void Credentials::Startup()
+{
+	// the refresh timer is scheduled when a token is set, nothing polls in between
 }
 
 void Credentials::Shutdown()
 {
-	if (PollRefreshTokenHandle.IsValid())
-	{
-		FTicker::GetCoreTicker().RemoveTicker(PollRefreshTokenHandle);
-		PollRefreshTokenHandle.Reset();
-	}
+	FRegistry::TimerService.RemoveTimer(PollRefreshTokenHandle);
 }
 
 const FString& Credentials::GetUserId() const
@@ -123,25 +142,37 @@ void Credentials::PollRefreshToken(double CurrentTime)
 	case ESessionState::Valid:
 		if (UserRefreshTime <= CurrentTime)
 		{
+			Authorization->BeginRefresh();
 			Oauth2::GetTokenWithRefreshToken(
 				ClientId, ClientSecret,
 				AuthToken.Refresh_token,
-				THandler<FOauth2Token>::CreateLambda([this, CurrentTime](const FOauth2Token& Result)
+				// the refresh goes through FRegistry::HttpRetryScheduler, which outlives evicted API clients
+				THandler<FOauth2Token>::CreateLambda([WeakThis = AsWeak(), CurrentTime](const FOauth2Token& Result)
 			{
-				SetAuthToken(Result, CurrentTime);
+				if (TSharedPtr<Credentials, ESPMode::ThreadSafe> This = WeakThis.Pin())
+				{
+					This->SetAuthToken(Result, CurrentTime);
+				}
 			}),
-				FErrorHandler::CreateLambda([this, CurrentTime](int32 ErrorCode, const FString& ErrorMessage)
+				FErrorHandler::CreateLambda([WeakThis = AsWeak(), CurrentTime](int32 ErrorCode, const FString& ErrorMessage)
 			{
-				if (UserRefreshBackoff <= 0.0)
+				TSharedPtr<Credentials, ESPMode::ThreadSafe> This = WeakThis.Pin();
+				if (!This.IsValid())
 				{
-					UserRefreshBackoff = 10.0;
+					return;
 				}
 
-				UserRefreshBackoff *= 2.0;
-				UserRefreshBackoff += FMath::FRandRange(1.0, 60.0);
-				ScheduleRefreshToken(CurrentTime + UserRefreshBackoff);
+				if (This->UserRefreshBackoff <= 0.0)
+				{
+					This->UserRefreshBackoff = 10.0;
+				}
+
+				This->UserRefreshBackoff *= 2.0;
+				This->UserRefreshBackoff += FMath::FRandRange(1.0, 60.0);
+				This->ScheduleRefreshToken(CurrentTime + This->UserRefreshBackoff);
 
-				UserSessionState = ESessionState::Expired;
+				This->UserSessionState = ESessionState::Expired;
+				This->Authorization->EndRefresh();
 			}));
 
 			UserSessionState = ESessionState::Refreshing;
@@ -157,6 +188,31 @@ void Credentials::PollRefreshToken(double CurrentTime)
 void Credentials::ScheduleRefreshToken(double RefreshTime)
 {
 	UserRefreshTime = RefreshTime;
+
+	if (FRegistry::TimerService.RescheduleTimer(PollRefreshTokenHandle, RefreshTime))
+	{
+		return;
+	}
+
+	PollRefreshTokenHandle = FRegistry::TimerService.AddTimer(RefreshTime, FSimpleDelegate::CreateLambda([this]()
+	{
+		PollRefreshTokenHandle.Reset();
+		PollRefreshToken(FPlatformTime::Seconds());
+	}));
+}
+
+bool Credentials::RefreshTokenNow()
+{
+	// an expired session is backing off after a failed refresh, don't let 401 responses hammer the token endpoint
+	if (UserSessionState != ESessionState::Valid)
+	{
+		return UserSessionState == ESessionState::Refreshing;
+	}
+
+	ScheduleRefreshToken(0.0);
+	PollRefreshToken(FPlatformTime::Seconds());
+
+	return UserSessionState == ESessionState::Refreshing;
 }
 
 const FOauth2Token& Credentials::GetAuthToken() const
@@ -165,8 +221,6 @@ const FOauth2Token& Credentials::GetAuthToken() const
 }
 } // Namespace AccelByte
 
-#include "Core/AccelByteRegistry.h"
-
 FString UAccelByteBlueprintsCredentials::GetUserSessionId()
 {
 	return FRegistry::Credentials.GetAccessToken();
@@ -255,7 +255,9 @@ namespace AccelByte
 		{ static_cast<int32>(ErrorCodes::JsonDeserializationFailed), TEXT("JSON deserialization failed.") },
 		{ static_cast<int32>(ErrorCodes::NetworkError), TEXT("There is no response.") },
 		{ static_cast<int32>(ErrorCodes::IsNotLoggedIn), TEXT("User not logged in.") },
+		{ static_cast<int32>(ErrorCodes::HttpRequestJournaled), TEXT("There is no response, the request is journaled and will be replayed.") },
 		{ static_cast<int32>(ErrorCodes::WebSocketConnectFailed), TEXT("WebSocket connect failed.") },
+		{ static_cast<int32>(ErrorCodes::WebSocketRequestTimeout), TEXT("There is no response to the WebSocket request.") },
 
 
 	};
@@ -296,7 +298,7 @@ namespace AccelByte
 		}
 		else
 		{
-			Code = (int32)ErrorCodes::NetworkError;
+			Code = FHttpRequestJournal::IsJournaled(Request) ? (int32)ErrorCodes::HttpRequestJournaled : (int32)ErrorCodes::NetworkError;
 		}
 
 		auto it = ErrorMessages::Default.find(Code);
@@ -0,0 +1,133 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteHttpAuthorization.h"
+#include "Misc/ScopeLock.h"
+
+namespace AccelByte
+{
+
+namespace
+{
+	const FString BearerPrefix = TEXT("Bearer ");
+}
+
+void FHttpAuthorization::SetAccessToken(const FString& AccessToken)
+{
+	if (AccessToken.IsEmpty())
+	{
+		Reset();
+		return;
+	}
+
+	FString NewHeader;
+	NewHeader.Reserve(BearerPrefix.Len() + AccessToken.Len());
+	NewHeader += BearerPrefix;
+	NewHeader += AccessToken;
+	Publish(MakeShared<FString, ESPMode::ThreadSafe>(MoveTemp(NewHeader)));
+
+	EndRefresh();
+}
+
+void FHttpAuthorization::Reset()
+{
+	Publish(MakeShared<FString, ESPMode::ThreadSafe>());
+
+	EndRefresh();
+}
+
+void FHttpAuthorization::Publish(const FHttpAuthorizationHeaderRef& NewHeader)
+{
+	// readers hold on to the value they copied, the old one is freed by whoever drops it last
+	FScopeLock Lock(&HeaderLock);
+	Header = NewHeader;
+	Generation++;
+}
+
+FHttpAuthorizationHeaderRef FHttpAuthorization::GetHeader() const
+{
+	FScopeLock Lock(&HeaderLock);
+	return Header;
+}
+
+FHttpAuthorizationHeaderRef FHttpAuthorization::GetHeader(uint32& OutGeneration) const
+{
+	FScopeLock Lock(&HeaderLock);
+	OutGeneration = Generation;
+	return Header;
+}
+
+uint32 FHttpAuthorization::GetGeneration() const
+{
+	FScopeLock Lock(&HeaderLock);
+	return Generation;
+}
+
+bool FHttpAuthorization::HasToken() const
+{
+	return !GetHeader()->IsEmpty();
+}
+
+bool FHttpAuthorization::Resign(const FHttpRequestPtr& Request, uint32& InOutGeneration) const
+{
+	uint32 CurrentGeneration = 0;
+	const FHttpAuthorizationHeaderRef CurrentHeader = GetHeader(CurrentGeneration);
+	if (InOutGeneration == CurrentGeneration || CurrentHeader->IsEmpty())
+	{
+		return false;
+	}
+
+	Request->SetHeader(TEXT("Authorization"), *CurrentHeader);
+	InOutGeneration = CurrentGeneration;
+
+	return true;
+}
+
+void FHttpAuthorization::BeginRefresh()
+{
+	bRefreshing = true;
+}
+
+void FHttpAuthorization::EndRefresh()
+{
+	if (!bRefreshing)
+	{
+		return;
+	}
+
+	bRefreshing = false;
+	RefreshEnded.Broadcast();
+}
+
+bool FHttpAuthorization::IsRefreshing() const
+{
+	return bRefreshing;
+}
+
+void FHttpAuthorization::SetRefreshHandler(const FHttpAuthorizationRefreshDelegate& Handler)
+{
+	RefreshHandler = Handler;
+}
+
+bool FHttpAuthorization::RequestRefresh()
+{
+	if (bRefreshing)
+	{
+		return true;
+	}
+
+	if (!RefreshHandler.IsBound() || !RefreshHandler.Execute())
+	{
+		return false;
+	}
+
+	return bRefreshing;
+}
+
+FSimpleMulticastDelegate& FHttpAuthorization::OnRefreshEnded()
+{
+	return RefreshEnded;
+}
+
+}
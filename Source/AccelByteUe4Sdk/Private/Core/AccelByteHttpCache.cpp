@@ -0,0 +1,579 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteHttpCache.h"
+#include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteTimerService.h"
+#include "Async/Async.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "HAL/FileManager.h"
+#include "Misc/ScopeRWLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteHttpCache, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteHttpCache);
+
+namespace AccelByte
+{
+
+namespace
+{
+	const int32 DiskCacheVersion = 1;
+
+	/**
+	 * @brief Response served from the cache, behaves like the response it was copied from.
+	 */
+	class FHttpCachedResponse : public IHttpResponse
+	{
+	public:
+		FHttpCachedResponse(const FString& Url, int32 ResponseCode, const TArray<FString>& Headers, const TArray<uint8>& Content)
+			: Url(Url)
+			, ResponseCode(ResponseCode)
+			, Headers(Headers)
+			, Content(Content)
+		{
+		}
+
+		virtual FString GetURL() const override
+		{
+			return Url;
+		}
+
+		virtual FString GetURLParameter(const FString& ParameterName) const override
+		{
+			TArray<FString> Parameters;
+			Url.RightChop(Url.Find(TEXT("?")) + 1).ParseIntoArray(Parameters, TEXT("&"));
+			for (const FString& Parameter : Parameters)
+			{
+				FString Key;
+				FString Value;
+				if (Parameter.Split(TEXT("="), &Key, &Value) && Key == ParameterName)
+				{
+					return Value;
+				}
+			}
+
+			return FString();
+		}
+
+		virtual FString GetHeader(const FString& HeaderName) const override
+		{
+			for (const FString& Header : Headers)
+			{
+				FString Key;
+				FString Value;
+				if (Header.Split(TEXT(":"), &Key, &Value) && Key.TrimStartAndEnd().Equals(HeaderName, ESearchCase::IgnoreCase))
+				{
+					return Value.TrimStartAndEnd();
+				}
+			}
+
+			return FString();
+		}
+
+		virtual TArray<FString> GetAllHeaders() const override
+		{
+			return Headers;
+		}
+
+		virtual FString GetContentType() const override
+		{
+			return GetHeader(TEXT("Content-Type"));
+		}
+
+		virtual int32 GetContentLength() const override
+		{
+			return Content.Num();
+		}
+
+		virtual const TArray<uint8>& GetContent() const override
+		{
+			return Content;
+		}
+
+		virtual int32 GetResponseCode() const override
+		{
+			return ResponseCode;
+		}
+
+		virtual FString GetContentAsString() const override
+		{
+			// content is not null terminated
+			TArray<uint8> ZeroTerminatedContent(Content);
+			ZeroTerminatedContent.Add(0);
+
+			return UTF8_TO_TCHAR(ZeroTerminatedContent.GetData());
+		}
+
+	private:
+		const FString Url;
+		const int32 ResponseCode;
+		const TArray<FString> Headers;
+		const TArray<uint8> Content;
+	};
+
+	int64 GetResponseSize(const FString& Url, const FHttpResponsePtr& Response)
+	{
+		int64 Size = Url.Len() * sizeof(TCHAR) + Response->GetContent().Num();
+		for (const FString& Header : Response->GetAllHeaders())
+		{
+			Size += Header.Len() * sizeof(TCHAR);
+		}
+
+		return Size;
+	}
+}
+
+const int64 FHttpResponseCache::DefaultMemoryBudget = 4 * 1024 * 1024;
+
+void FHttpResponseCache::SetTtl(const FString& UrlPrefix, double TtlSeconds)
+{
+	if (UrlPrefix.IsEmpty())
+	{
+		return;
+	}
+
+	FRWScopeLock WriteLock(TtlLock, SLT_Write);
+	TPair<FString, double>* Ttl = Ttls.FindByPredicate([&UrlPrefix](const TPair<FString, double>& Entry) { return Entry.Key == UrlPrefix; });
+	if (Ttl != nullptr)
+	{
+		Ttl->Value = TtlSeconds;
+		return;
+	}
+
+	Ttls.Add(TPair<FString, double>(UrlPrefix, TtlSeconds));
+	Ttls.Sort([](const TPair<FString, double>& A, const TPair<FString, double>& B) { return A.Key.Len() > B.Key.Len(); });
+}
+
+double FHttpResponseCache::GetTtl(const FString& Url) const
+{
+	for (const auto& Ttl : Ttls)
+	{
+		if (Url.StartsWith(Ttl.Key))
+		{
+			return FMath::Max(0.0, Ttl.Value);
+		}
+	}
+
+	return 0.0;
+}
+
+void FHttpResponseCache::CopyTtls(const FHttpResponseCache& Other)
+{
+	if (&Other == this)
+	{
+		return;
+	}
+
+	FRWScopeLock ReadLock(Other.TtlLock, SLT_ReadOnly);
+	FRWScopeLock WriteLock(TtlLock, SLT_Write);
+	Ttls = Other.Ttls;
+}
+
+void FHttpResponseCache::SetMemoryBudget(int64 Bytes)
+{
+	MemoryBudget = Bytes;
+	TrimToBudget();
+}
+
+void FHttpResponseCache::SetDiskCacheDirectory(const FString& Directory)
+{
+	// what is waiting for a write belongs to the old directory
+	FRegistry::TimerService.RemoveTimer(DiskFlushHandle);
+	WaitForDiskWrite();
+	FlushToDisk();
+
+	DiskCacheDirectory = Directory;
+	LoadDiskCache();
+}
+
+void FHttpResponseCache::SetDiskFlushDelay(double Seconds)
+{
+	DiskFlushDelay = FMath::Max(Seconds, 0.0);
+}
+
+bool FHttpResponseCache::IsCacheable(const FHttpRequestPtr& Request) const
+{
+	return Request.IsValid() && Request->GetVerb() == TEXT("GET") && GetTtl(Request->GetURL()) > 0.0;
+}
+
+EHttpCacheLookup FHttpResponseCache::Lookup(const FHttpRequestPtr& Request, FHttpResponsePtr& OutResponse)
+{
+	MergeDiskEntries();
+
+	const FString Url = Request->GetURL();
+	FCacheEntry* Entry = FindEntry(Url);
+	if (Entry == nullptr)
+	{
+		Stats.Misses++;
+		return EHttpCacheLookup::Miss;
+	}
+
+	Touch(*Entry);
+
+	if (FDateTime::UtcNow() < Entry->ExpiresAt)
+	{
+		Stats.Hits++;
+		Stats.BytesServed += Entry->Response->GetContent().Num();
+		OutResponse = Entry->Response;
+		return EHttpCacheLookup::Fresh;
+	}
+
+	if (Entry->ETag.IsEmpty() && Entry->LastModified.IsEmpty())
+	{
+		Stats.Misses++;
+		return EHttpCacheLookup::Miss;
+	}
+
+	if (!Entry->ETag.IsEmpty())
+	{
+		Request->SetHeader(TEXT("If-None-Match"), Entry->ETag);
+	}
+	if (!Entry->LastModified.IsEmpty())
+	{
+		Request->SetHeader(TEXT("If-Modified-Since"), Entry->LastModified);
+	}
+	OutResponse = Entry->Response;
+
+	return EHttpCacheLookup::Stale;
+}
+
+FHttpResponsePtr FHttpResponseCache::OnResponse(const FHttpRequestPtr& Request, const FHttpResponsePtr& Response, const FHttpResponsePtr& RevalidatedResponse)
+{
+	if (!Response.IsValid())
+	{
+		return Response;
+	}
+
+	const FString Url = Request->GetURL();
+	const double TtlSeconds = GetTtl(Url);
+	const FDateTime ExpiresAt = FDateTime::UtcNow() + FTimespan::FromSeconds(TtlSeconds);
+
+	if (Response->GetResponseCode() == EHttpResponseCodes::NotModified)
+	{
+		FCacheEntry* Entry = FindEntry(Url);
+		if (Entry == nullptr && RevalidatedResponse.IsValid())
+		{
+			// evicted while revalidating, the response the request was made for is still the one the server confirmed
+			Entry = &AddEntry(Url, RevalidatedResponse, RevalidatedResponse->GetHeader(TEXT("ETag")), RevalidatedResponse->GetHeader(TEXT("Last-Modified")), ExpiresAt);
+		}
+		if (Entry == nullptr)
+		{
+			Stats.Misses++;
+			return Response;
+		}
+
+		Stats.Revalidations++;
+		Stats.BytesServed += Entry->Response->GetContent().Num();
+		Entry->ExpiresAt = ExpiresAt;
+		MarkDirty(*Entry);
+
+		const FHttpResponsePtr CachedResponse = Entry->Response;
+		TrimToBudget();
+
+		return CachedResponse;
+	}
+
+	// plain misses were counted by Lookup, a conditional request only turns into one here
+	if (!Request->GetHeader(TEXT("If-None-Match")).IsEmpty() || !Request->GetHeader(TEXT("If-Modified-Since")).IsEmpty())
+	{
+		Stats.Misses++;
+	}
+
+	if (Response->GetResponseCode() != EHttpResponseCodes::Ok || TtlSeconds <= 0.0 ||
+		Response->GetHeader(TEXT("Cache-Control")).Contains(TEXT("no-store")))
+	{
+		return Response;
+	}
+
+	const FHttpResponsePtr CachedResponse = MakeShared<FHttpCachedResponse, ESPMode::ThreadSafe>(Url, Response->GetResponseCode(), Response->GetAllHeaders(), Response->GetContent());
+	const FCacheEntry& Entry = AddEntry(Url, CachedResponse, Response->GetHeader(TEXT("ETag")), Response->GetHeader(TEXT("Last-Modified")), ExpiresAt);
+	MarkDirty(Entry);
+	TrimToBudget();
+
+	return Response;
+}
+
+void FHttpResponseCache::Close()
+{
+	FRegistry::TimerService.RemoveTimer(DiskFlushHandle);
+
+	// the last responses of the session are written before the cache goes away
+	WaitForDiskWrite();
+	FlushToDisk();
+	WaitForDiskWrite();
+}
+
+void FHttpResponseCache::Clear()
+{
+	Entries.Empty();
+	LruList.Empty();
+	Stats.MemoryBytes = 0;
+	Stats.Entries = 0;
+
+	FRegistry::TimerService.RemoveTimer(DiskFlushHandle);
+	DirtyUrls.Empty();
+	LoadedDiskEntries = MakeShared<FDiskEntryQueue, ESPMode::ThreadSafe>();
+
+	if (!DiskCacheDirectory.IsEmpty())
+	{
+		WaitForDiskWrite();
+		IFileManager::Get().DeleteDirectory(*DiskCacheDirectory, false, true);
+		IFileManager::Get().MakeDirectory(*DiskCacheDirectory, true);
+	}
+}
+
+const FHttpCacheStats& FHttpResponseCache::GetStats() const
+{
+	return Stats;
+}
+
+FHttpResponseCache::FCacheEntry* FHttpResponseCache::FindEntry(const FString& Url)
+{
+	return Entries.Find(Url);
+}
+
+FHttpResponseCache::FCacheEntry& FHttpResponseCache::AddEntry(const FString& Url, const FHttpResponsePtr& CachedResponse, const FString& ETag, const FString& LastModified, const FDateTime& ExpiresAt)
+{
+	RemoveEntry(Url);
+
+	FCacheEntry& Entry = Entries.Add(Url);
+	Entry.Url = Url;
+	Entry.Response = CachedResponse;
+	Entry.ETag = ETag;
+	Entry.LastModified = LastModified;
+	Entry.ExpiresAt = ExpiresAt;
+	Entry.Size = GetResponseSize(Url, CachedResponse);
+
+	LruList.AddHead(Url);
+	Entry.LruNode = LruList.GetHead();
+
+	Stats.MemoryBytes += Entry.Size;
+	Stats.Entries = Entries.Num();
+
+	return Entry;
+}
+
+void FHttpResponseCache::RemoveEntry(const FString& Url)
+{
+	FCacheEntry* Entry = Entries.Find(Url);
+	if (Entry == nullptr)
+	{
+		return;
+	}
+
+	LruList.RemoveNode(Entry->LruNode);
+	Stats.MemoryBytes -= Entry->Size;
+	Entries.Remove(Url);
+	Stats.Entries = Entries.Num();
+}
+
+void FHttpResponseCache::Touch(FCacheEntry& Entry)
+{
+	if (Entry.LruNode == LruList.GetHead())
+	{
+		return;
+	}
+
+	LruList.RemoveNode(Entry.LruNode);
+	LruList.AddHead(Entry.Url);
+	Entry.LruNode = LruList.GetHead();
+}
+
+void FHttpResponseCache::TrimToBudget()
+{
+	// the most recent entry is kept even when it alone is over the budget
+	while (Stats.MemoryBytes > MemoryBudget && Entries.Num() > 1)
+	{
+		const FString Url = LruList.GetTail()->GetValue();
+		UE_LOG(LogAccelByteHttpCache, Verbose, TEXT("Evicting %s"), *Url);
+		RemoveEntry(Url);
+		Stats.Evictions++;
+	}
+}
+
+FString FHttpResponseCache::GetDiskPath(const FString& Url) const
+{
+	return FPaths::Combine(DiskCacheDirectory, FMD5::HashAnsiString(*Url) + TEXT(".bin"));
+}
+
+void FHttpResponseCache::LoadDiskCache()
+{
+	// a load still running for the old directory or before a clear fills a queue nobody reads anymore
+	LoadedDiskEntries = MakeShared<FDiskEntryQueue, ESPMode::ThreadSafe>();
+	if (DiskCacheDirectory.IsEmpty())
+	{
+		return;
+	}
+
+	Async(EAsyncExecution::ThreadPool, [Directory = DiskCacheDirectory, Queue = LoadedDiskEntries, Budget = MemoryBudget]()
+	{
+		IFileManager::Get().MakeDirectory(*Directory, true);
+
+		TArray<FString> FileNames;
+		IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(Directory, TEXT("*.bin")), true, false);
+
+		// more than fits in memory would only be evicted again
+		int64 LoadedBytes = 0;
+		for (const FString& FileName : FileNames)
+		{
+			FDiskEntry Entry;
+			if (LoadedBytes >= Budget || !ReadDiskEntry(FPaths::Combine(Directory, FileName), Entry))
+			{
+				continue;
+			}
+
+			LoadedBytes += Entry.Content.Num();
+			Queue->Enqueue(MoveTemp(Entry));
+		}
+	});
+}
+
+void FHttpResponseCache::MergeDiskEntries()
+{
+	bool bMerged = false;
+	FDiskEntry DiskEntry;
+	while (LoadedDiskEntries->Dequeue(DiskEntry))
+	{
+		// a response received while the disk cache was loading is newer than the persisted one
+		if (Entries.Contains(DiskEntry.Url))
+		{
+			continue;
+		}
+
+		const FHttpResponsePtr CachedResponse = MakeShared<FHttpCachedResponse, ESPMode::ThreadSafe>(DiskEntry.Url, DiskEntry.ResponseCode, DiskEntry.Headers, DiskEntry.Content);
+		AddEntry(DiskEntry.Url, CachedResponse, DiskEntry.ETag, DiskEntry.LastModified, DiskEntry.ExpiresAt);
+		bMerged = true;
+	}
+
+	if (bMerged)
+	{
+		TrimToBudget();
+	}
+}
+
+void FHttpResponseCache::MarkDirty(const FCacheEntry& Entry)
+{
+	if (DiskCacheDirectory.IsEmpty())
+	{
+		return;
+	}
+
+	DirtyUrls.Add(Entry.Url);
+	ScheduleDiskFlush();
+}
+
+void FHttpResponseCache::ScheduleDiskFlush()
+{
+	if (DiskFlushHandle.IsValid())
+	{
+		return;
+	}
+
+	DiskFlushHandle = FRegistry::TimerService.AddTimer(FPlatformTime::Seconds() + DiskFlushDelay, FSimpleDelegate::CreateLambda([this]()
+	{
+		DiskFlushHandle.Reset();
+		FlushToDisk();
+	}));
+}
+
+void FHttpResponseCache::FlushToDisk()
+{
+	if (DirtyUrls.Num() == 0 || DiskCacheDirectory.IsEmpty())
+	{
+		DirtyUrls.Empty();
+		return;
+	}
+
+	// one batch at a time, so an older batch never overwrites a newer one, the next timer picks the dirty entries up
+	if (PendingDiskWrite.IsValid() && !PendingDiskWrite.IsReady())
+	{
+		ScheduleDiskFlush();
+		return;
+	}
+
+	// serialized here, the worker only touches its own copies
+	TArray<TPair<FString, TArray<uint8>>> Files;
+	for (const FString& Url : DirtyUrls)
+	{
+		// an entry evicted since it was marked keeps the version of its last write
+		if (const FCacheEntry* Entry = FindEntry(Url))
+		{
+			Files.Emplace(GetDiskPath(Url), SerializeEntry(*Entry));
+		}
+	}
+	DirtyUrls.Empty();
+
+	PendingDiskWrite = Async(EAsyncExecution::ThreadPool, [Files = MoveTemp(Files)]()
+	{
+		for (const auto& File : Files)
+		{
+			if (!FFileHelper::SaveArrayToFile(File.Value, *File.Key))
+			{
+				UE_LOG(LogAccelByteHttpCache, Warning, TEXT("Failed to write cache file %s"), *File.Key);
+			}
+		}
+	});
+}
+
+void FHttpResponseCache::WaitForDiskWrite()
+{
+	if (PendingDiskWrite.IsValid())
+	{
+		PendingDiskWrite.Wait();
+		PendingDiskWrite.Reset();
+	}
+}
+
+bool FHttpResponseCache::ReadDiskEntry(const FString& Path, FDiskEntry& OutEntry)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *Path, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Data);
+	int32 Version = 0;
+	int64 ExpiresAtTicks = 0;
+
+	Reader << Version;
+	if (Version != DiskCacheVersion)
+	{
+		return false;
+	}
+
+	Reader << OutEntry.Url << OutEntry.ResponseCode << OutEntry.Headers << OutEntry.Content << OutEntry.ETag << OutEntry.LastModified << ExpiresAtTicks;
+	if (Reader.IsError() || FPaths::GetBaseFilename(Path) != FMD5::HashAnsiString(*OutEntry.Url))
+	{
+		UE_LOG(LogAccelByteHttpCache, Warning, TEXT("Ignoring corrupted cache file %s"), *Path);
+		return false;
+	}
+	OutEntry.ExpiresAt = FDateTime(ExpiresAtTicks);
+
+	return true;
+}
+
+TArray<uint8> FHttpResponseCache::SerializeEntry(const FCacheEntry& Entry)
+{
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	int32 Version = DiskCacheVersion;
+	FString Url = Entry.Url;
+	int32 ResponseCode = Entry.Response->GetResponseCode();
+	TArray<FString> Headers = Entry.Response->GetAllHeaders();
+	TArray<uint8> Content = Entry.Response->GetContent();
+	FString ETag = Entry.ETag;
+	FString LastModified = Entry.LastModified;
+	int64 ExpiresAtTicks = Entry.ExpiresAt.GetTicks();
+
+	Writer << Version << Url << ResponseCode << Headers << Content << ETag << LastModified << ExpiresAtTicks;
+
+	return Data;
+}
+
+}
@@ -0,0 +1,310 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteHttpEndpoint.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+
+namespace AccelByte
+{
+
+namespace
+{
+	const FString AuthorizationHeaderName = TEXT("Authorization");
+	const FString ContentTypeHeaderName = TEXT("Content-Type");
+	const FString AcceptHeaderName = TEXT("Accept");
+	const FString JsonContentType = TEXT("application/json");
+	const FString BearerPrefix = TEXT("Bearer ");
+
+	const FString& GetVerbString(EHttpVerb Verb)
+	{
+		static const FString Verbs[] = { TEXT("GET"), TEXT("POST"), TEXT("PUT"), TEXT("PATCH"), TEXT("DELETE") };
+
+		return Verbs[static_cast<int32>(Verb)];
+	}
+}
+
+FHttpRequestBuilder::FHttpRequestBuilder(const FHttpEndpoint& InEndpoint, const FString& BaseUrl)
+	: Endpoint(InEndpoint)
+	, TemplateCursor(InEndpoint.PathTemplate)
+	, BaseUrlLength(BaseUrl.Len())
+	, ContentTypeHeader(&JsonContentType)
+	, AcceptHeader(&JsonContentType)
+{
+	// room for the filled placeholders and a few query parameters, so the URL is allocated once
+	Url.Reserve(BaseUrl.Len() + FCString::Strlen(Endpoint.PathTemplate) + 128);
+	Url += BaseUrl;
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Path(const TCHAR* Name, const FString& Value)
+{
+	const TCHAR* Open = FCString::Strchr(TemplateCursor, TEXT('{'));
+	const TCHAR* Close = Open != nullptr ? FCString::Strchr(Open, TEXT('}')) : nullptr;
+	if (Close == nullptr)
+	{
+		ensureMsgf(false, TEXT("Path template %s has no placeholder left for %s"), Endpoint.PathTemplate, Name);
+		return *this;
+	}
+
+	const int32 NameLength = static_cast<int32>(Close - Open - 1);
+	ensureMsgf(FCString::Strlen(Name) == NameLength && FCString::Strncmp(Open + 1, Name, NameLength) == 0,
+		TEXT("Path parameter %s doesn't match the next placeholder of %s"), Name, Endpoint.PathTemplate);
+
+	Url.AppendChars(TemplateCursor, static_cast<int32>(Open - TemplateCursor));
+	Url += Value;
+	TemplateCursor = Close + 1;
+
+	return *this;
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Query(const TCHAR* Name, const FString& Value)
+{
+	if (Value.IsEmpty())
+	{
+		return *this;
+	}
+
+	FinishPath();
+	Url.AppendChar(bHasQuery ? TEXT('&') : TEXT('?'));
+	Url += Name;
+	Url.AppendChar(TEXT('='));
+	Url += Value;
+	bHasQuery = true;
+
+	return *this;
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Query(const TCHAR* Name, int32 Value)
+{
+	return Query(Name, FString::FromInt(Value));
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Query(const TCHAR* Name, uint32 Value)
+{
+	return Query(Name, FString::Printf(TEXT("%u"), Value));
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Query(const TCHAR* Name, bool Value)
+{
+	return Query(Name, Value ? FString(TEXT("true")) : FString(TEXT("false")));
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Query(const TCHAR* Name, const TArray<FString>& Values)
+{
+	if (Values.Num() == 0)
+	{
+		return *this;
+	}
+
+	FinishPath();
+	Url.AppendChar(bHasQuery ? TEXT('&') : TEXT('?'));
+	Url += Name;
+	Url.AppendChar(TEXT('='));
+	// each value is encoded on its own, the separator stays a literal comma
+	for (int32 i = 0; i < Values.Num(); i++)
+	{
+		if (i > 0)
+		{
+			Url.AppendChar(TEXT(','));
+		}
+		Url += FGenericPlatformHttp::UrlEncode(Values[i]);
+	}
+	bHasQuery = true;
+
+	return *this;
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Authorization(const FHttpAuthorizationRef& InAuthorization)
+{
+	AuthorizationRef = InAuthorization;
+	AuthorizationHeader.Empty();
+
+	return *this;
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Bearer(const FString& AccessToken)
+{
+	AuthorizationRef.Reset();
+	AuthorizationHeader.Reset(BearerPrefix.Len() + AccessToken.Len());
+	AuthorizationHeader += BearerPrefix;
+	AuthorizationHeader += AccessToken;
+
+	return *this;
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Authorization(const FString& HeaderValue)
+{
+	AuthorizationRef.Reset();
+	AuthorizationHeader = HeaderValue;
+
+	return *this;
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Header(const FString& Name, const FString& Value)
+{
+	ExtraHeaders.Add(TPair<FString, FString>(Name, Value));
+
+	return *this;
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::ContentType(const FString& Value)
+{
+	Header(ContentTypeHeaderName, Value);
+	ContentTypeHeader = nullptr;
+
+	return *this;
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Accept(const FString& Value)
+{
+	Header(AcceptHeaderName, Value);
+	AcceptHeader = nullptr;
+
+	return *this;
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Content(const FString& Body)
+{
+	StringContent = Body;
+	bBinaryContent = false;
+
+	return *this;
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Content(FString&& Body)
+{
+	StringContent = MoveTemp(Body);
+	bBinaryContent = false;
+
+	return *this;
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Content(const TArray<uint8>& Body)
+{
+	BinaryContent = Body;
+	bBinaryContent = true;
+
+	return *this;
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Content(TArray<uint8>&& Body)
+{
+	// uploads can be megabytes, don't copy them twice on the way to the request
+	BinaryContent = MoveTemp(Body);
+	bBinaryContent = true;
+
+	return *this;
+}
+
+FHttpRequestBuilder& FHttpRequestBuilder::Progress(const FHttpRequestProgressDelegate& OnProgress)
+{
+	ProgressDelegate = OnProgress;
+
+	return *this;
+}
+
+const FHttpEndpoint& FHttpRequestBuilder::GetEndpoint() const
+{
+	return Endpoint;
+}
+
+const FString& FHttpRequestBuilder::GetUrl()
+{
+	FinishPath();
+
+	return Url;
+}
+
+FString FHttpRequestBuilder::GetRouteTemplate() const
+{
+	// the base path tells services apart, their templates alone often collide, e.g. /v1/public/namespaces/{namespace}
+	int32 HostStart = Url.Find(TEXT("://"));
+	HostStart = HostStart == INDEX_NONE ? 0 : HostStart + 3;
+	int32 BasePathStart = Url.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, HostStart);
+	if (BasePathStart == INDEX_NONE || BasePathStart > BaseUrlLength)
+	{
+		BasePathStart = BaseUrlLength;
+	}
+
+	FString Route;
+	Route.Reserve(8 + BaseUrlLength - BasePathStart + FCString::Strlen(Endpoint.PathTemplate));
+	Route += GetVerbString(Endpoint.Verb);
+	Route += TEXT(" ");
+	Route.AppendChars(*Url + BasePathStart, BaseUrlLength - BasePathStart);
+	Route += Endpoint.PathTemplate;
+
+	return Route;
+}
+
+const FHttpAuthorizationPtr& FHttpRequestBuilder::GetAuthorization() const
+{
+	return AuthorizationRef;
+}
+
+uint32 FHttpRequestBuilder::GetAuthorizationGeneration() const
+{
+	return AuthorizationGeneration;
+}
+
+FHttpRequestPtr FHttpRequestBuilder::Build()
+{
+	FinishPath();
+
+	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
+	Request->SetURL(Url);
+	Request->SetVerb(GetVerbString(Endpoint.Verb));
+	AuthorizationGeneration = 0;
+	if (AuthorizationRef.IsValid())
+	{
+		const FHttpAuthorizationHeaderRef AuthorizationValue = AuthorizationRef->GetHeader(AuthorizationGeneration);
+		if (!AuthorizationValue->IsEmpty())
+		{
+			Request->SetHeader(AuthorizationHeaderName, *AuthorizationValue);
+		}
+	}
+	else if (!AuthorizationHeader.IsEmpty())
+	{
+		Request->SetHeader(AuthorizationHeaderName, AuthorizationHeader);
+	}
+	if (ContentTypeHeader != nullptr)
+	{
+		Request->SetHeader(ContentTypeHeaderName, *ContentTypeHeader);
+	}
+	if (AcceptHeader != nullptr)
+	{
+		Request->SetHeader(AcceptHeaderName, *AcceptHeader);
+	}
+	for (const auto& ExtraHeader : ExtraHeaders)
+	{
+		Request->SetHeader(ExtraHeader.Key, ExtraHeader.Value);
+	}
+
+	if (bBinaryContent)
+	{
+		Request->SetContent(BinaryContent);
+	}
+	else if (!StringContent.IsEmpty())
+	{
+		Request->SetContentAsString(StringContent);
+	}
+	if (ProgressDelegate.IsBound())
+	{
+		Request->OnRequestProgress() = ProgressDelegate;
+	}
+
+	return Request;
+}
+
+void FHttpRequestBuilder::FinishPath()
+{
+	if (*TemplateCursor == TEXT('\0'))
+	{
+		return;
+	}
+
+	ensureMsgf(FCString::Strchr(TemplateCursor, TEXT('{')) == nullptr, TEXT("Path template %s has unfilled placeholders"), Endpoint.PathTemplate);
+	Url += TemplateCursor;
+	TemplateCursor += FCString::Strlen(TemplateCursor);
+}
+
+}
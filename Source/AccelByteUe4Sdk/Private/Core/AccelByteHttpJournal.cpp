@@ -0,0 +1,500 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteHttpJournal.h"
+#include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteTimerService.h"
+#include "Async/Async.h"
+#include "HAL/PlatformFilemanager.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteHttpJournal, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteHttpJournal);
+
+namespace AccelByte
+{
+
+namespace
+{
+	const int32 FlushThresholdBytes = 64 * 1024;
+	const int32 MinRewriteRecordCount = 256;
+	const int32 MaxReplayBackoffDoublings = 8;
+	const FString AuthorizationHeaderName = TEXT("Authorization");
+
+	bool IsSameWrite(const FString& VerbA, const FString& UrlA, const FString& VerbB, const FString& UrlB)
+	{
+		return VerbA == VerbB && UrlA == UrlB;
+	}
+}
+
+const double FHttpRequestJournal::DefaultReplayInterval = 15.0;
+const IHttpRequest* FHttpRequestJournal::CompletingJournaledRequest = nullptr;
+
+FHttpRequestJournal::FHttpRequestJournal(FHttpRetryScheduler& InScheduler)
+	: Scheduler(InScheduler)
+{
+}
+
+FHttpRequestJournal::~FHttpRequestJournal()
+{
+	Close();
+}
+
+void FHttpRequestJournal::AddRule(const FString& Pattern, EHttpJournalMode Mode)
+{
+	Rules.Add({ Pattern, Mode });
+}
+
+bool FHttpRequestJournal::Open(const FString& InFilePath, const FHttpAuthorizationRef& InAuthorization)
+{
+	Close();
+
+	FilePath = InFilePath;
+	Authorization = InAuthorization;
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+
+	TArray<uint8> Data;
+	if (FFileHelper::LoadFileToArray(Data, *FilePath, FILEREAD_Silent))
+	{
+		Load(Data);
+	}
+
+	// every open starts from a compacted file, superseded and replayed writes are gone from it
+	if (!Rewrite())
+	{
+		UE_LOG(LogAccelByteHttpJournal, Warning, TEXT("Failed to open request journal %s"), *FilePath);
+		Entries.Empty();
+		return false;
+	}
+
+	UE_LOG(LogAccelByteHttpJournal, Log, TEXT("Opened request journal %s with %d pending writes"), *FilePath, Entries.Num());
+	if (Entries.Num() > 0)
+	{
+		ScheduleReplay(0.0);
+	}
+
+	return true;
+}
+
+void FHttpRequestJournal::Close()
+{
+	FRegistry::TimerService.RemoveTimer(ReplayHandle);
+	FRegistry::TimerService.RemoveTimer(FlushHandle);
+	FlushToDisk();
+	// pending writes stay durable for the next open
+	WaitForWrite();
+
+	FileHandle.Reset();
+	Authorization.Reset();
+	Entries.Empty();
+	PendingBytes.Empty();
+	RemovedRecordCount = 0;
+	ReplayRequest.Reset();
+	ReplayEntryId = 0;
+	ReplayFailures = 0;
+}
+
+bool FHttpRequestJournal::IsOpen() const
+{
+	return FileHandle.IsValid();
+}
+
+bool FHttpRequestJournal::OnRequestFinished(const FHttpRequestPtr& Request, const FHttpResponsePtr& Response)
+{
+	if (!IsOpen() || Rules.Num() == 0 || Request == ReplayRequest)
+	{
+		return false;
+	}
+
+	if (Response.IsValid() && Entries.Num() > 0 && ReplayFailures > 0 && !ReplayRequest.IsValid())
+	{
+		// the network is back, no need to wait for the rest of the backoff
+		ScheduleReplay(0.0);
+	}
+
+	const FString Verb = Request->GetVerb();
+	if (Verb == TEXT("GET"))
+	{
+		return false;
+	}
+
+	const FString Url = Request->GetURL();
+	const FRule* Rule = FindRule(Verb, Url);
+	if (Rule == nullptr)
+	{
+		return false;
+	}
+
+	if (Response.IsValid())
+	{
+		// a newer write that made it replaces the journaled one, replaying the old one would undo it
+		if (Rule->Mode == EHttpJournalMode::Supersede && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+		{
+			for (int32 i = Entries.Num() - 1; i >= 0; i--)
+			{
+				if (Entries[i].Id != ReplayEntryId && IsSameWrite(Entries[i].Verb, Entries[i].Url, Verb, Url))
+				{
+					RemoveEntry(i);
+				}
+			}
+		}
+		return false;
+	}
+
+	FEntry Entry;
+	Entry.Mode = Rule->Mode;
+	Entry.Verb = Verb;
+	Entry.Url = Url;
+	for (const FString& Header : Request->GetAllHeaders())
+	{
+		// signed again with the token of the time of the replay
+		if (!Header.StartsWith(AuthorizationHeaderName + TEXT(":"), ESearchCase::IgnoreCase))
+		{
+			Entry.Headers.Add(Header);
+		}
+	}
+	Entry.Content = Request->GetContent();
+
+	UE_LOG(LogAccelByteHttpJournal, Log, TEXT("Journaled %s %s until the network is back"), *Verb, *Url);
+	AddEntry(MoveTemp(Entry));
+	QueuedDelegate.Broadcast(Url);
+
+	if (!ReplayHandle.IsValid() && !ReplayRequest.IsValid())
+	{
+		ScheduleReplay(ReplayInterval);
+	}
+
+	return true;
+}
+
+bool FHttpRequestJournal::IsJournaled(const FHttpRequestPtr& Request)
+{
+	return Request.IsValid() && Request.Get() == CompletingJournaledRequest;
+}
+
+void FHttpRequestJournal::Replay()
+{
+	if (!IsOpen() || ReplayRequest.IsValid() || Entries.Num() == 0)
+	{
+		return;
+	}
+
+	FRegistry::TimerService.RemoveTimer(ReplayHandle);
+
+	if (!Authorization.IsValid() || !Authorization->HasToken() || Authorization->IsRefreshing())
+	{
+		ScheduleReplay(ReplayInterval);
+		return;
+	}
+
+	const FEntry& Entry = Entries[0];
+	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
+	Request->SetVerb(Entry.Verb);
+	Request->SetURL(Entry.Url);
+	for (const FString& Header : Entry.Headers)
+	{
+		FString Name;
+		FString Value;
+		if (Header.Split(TEXT(":"), &Name, &Value))
+		{
+			Request->SetHeader(Name.TrimStartAndEnd(), Value.TrimStartAndEnd());
+		}
+	}
+	Request->SetHeader(AuthorizationHeaderName, *Authorization->GetHeader());
+	Request->SetContent(Entry.Content);
+
+	ReplayRequest = Request;
+	ReplayEntryId = Entry.Id;
+
+	const FHttpRetryPolicy RetryPolicy = Entry.Mode == EHttpJournalMode::Append ? FHttpRetryPolicy::NonIdempotent() : Scheduler.GetRetryPolicy(Entry.Url);
+	if (!Scheduler.ProcessTask(Request, FHttpRequestCompleteDelegate::CreateRaw(this, &FHttpRequestJournal::OnReplayComplete), FPlatformTime::Seconds(), RetryPolicy, EHttpRequestPriority::Gameplay, Authorization, Authorization->GetGeneration(), FString()))
+	{
+		// the scheduler is shutting down or fails fast, try again later instead of waiting for the next write
+		ReplayRequest.Reset();
+		ReplayEntryId = 0;
+		ScheduleReplay(ReplayInterval);
+	}
+}
+
+int32 FHttpRequestJournal::GetPendingCount() const
+{
+	return Entries.Num();
+}
+
+void FHttpRequestJournal::SetReplayInterval(double Seconds)
+{
+	ReplayInterval = FMath::Max(Seconds, 1.0);
+}
+
+void FHttpRequestJournal::SetFlushDelay(double Seconds)
+{
+	FlushDelay = FMath::Max(Seconds, 0.0);
+}
+
+FHttpJournalQueuedDelegate& FHttpRequestJournal::OnQueued()
+{
+	return QueuedDelegate;
+}
+
+FHttpJournalReplayedDelegate& FHttpRequestJournal::OnReplayed()
+{
+	return ReplayedDelegate;
+}
+
+FHttpJournalFailedDelegate& FHttpRequestJournal::OnReplayFailed()
+{
+	return ReplayFailedDelegate;
+}
+
+const FHttpRequestJournal::FRule* FHttpRequestJournal::FindRule(const FString& Verb, const FString& Url) const
+{
+	const FString Write = Verb + TEXT(" ") + Url;
+
+	return Rules.FindByPredicate([&Write](const FRule& Rule) { return Write.MatchesWildcard(Rule.Pattern, ESearchCase::CaseSensitive); });
+}
+
+void FHttpRequestJournal::AddEntry(FEntry&& Entry)
+{
+	if (Entry.Mode == EHttpJournalMode::Supersede)
+	{
+		for (int32 i = Entries.Num() - 1; i >= 0; i--)
+		{
+			if (Entries[i].Id != ReplayEntryId && IsSameWrite(Entries[i].Verb, Entries[i].Url, Entry.Verb, Entry.Url))
+			{
+				RemoveEntry(i);
+			}
+		}
+	}
+
+	Entry.Id = NextId++;
+	AppendRecord(ERecordType::Add, Entry);
+	Entries.Add(MoveTemp(Entry));
+}
+
+void FHttpRequestJournal::RemoveEntry(int32 Index)
+{
+	AppendRecord(ERecordType::Remove, Entries[Index]);
+	Entries.RemoveAt(Index);
+
+	// the add and the remove record of the entry are both dead
+	RemovedRecordCount += 2;
+}
+
+void FHttpRequestJournal::AppendRecord(ERecordType Type, const FEntry& Entry)
+{
+	TArray<uint8> Record;
+	FMemoryWriter Writer(Record);
+	uint8 RecordType = static_cast<uint8>(Type);
+	uint64 Id = Entry.Id;
+	Writer << RecordType << Id;
+	if (Type == ERecordType::Add)
+	{
+		uint8 Mode = static_cast<uint8>(Entry.Mode);
+		FString Verb = Entry.Verb;
+		FString Url = Entry.Url;
+		TArray<FString> Headers = Entry.Headers;
+		TArray<uint8> Content = Entry.Content;
+		Writer << Mode << Verb << Url << Headers << Content;
+	}
+
+	// size prefixed, so a record torn by a crash is detected and dropped on the next load
+	int32 Size = Record.Num();
+	FMemoryWriter PendingWriter(PendingBytes, false, true);
+	PendingWriter << Size;
+	PendingBytes.Append(Record);
+
+	ScheduleFlush();
+}
+
+void FHttpRequestJournal::Load(const TArray<uint8>& Data)
+{
+	FMemoryReader Reader(Data);
+	while (Reader.Tell() + static_cast<int64>(sizeof(int32)) <= Data.Num())
+	{
+		int32 Size = 0;
+		Reader << Size;
+		if (Size <= 0 || Reader.Tell() + Size > Data.Num())
+		{
+			UE_LOG(LogAccelByteHttpJournal, Warning, TEXT("Dropping the torn tail of request journal %s"), *FilePath);
+			break;
+		}
+
+		const TArray<uint8> Record(Data.GetData() + Reader.Tell(), Size);
+		Reader.Seek(Reader.Tell() + Size);
+
+		FMemoryReader RecordReader(Record);
+		uint8 RecordType = 0;
+		uint64 Id = 0;
+		RecordReader << RecordType << Id;
+		NextId = FMath::Max(NextId, Id + 1);
+
+		if (RecordType == static_cast<uint8>(ERecordType::Remove))
+		{
+			Entries.RemoveAll([Id](const FEntry& Entry) { return Entry.Id == Id; });
+			continue;
+		}
+
+		FEntry Entry;
+		uint8 Mode = 0;
+		RecordReader << Mode << Entry.Verb << Entry.Url << Entry.Headers << Entry.Content;
+		if (RecordReader.IsError() || RecordType != static_cast<uint8>(ERecordType::Add))
+		{
+			UE_LOG(LogAccelByteHttpJournal, Warning, TEXT("Dropping a corrupted record of request journal %s"), *FilePath);
+			continue;
+		}
+
+		Entry.Id = Id;
+		Entry.Mode = static_cast<EHttpJournalMode>(Mode);
+		if (Entry.Mode == EHttpJournalMode::Supersede)
+		{
+			Entries.RemoveAll([&Entry](const FEntry& Other) { return IsSameWrite(Other.Verb, Other.Url, Entry.Verb, Entry.Url); });
+		}
+		Entries.Add(MoveTemp(Entry));
+	}
+}
+
+bool FHttpRequestJournal::Rewrite()
+{
+	FRegistry::TimerService.RemoveTimer(FlushHandle);
+	WaitForWrite();
+	FileHandle.Reset();
+	PendingBytes.Reset();
+	for (const FEntry& Entry : Entries)
+	{
+		AppendRecord(ERecordType::Add, Entry);
+	}
+
+	// written next to the journal and moved over it, so a crash leaves either the old or the new file
+	const FString TempFilePath = FilePath + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(PendingBytes, *TempFilePath) || !IFileManager::Get().Move(*FilePath, *TempFilePath, true))
+	{
+		return false;
+	}
+	PendingBytes.Reset();
+	RemovedRecordCount = 0;
+
+	FileHandle = TSharedPtr<IFileHandle, ESPMode::ThreadSafe>(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*FilePath, true));
+
+	return FileHandle.IsValid();
+}
+
+void FHttpRequestJournal::FlushToDisk()
+{
+	if (!FileHandle.IsValid() || PendingBytes.Num() == 0)
+	{
+		return;
+	}
+
+	// one write and one fsync for every record appended since the last flush, on a worker so the game thread never waits
+	// for the disk. Writes stay in order, the next flush waits for this one
+	WaitForWrite();
+	PendingWrite = Async(EAsyncExecution::ThreadPool, [File = FileHandle, Bytes = MoveTemp(PendingBytes), Path = FilePath]()
+	{
+		if (!File->Write(Bytes.GetData(), Bytes.Num()) || !File->Flush(true))
+		{
+			UE_LOG(LogAccelByteHttpJournal, Warning, TEXT("Failed to write request journal %s"), *Path);
+		}
+	});
+	PendingBytes.Reset();
+
+	if (RemovedRecordCount >= MinRewriteRecordCount && RemovedRecordCount > Entries.Num())
+	{
+		Rewrite();
+	}
+}
+
+void FHttpRequestJournal::WaitForWrite()
+{
+	if (PendingWrite.IsValid())
+	{
+		PendingWrite.Wait();
+		PendingWrite.Reset();
+	}
+}
+
+void FHttpRequestJournal::ScheduleFlush()
+{
+	if (!FileHandle.IsValid())
+	{
+		return;
+	}
+
+	if (PendingBytes.Num() >= FlushThresholdBytes)
+	{
+		FRegistry::TimerService.RemoveTimer(FlushHandle);
+		FlushToDisk();
+		return;
+	}
+
+	if (FlushHandle.IsValid())
+	{
+		return;
+	}
+
+	FlushHandle = FRegistry::TimerService.AddTimer(FPlatformTime::Seconds() + FlushDelay, FSimpleDelegate::CreateLambda([this]()
+	{
+		FlushHandle.Reset();
+		FlushToDisk();
+	}));
+}
+
+void FHttpRequestJournal::ScheduleReplay(double Delay)
+{
+	FRegistry::TimerService.RemoveTimer(ReplayHandle);
+	ReplayHandle = FRegistry::TimerService.AddTimer(FPlatformTime::Seconds() + Delay, FSimpleDelegate::CreateLambda([this]()
+	{
+		ReplayHandle.Reset();
+		Replay();
+	}));
+}
+
+void FHttpRequestJournal::OnReplayComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccessful)
+{
+	if (Request != ReplayRequest)
+	{
+		return;
+	}
+
+	const uint64 EntryId = ReplayEntryId;
+	ReplayRequest.Reset();
+	ReplayEntryId = 0;
+
+	const int32 ResponseCode = Response.IsValid() ? Response->GetResponseCode() : 0;
+	if (ResponseCode == 0 || ResponseCode >= EHttpResponseCodes::ServerError || ResponseCode == EHttpResponseCodes::TooManyRequests || ResponseCode == EHttpResponseCodes::Denied)
+	{
+		// still offline, the server is down or the token isn't valid yet, keep the write and back off
+		ReplayFailures++;
+		ScheduleReplay(ReplayInterval * FMath::Pow(2.0f, FMath::Min(ReplayFailures - 1, MaxReplayBackoffDoublings)));
+		return;
+	}
+
+	ReplayFailures = 0;
+
+	const int32 Index = Entries.IndexOfByPredicate([EntryId](const FEntry& Entry) { return Entry.Id == EntryId; });
+	if (Index != INDEX_NONE)
+	{
+		const FString Url = Entries[Index].Url;
+		RemoveEntry(Index);
+
+		if (EHttpResponseCodes::IsOk(ResponseCode))
+		{
+			UE_LOG(LogAccelByteHttpJournal, Log, TEXT("Replayed journaled %s"), *Url);
+			ReplayedDelegate.Broadcast(Url, ResponseCode);
+		}
+		else
+		{
+			UE_LOG(LogAccelByteHttpJournal, Warning, TEXT("Journaled %s was rejected with %d, dropping it"), *Url, ResponseCode);
+			ReplayFailedDelegate.Broadcast(Url, ResponseCode, Response->GetContentAsString());
+		}
+	}
+
+	Replay();
+}
+
+}
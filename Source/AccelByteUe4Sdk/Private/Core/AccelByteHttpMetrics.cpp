@@ -0,0 +1,236 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteHttpMetrics.h"
+#include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteTimerService.h"
+
+namespace AccelByte
+{
+
+namespace
+{
+	// values below 2 * SubBucketCount get a bucket each, above it every power of two is split in SubBucketCount buckets
+	const int32 SubBucketBits = 4;
+	const int32 SubBucketCount = 1 << SubBucketBits;
+	const int32 LinearBucketCount = SubBucketCount * 2;
+	const int32 MaxValueBits = 27;
+	const uint64 MaxValue = (1ull << MaxValueBits) - 1;
+	const int32 BucketCount = LinearBucketCount + (MaxValueBits - SubBucketBits - 1) * SubBucketCount;
+}
+
+void FHttpLatencyHistogram::Record(double Seconds)
+{
+	if (Buckets.Num() == 0)
+	{
+		Buckets.SetNumZeroed(BucketCount);
+	}
+
+	const double Value = FMath::Max(Seconds, 0.0);
+	const uint64 Microseconds = FMath::Min(static_cast<uint64>(Value * 1000000.0), MaxValue);
+	Buckets[GetBucketIndex(Microseconds)]++;
+	Count++;
+	Total += Value;
+	Max = FMath::Max(Max, Value);
+}
+
+double FHttpLatencyHistogram::GetPercentile(double Percent) const
+{
+	if (Count == 0)
+	{
+		return 0.0;
+	}
+
+	const int64 Rank = FMath::Clamp(static_cast<int64>(FMath::CeilToDouble(Percent / 100.0 * Count)), static_cast<int64>(1), Count);
+	int64 Seen = 0;
+	for (int32 i = 0; i < Buckets.Num(); i++)
+	{
+		Seen += Buckets[i];
+		if (Seen >= Rank)
+		{
+			return FMath::Min(GetBucketUpperBound(i) / 1000000.0, Max);
+		}
+	}
+
+	return Max;
+}
+
+int64 FHttpLatencyHistogram::GetCount() const
+{
+	return Count;
+}
+
+double FHttpLatencyHistogram::GetMean() const
+{
+	return Count > 0 ? Total / Count : 0.0;
+}
+
+double FHttpLatencyHistogram::GetMax() const
+{
+	return Max;
+}
+
+void FHttpLatencyHistogram::Reset()
+{
+	Buckets.Empty();
+	Count = 0;
+	Total = 0.0;
+	Max = 0.0;
+}
+
+int32 FHttpLatencyHistogram::GetBucketIndex(uint64 Microseconds)
+{
+	if (Microseconds < static_cast<uint64>(LinearBucketCount))
+	{
+		return static_cast<int32>(Microseconds);
+	}
+
+	const int32 Exponent = static_cast<int32>(FMath::FloorLog2_64(Microseconds));
+	const int32 Shift = Exponent - SubBucketBits;
+	const int32 SubBucket = static_cast<int32>(Microseconds >> Shift) - SubBucketCount;
+
+	return LinearBucketCount + (Exponent - SubBucketBits - 1) * SubBucketCount + SubBucket;
+}
+
+uint64 FHttpLatencyHistogram::GetBucketUpperBound(int32 Index)
+{
+	if (Index < LinearBucketCount)
+	{
+		return static_cast<uint64>(Index);
+	}
+
+	const int32 Exponent = (Index - LinearBucketCount) / SubBucketCount + SubBucketBits + 1;
+	const uint64 Mantissa = static_cast<uint64>((Index - LinearBucketCount) % SubBucketCount + SubBucketCount);
+
+	return ((Mantissa + 1) << (Exponent - SubBucketBits)) - 1;
+}
+
+const FString FHttpMetrics::OtherRoute = TEXT("other");
+
+FHttpMetrics::~FHttpMetrics()
+{
+	FRegistry::TimerService.RemoveTimer(SnapshotHandle);
+}
+
+void FHttpMetrics::SetEnabled(bool bInEnabled)
+{
+	bEnabled = bInEnabled;
+}
+
+bool FHttpMetrics::IsEnabled() const
+{
+	return bEnabled;
+}
+
+void FHttpMetrics::Record(const FHttpRequestPtr& Request, const FString& RouteTemplate, const FHttpResponsePtr& Response, int32 Attempts, double QueueWait, double Latency, double TimeToFirstByte)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	const FString Route = !RouteTemplate.IsEmpty()
+		? RouteTemplate
+		: FString::Printf(TEXT("%s %s"), *Request->GetVerb(), *HttpRequest::GetRouteTemplate(Request->GetURL()));
+	FHttpEndpointMetrics* Found = Endpoints.Find(Route);
+	if (Found == nullptr)
+	{
+		Found = &Endpoints.FindOrAdd(Endpoints.Num() < MaxRoutes ? Route : OtherRoute);
+	}
+	FHttpEndpointMetrics& Metrics = *Found;
+
+	const int32 ResponseCode = Response.IsValid() ? Response->GetResponseCode() : 0;
+	Metrics.RequestCount++;
+	Metrics.RetryCount += FMath::Max(Attempts - 1, 0);
+	if (ResponseCode == 0 || ResponseCode >= 400)
+	{
+		Metrics.ErrorCount++;
+	}
+	Metrics.BytesSent += static_cast<int64>(Request->GetContentLength()) * FMath::Max(Attempts, 0);
+	Metrics.BytesReceived += Response.IsValid() ? Response->GetContent().Num() : 0;
+	Metrics.TotalQueueWait += QueueWait;
+	Metrics.MaxQueueWait = FMath::Max(Metrics.MaxQueueWait, QueueWait);
+	Metrics.Latency.Record(Latency);
+	if (TimeToFirstByte >= 0.0)
+	{
+		Metrics.TimeToFirstByte.Record(TimeToFirstByte);
+	}
+	Metrics.ResponseCodes.FindOrAdd(ResponseCode)++;
+}
+
+const FHttpEndpointMetrics* FHttpMetrics::Find(const FString& Route) const
+{
+	return Endpoints.Find(Route);
+}
+
+const TMap<FString, FHttpEndpointMetrics>& FHttpMetrics::GetEndpoints() const
+{
+	return Endpoints;
+}
+
+void FHttpMetrics::TakeSnapshot(TArray<FHttpEndpointMetricsSnapshot>& OutSnapshot) const
+{
+	OutSnapshot.Reset(Endpoints.Num());
+	for (const auto& Endpoint : Endpoints)
+	{
+		const FHttpEndpointMetrics& Metrics = Endpoint.Value;
+		FHttpEndpointMetricsSnapshot& Snapshot = OutSnapshot.AddDefaulted_GetRef();
+		Snapshot.Route = Endpoint.Key;
+		Snapshot.RequestCount = Metrics.RequestCount;
+		Snapshot.RetryCount = Metrics.RetryCount;
+		Snapshot.ErrorCount = Metrics.ErrorCount;
+		Snapshot.BytesSent = Metrics.BytesSent;
+		Snapshot.BytesReceived = Metrics.BytesReceived;
+		Snapshot.AverageQueueWait = Metrics.GetAverageQueueWait();
+		Snapshot.MaxQueueWait = Metrics.MaxQueueWait;
+		Snapshot.LatencyP50 = Metrics.Latency.GetPercentile(50.0);
+		Snapshot.LatencyP95 = Metrics.Latency.GetPercentile(95.0);
+		Snapshot.LatencyP99 = Metrics.Latency.GetPercentile(99.0);
+		Snapshot.LatencyMax = Metrics.Latency.GetMax();
+		Snapshot.TimeToFirstByteP50 = Metrics.TimeToFirstByte.GetPercentile(50.0);
+		Snapshot.TimeToFirstByteP95 = Metrics.TimeToFirstByte.GetPercentile(95.0);
+		Snapshot.TimeToFirstByteP99 = Metrics.TimeToFirstByte.GetPercentile(99.0);
+		Snapshot.ResponseCodes = Metrics.ResponseCodes;
+	}
+}
+
+void FHttpMetrics::Reset()
+{
+	Endpoints.Empty();
+}
+
+void FHttpMetrics::SetSnapshotInterval(float Seconds, bool bResetAfterSnapshot)
+{
+	FRegistry::TimerService.RemoveTimer(SnapshotHandle);
+
+	if (Seconds <= 0.0f)
+	{
+		return;
+	}
+
+	SnapshotHandle = FRegistry::TimerService.AddTicker(FTickerDelegate::CreateLambda([this, bResetAfterSnapshot](float DeltaTime)
+	{
+		if (Endpoints.Num() > 0 && SnapshotDelegate.IsBound())
+		{
+			TArray<FHttpEndpointMetricsSnapshot> Snapshot;
+			TakeSnapshot(Snapshot);
+			SnapshotDelegate.Broadcast(Snapshot);
+		}
+
+		if (bResetAfterSnapshot)
+		{
+			Reset();
+		}
+
+		return true;
+	}), Seconds);
+}
+
+FHttpMetricsSnapshotDelegate& FHttpMetrics::OnSnapshot()
+{
+	return SnapshotDelegate;
+}
+
+}
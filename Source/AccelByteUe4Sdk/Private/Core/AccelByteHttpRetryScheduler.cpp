@@ -3,8 +3,11 @@
 // and restrictions contact your company contract manager.
 
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteJsonDecoder.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteTimerService.h"
+#include "Misc/ScopeRWLock.h"
 #include <algorithm>
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteHttpRetry, Log, All);
@@ -23,216 +26,1217 @@ namespace HttpRequest
 			Request->GetStatus() == EHttpRequestStatus::Failed_ConnectionError ||
 			Request->GetStatus() == EHttpRequestStatus::Succeeded;
 	}
+
+	FString GetUrlHost(const FString& Url)
+	{
+		int32 HostStart = Url.Find(TEXT("://"));
+		HostStart = HostStart == INDEX_NONE ? 0 : HostStart + 3;
+
+		int32 HostEnd = Url.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, HostStart);
+		if (HostEnd == INDEX_NONE)
+		{
+			HostEnd = Url.Find(TEXT("?"), ESearchCase::CaseSensitive, ESearchDir::FromStart, HostStart);
+		}
+
+		return HostEnd == INDEX_NONE ? Url : Url.Left(HostEnd);
+	}
+
+	FString GetRouteTemplate(const FString& Url)
+	{
+		FString Path = Url.RightChop(GetUrlHost(Url).Len());
+		const int32 QueryStart = Path.Find(TEXT("?"));
+		if (QueryStart != INDEX_NONE)
+		{
+			Path = Path.Left(QueryStart);
+		}
+
+		TArray<FString> Segments;
+		Path.ParseIntoArray(Segments, TEXT("/"));
+
+		FString RouteTemplate;
+		for (int32 i = 0; i < Segments.Num(); i++)
+		{
+			const FString& Segment = Segments[i];
+			RouteTemplate += TEXT("/");
+
+			if (i > 0 && Segments[i - 1] == TEXT("namespaces"))
+			{
+				RouteTemplate += TEXT("{namespace}");
+			}
+			else if (Segment.Len() >= 20 || Segment.Contains(TEXT("%")) || Segment.IsNumeric() ||
+				(Segment.Len() >= 8 && Segment.FindLastCharByPredicate([](TCHAR Char) { return FChar::IsDigit(Char); }) != INDEX_NONE))
+			{
+				// user IDs, UUIDs, item IDs, numbers, encoded values, but not v1 or oauth2
+				RouteTemplate += TEXT("{id}");
+			}
+			else
+			{
+				RouteTemplate += Segment;
+			}
+		}
+
+		return RouteTemplate;
+	}
+
+	bool IsRetryableResponseCode(int32 Code)
+	{
+		switch (Code)
+		{
+		case EHttpResponseCodes::ServerError:
+		case EHttpResponseCodes::BadGateway:
+		case EHttpResponseCodes::ServiceUnavail:
+		case EHttpResponseCodes::GatewayTimeout:
+		case static_cast<int32>(ErrorCodes::StatusTooManyRequests):
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	double GetRetryAfterSeconds(const FHttpResponsePtr& Response)
+	{
+		if (!Response.IsValid())
+		{
+			return 0.0;
+		}
+
+		const FString RetryAfter = Response->GetHeader(TEXT("Retry-After")).TrimStartAndEnd();
+		if (RetryAfter.IsEmpty())
+		{
+			return 0.0;
+		}
+
+		// either delay-seconds or an HTTP-date, RFC 7231 section 7.1.3
+		if (RetryAfter.IsNumeric())
+		{
+			return FMath::Max(0.0, FCString::Atod(*RetryAfter));
+		}
+
+		FDateTime RetryDate;
+		if (FDateTime::ParseHttpDate(RetryAfter, RetryDate))
+		{
+			return FMath::Max(0.0, (RetryDate - FDateTime::UtcNow()).GetTotalSeconds());
+		}
+
+		return 0.0;
+	}
 }
 
-const int FHttpRetryScheduler::InitialDelay = 1;
-const int FHttpRetryScheduler::MaximumDelay = 30;
-const int FHttpRetryScheduler::TotalTimeout = 60;
+FHttpRetryPolicy FHttpRetryPolicy::NonIdempotent()
+{
+	FHttpRetryPolicy RetryPolicy;
+	RetryPolicy.bIdempotent = false;
+
+	return RetryPolicy;
+}
+
+FHttpRetryPolicy FHttpRetryPolicy::LatencySensitive()
+{
+	FHttpRetryPolicy RetryPolicy;
+	RetryPolicy.MaxAttempts = 3;
+	RetryPolicy.InitialDelay = 0.5;
+	RetryPolicy.MaximumDelay = 2.0;
+	RetryPolicy.TotalTimeout = 5.0;
+
+	return RetryPolicy;
+}
+
+FHttpRetryPolicy FHttpRetryPolicy::Transfer()
+{
+	FHttpRetryPolicy RetryPolicy;
+	RetryPolicy.MaxAttempts = 3;
+	RetryPolicy.MaximumDelay = 60.0;
+	RetryPolicy.TotalTimeout = 0.0;
+	RetryPolicy.bBypassAdmission = true;
+
+	return RetryPolicy;
+}
+
+const int FHttpRetryScheduler::InitialDelay = 1;
+const int FHttpRetryScheduler::MaximumDelay = 30;
+const int FHttpRetryScheduler::TotalTimeout = 60;
+const int FHttpRetryScheduler::DefaultMaxInFlightRequests = 0;
+const int FHttpRetryScheduler::DefaultMaxParkedRequests = 64;
+
+FHttpRetryScheduler::FHttpRetryTask::FHttpRetryTask(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, const FHttpRetryPolicy& RetryPolicy, EHttpRequestPriority Priority)
+	: Request(Request)
+	, CompleteDelegate(CompleteDelegate)
+	, RequestTime(RequestTime)
+	, RetryPolicy(RetryPolicy)
+	, Attempts(0)
+	, NextDelay(RetryPolicy.InitialDelay)
+	, NextRetryTime(RequestTime + RetryPolicy.InitialDelay)
+	, ScheduledRetry(false)
+	, bFinished(false)
+	, Priority(Priority)
+	, QueuedTime(0.0)
+	, bQueued(false)
+	, bHoldsSlot(false)
+	, bIsProbe(false)
+	, bCacheable(false)
+	, AuthorizationGeneration(0)
+	, bParked(false)
+	, bReplayedAfterRefresh(false)
+	, StartTime(FPlatformTime::Seconds())
+	, AttemptStartTime(0.0)
+	, FirstByteTime(0.0)
+	, QueueWaitTime(0.0)
+	, bTraceSampled(false)
+{
+}
+
+bool FHttpRetryScheduler::ProcessRequest(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, EHttpRequestPriority Priority)
+{
+	return ProcessRequest(Request, CompleteDelegate, RequestTime, GetRetryPolicy(Request->GetURL()), Priority);
+}
+
+bool FHttpRetryScheduler::ProcessRequest(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, const FHttpRetryPolicy& RetryPolicy, EHttpRequestPriority Priority)
+{
+	return ProcessTask(Request, CompleteDelegate, RequestTime, RetryPolicy, Priority, nullptr, 0, FString());
+}
+
+bool FHttpRetryScheduler::ProcessRequest(FHttpRequestBuilder& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, EHttpRequestPriority Priority)
+{
+	return ProcessRequest(Request, CompleteDelegate, RequestTime, GetRetryPolicy(Request.GetUrl()), Priority);
+}
+
+bool FHttpRetryScheduler::ProcessRequest(FHttpRequestBuilder& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, const FHttpRetryPolicy& RetryPolicy, EHttpRequestPriority Priority)
+{
+	const FHttpRequestPtr HttpRequest = Request.Build();
+	const bool bNeedsRouteTemplate = Metrics.IsEnabled() || TraceRecorder.GetConfig().bEnabled || FAsyncJsonDecoding::IsParseStatsEnabled();
+	const FString RouteTemplate = bNeedsRouteTemplate ? Request.GetRouteTemplate() : FString();
+
+	return ProcessTask(HttpRequest, CompleteDelegate, RequestTime, RetryPolicy, Priority, Request.GetAuthorization(), Request.GetAuthorizationGeneration(), RouteTemplate);
+}
+
+bool FHttpRetryScheduler::ProcessTask(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, const FHttpRetryPolicy& RetryPolicy, EHttpRequestPriority Priority, const FHttpAuthorizationPtr& Authorization, uint32 AuthorizationGeneration, const FString& RouteTemplate)
+{
+	if (State == EHttpRetrySchedulerState::SHUTTING_DOWN)
+	{
+		UE_LOG(LogAccelByteHttpRetry, Warning, TEXT("Cannot process request, HTTP Retry Scheduler is SHUTTING DOWN"));
+		return false;
+	}
+	if (State == EHttpRetrySchedulerState::UNINITIALIZED)
+	{
+		UE_LOG(LogAccelByteHttpRetry, Warning, TEXT("Cannot process request, HTTP Retry Scheduler is UNINITIALIZED"));
+		return false;
+	}
+
+	bool bCacheable = false;
+	FHttpResponsePtr CachedResponse;
+	if (ResponseCache.IsCacheable(Request))
+	{
+		if (ResponseCache.Lookup(Request, CachedResponse) == EHttpCacheLookup::Fresh)
+		{
+			DeliverCachedResponse(Request, CompleteDelegate, CachedResponse);
+			return true;
+		}
+		bCacheable = true;
+	}
+
+	FString CoalescingKey;
+	if (CoalesceRequest(Request, CompleteDelegate, Authorization, AuthorizationGeneration, CoalescingKey))
+	{
+		return true;
+	}
+
+	const TSharedRef<FHttpRetryTask> Task = MakeShared<FHttpRetryTask>(Request, CompleteDelegate, RequestTime, RetryPolicy, Priority);
+	Task->CoalescingKey = CoalescingKey;
+	Task->bCacheable = bCacheable;
+	Task->RevalidatedResponse = CachedResponse;
+	Task->bTraceSampled = TraceRecorder.ShouldSample();
+	if (!CoalescingKey.IsEmpty())
+	{
+		InFlightGetRequests.Add(CoalescingKey, Task);
+	}
+	Task->ServiceKey = GetServiceKey(Request->GetURL());
+	Task->Host = HttpRequest::GetUrlHost(Request->GetURL());
+	Task->RouteTemplate = RouteTemplate;
+	TrackAuthorization(Task, Authorization, AuthorizationGeneration);
+	TaskMap.Add(Request.Get(), Task);
+	if (Task->RetryPolicy.TotalTimeout > 0.0)
+	{
+		PushTimer(FHttpRetryTimer(Task->GetTimeoutTime(), ETimerType::Timeout, Task));
+	}
+
+	// Completion drives the task forward, the timer only handles expired retry and timeout deadlines
+	const TWeakPtr<FHttpRetryTask> WeakTask = Task;
+	Request->OnProcessRequestComplete().BindLambda([this, WeakTask](FHttpRequestPtr, FHttpResponsePtr, bool)
+	{
+		const TSharedPtr<FHttpRetryTask> PinnedTask = WeakTask.Pin();
+		if (PinnedTask.IsValid())
+		{
+			OnRequestComplete(PinnedTask.ToSharedRef(), FPlatformTime::Seconds());
+		}
+	});
+
+	if (Metrics.IsEnabled())
+	{
+		// the first progress report with received bytes is the closest the HTTP module gets to a first byte callback
+		const FHttpRequestProgressDelegate CallerProgressDelegate = Request->OnRequestProgress();
+		Request->OnRequestProgress().BindLambda([WeakTask, CallerProgressDelegate](FHttpRequestPtr ProgressRequest, int32 BytesSent, int32 BytesReceived)
+		{
+			const TSharedPtr<FHttpRetryTask> PinnedTask = WeakTask.Pin();
+			if (PinnedTask.IsValid() && PinnedTask->FirstByteTime <= 0.0 && BytesReceived > 0)
+			{
+				PinnedTask->FirstByteTime = FPlatformTime::Seconds();
+			}
+
+			CallerProgressDelegate.ExecuteIfBound(ProgressRequest, BytesSent, BytesReceived);
+		});
+	}
+
+	return StartOrEnqueueTask(Task, FPlatformTime::Seconds());
+}
+
+bool FHttpRetryScheduler::PollRetry(double CurrentTime)
+{
+	if (TaskMap.Num() == 0)
+	{
+		TimerHeap.Reset();
+		return false;
+	}
+
+	while (TimerHeap.Num() > 0 && TimerHeap.HeapTop().Time <= CurrentTime)
+	{
+		const FHttpRetryTimer Timer = TimerHeap.HeapTop();
+		TimerHeap.HeapPopDiscard(TLess<FHttpRetryTimer>(), false);
+
+		OnTimerExpired(Timer, CurrentTime);
+	}
+
+	if (TimerHeap.Num() > 0)
+	{
+		ArmPollRetry(TimerHeap.HeapTop().Time);
+	}
+
+	return true;
+}
+
+void FHttpRetryScheduler::PushTimer(const FHttpRetryTimer& Timer)
+{
+	TimerHeap.HeapPush(Timer);
+
+	if (!PollRetryHandle.IsValid() || Timer.Time < PollRetryDueTime)
+	{
+		ArmPollRetry(Timer.Time);
+	}
+}
+
+void FHttpRetryScheduler::ArmPollRetry(double DueTime)
+{
+	if (State != EHttpRetrySchedulerState::INITIALIZED)
+	{
+		return;
+	}
+
+	PollRetryDueTime = DueTime;
+	if (FRegistry::TimerService.RescheduleTimer(PollRetryHandle, DueTime))
+	{
+		return;
+	}
+
+	PollRetryHandle = FRegistry::TimerService.AddTimer(DueTime, FSimpleDelegate::CreateLambda([this]()
+	{
+		PollRetryHandle.Reset();
+		PollRetry(FPlatformTime::Seconds());
+	}));
+}
+
+int32 FHttpRetryScheduler::GetPendingTaskCount() const
+{
+	return TaskMap.Num();
+}
+
+void FHttpRetryScheduler::SetDefaultMaxInFlightRequests(int32 MaxInFlight)
+{
+	FRWScopeLock WriteLock(PolicyLock, SLT_Write);
+
+	MaxInFlightPerHost = MaxInFlight;
+
+	for (auto& Service : Services)
+	{
+		if (!ServiceLimits.ContainsByPredicate([&Service](const TPair<FString, int32>& Limit) { return Limit.Key == Service.Key; }))
+		{
+			Service.Value->MaxInFlight = MaxInFlight;
+		}
+	}
+}
+
+void FHttpRetryScheduler::SetMaxInFlightRequests(const FString& ServiceUrl, int32 MaxInFlight)
+{
+	if (ServiceUrl.IsEmpty())
+	{
+		return;
+	}
+
+	{
+		FRWScopeLock WriteLock(PolicyLock, SLT_Write);
+		TPair<FString, int32>* Limit = ServiceLimits.FindByPredicate([&ServiceUrl](const TPair<FString, int32>& Entry) { return Entry.Key == ServiceUrl; });
+		if (Limit != nullptr)
+		{
+			Limit->Value = MaxInFlight;
+		}
+		else
+		{
+			ServiceLimits.Add(TPair<FString, int32>(ServiceUrl, MaxInFlight));
+
+			// longest prefix first so nested service URLs get their own limit
+			ServiceLimits.Sort([](const TPair<FString, int32>& A, const TPair<FString, int32>& B) { return A.Key.Len() > B.Key.Len(); });
+		}
+	}
+
+	// takes the lock itself
+	FindOrAddService(ServiceUrl)->MaxInFlight = MaxInFlight;
+}
+
+void FHttpRetryScheduler::SetDefaultRetryPolicy(const FHttpRetryPolicy& RetryPolicy)
+{
+	FRWScopeLock WriteLock(PolicyLock, SLT_Write);
+
+	DefaultRetryPolicy = RetryPolicy;
+}
+
+void FHttpRetryScheduler::SetRetryPolicy(const FString& ServiceUrl, const FHttpRetryPolicy& RetryPolicy)
+{
+	if (ServiceUrl.IsEmpty())
+	{
+		return;
+	}
+
+	FRWScopeLock WriteLock(PolicyLock, SLT_Write);
+	TPair<FString, FHttpRetryPolicy>* ServicePolicy = ServiceRetryPolicies.FindByPredicate([&ServiceUrl](const TPair<FString, FHttpRetryPolicy>& Entry) { return Entry.Key == ServiceUrl; });
+	if (ServicePolicy != nullptr)
+	{
+		ServicePolicy->Value = RetryPolicy;
+		return;
+	}
+
+	ServiceRetryPolicies.Add(TPair<FString, FHttpRetryPolicy>(ServiceUrl, RetryPolicy));
+	ServiceRetryPolicies.Sort([](const TPair<FString, FHttpRetryPolicy>& A, const TPair<FString, FHttpRetryPolicy>& B) { return A.Key.Len() > B.Key.Len(); });
+}
+
+FHttpRetryPolicy FHttpRetryScheduler::GetRetryPolicy(const FString& Url) const
+{
+	FRWScopeLock ReadLock(PolicyLock, SLT_ReadOnly);
+	for (const auto& ServicePolicy : ServiceRetryPolicies)
+	{
+		if (Url.StartsWith(ServicePolicy.Key))
+		{
+			return ServicePolicy.Value;
+		}
+	}
+
+	return DefaultRetryPolicy;
+}
+
+const FHttpRequestQueueStats& FHttpRetryScheduler::GetQueueStats(EHttpRequestPriority Priority) const
+{
+	return QueueStats[FMath::Clamp(static_cast<int32>(Priority), 0, static_cast<int32>(EHttpRequestPriority::Max) - 1)];
+}
+
+FString FHttpRetryScheduler::GetServiceKey(const FString& Url) const
+{
+	FRWScopeLock ReadLock(PolicyLock, SLT_ReadOnly);
+	for (const auto& Limit : ServiceLimits)
+	{
+		if (Url.StartsWith(Limit.Key))
+		{
+			return Limit.Key;
+		}
+	}
+
+	return HttpRequest::GetUrlHost(Url);
+}
+
+TSharedRef<FHttpRetryScheduler::FHttpServiceQueue> FHttpRetryScheduler::FindOrAddService(const FString& ServiceKey)
+{
+	FRWScopeLock WriteLock(PolicyLock, SLT_Write);
+	if (const TSharedRef<FHttpServiceQueue>* Service = Services.Find(ServiceKey))
+	{
+		return *Service;
+	}
+
+	TSharedRef<FHttpServiceQueue> Service = MakeShared<FHttpServiceQueue>();
+	Service->MaxInFlight = MaxInFlightPerHost;
+	Services.Add(ServiceKey, Service);
+
+	return Service;
+}
+
+void FHttpRetryScheduler::SetCircuitBreakerConfig(const FHttpCircuitBreakerConfig& Config)
+{
+	FRWScopeLock WriteLock(PolicyLock, SLT_Write);
+
+	CircuitBreakerConfig = Config;
+}
+
+EHttpCircuitState FHttpRetryScheduler::GetCircuitState(const FString& Url) const
+{
+	const FHttpCircuitBreaker* Breaker = CircuitBreakers.Find(HttpRequest::GetUrlHost(Url));
+
+	return Breaker != nullptr ? Breaker->State : EHttpCircuitState::Closed;
+}
+
+void FHttpRetryScheduler::SetCoalescingEnabled(bool bEnabled)
+{
+	FRWScopeLock WriteLock(PolicyLock, SLT_Write);
+
+	bCoalescingEnabled = bEnabled;
+}
+
+const FHttpCoalescingStats& FHttpRetryScheduler::GetCoalescingStats() const
+{
+	return CoalescingStats;
+}
+
+FHttpResponseCache& FHttpRetryScheduler::GetResponseCache()
+{
+	return ResponseCache;
+}
+
+FHttpMetrics& FHttpRetryScheduler::GetMetrics()
+{
+	return Metrics;
+}
+
+FHttpTraceRecorder& FHttpRetryScheduler::GetTraceRecorder()
+{
+	return TraceRecorder;
+}
+
+FHttpRequestJournal& FHttpRetryScheduler::GetJournal()
+{
+	return Journal;
+}
+
+void FHttpRetryScheduler::AddAuthorization(const FHttpAuthorizationRef& Authorization)
+{
+	if (Authorizations.Contains(Authorization))
+	{
+		return;
+	}
+
+	Authorizations.Add(Authorization);
+	Authorization->OnRefreshEnded().AddRaw(this, &FHttpRetryScheduler::ReleaseParkedTasks);
+}
+
+void FHttpRetryScheduler::RemoveAuthorization(const FHttpAuthorizationRef& Authorization)
+{
+	if (Authorizations.Remove(Authorization) > 0)
+	{
+		Authorization->OnRefreshEnded().RemoveAll(this);
+	}
+}
+
+void FHttpRetryScheduler::SetMaxParkedRequests(int32 MaxParked)
+{
+	FRWScopeLock WriteLock(PolicyLock, SLT_Write);
+
+	MaxParkedRequests = MaxParked;
+}
+
+int32 FHttpRetryScheduler::GetParkedRequestCount() const
+{
+	return ParkedTasks.Num();
+}
+
+void FHttpRetryScheduler::CopyPolicies(const FHttpRetryScheduler& Other)
+{
+	if (&Other == this)
+	{
+		return;
+	}
+
+	int32 MaxInFlight;
+	TArray<TPair<FString, int32>> Limits;
+	{
+		// the other scheduler may be tuned on the game thread while a client is created on another one
+		FRWScopeLock ReadLock(Other.PolicyLock, SLT_ReadOnly);
+		MaxInFlight = Other.MaxInFlightPerHost;
+		Limits = Other.ServiceLimits;
+
+		FRWScopeLock WriteLock(PolicyLock, SLT_Write);
+		DefaultRetryPolicy = Other.DefaultRetryPolicy;
+		ServiceRetryPolicies = Other.ServiceRetryPolicies;
+		CircuitBreakerConfig = Other.CircuitBreakerConfig;
+		bCoalescingEnabled = Other.bCoalescingEnabled;
+		MaxParkedRequests = Other.MaxParkedRequests;
+	}
+
+	SetDefaultMaxInFlightRequests(MaxInFlight);
+	for (const auto& Limit : Limits)
+	{
+		SetMaxInFlightRequests(Limit.Key, Limit.Value);
+	}
+	ResponseCache.CopyTtls(Other.ResponseCache);
+	Metrics.SetEnabled(Other.Metrics.IsEnabled());
+}
+
+void FHttpRetryScheduler::TrackAuthorization(const TSharedRef<FHttpRetryTask>& Task, const FHttpAuthorizationPtr& Authorization, uint32 AuthorizationGeneration) const
+{
+	if (!Authorization.IsValid() || !Authorization->HasToken())
+	{
+		return;
+	}
+
+	if (IsAuthorizationTracked(Authorization.Get()))
+	{
+		Task->Authorization = Authorization;
+		Task->AuthorizationGeneration = AuthorizationGeneration;
+	}
+}
+
+bool FHttpRetryScheduler::IsAuthorizationTracked(const FHttpAuthorization* Authorization) const
+{
+	// the builder hands over the credentials it signed with, a pointer match is enough to know it is tracked
+	return Authorizations.ContainsByPredicate([Authorization](const FHttpAuthorizationRef& Tracked) { return &Tracked.Get() == Authorization; });
+}
+
+bool FHttpRetryScheduler::ParkTask(const TSharedRef<FHttpRetryTask>& Task)
+{
+	if (!Task->Authorization.IsValid() || !Task->Authorization->IsRefreshing())
+	{
+		return false;
+	}
+
+	if (ParkedTasks.Num() >= MaxParkedRequests)
+	{
+		UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Too many requests waiting for a token refresh, sending %s with the current token"), *Task->Request->GetURL());
+		return false;
+	}
+
+	Task->bParked = true;
+	ParkedTasks.Add(Task);
 
-FHttpRetryScheduler::FHttpRetryTask::FHttpRetryTask(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, double NextDelay)
-	: Request(Request)
-	, CompleteDelegate(CompleteDelegate)
-	, RequestTime(RequestTime)
-	, NextDelay(NextDelay)
-	, NextRetryTime(RequestTime + NextDelay)
-	, ScheduledRetry(false)
+	return true;
+}
+
+void FHttpRetryScheduler::ReleaseParkedTasks()
 {
+	if (ParkedTasks.Num() == 0)
+	{
+		return;
+	}
+
+	// tasks of another authorization that is still refreshing park again
+	TArray<TSharedRef<FHttpRetryTask>> ReleasedTasks = MoveTemp(ParkedTasks);
+	ParkedTasks.Reset();
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	for (const TSharedRef<FHttpRetryTask>& Task : ReleasedTasks)
+	{
+		Task->bParked = false;
+		if (!Task->bFinished)
+		{
+			StartOrEnqueueTask(Task, CurrentTime);
+		}
+	}
 }
 
-bool FHttpRetryScheduler::ProcessRequest(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime)
+bool FHttpRetryScheduler::ReplayUnauthorized(const TSharedRef<FHttpRetryTask>& Task, double CurrentTime)
 {
-	if (State == EHttpRetrySchedulerState::SHUTTING_DOWN)
+	if (!Task->Authorization.IsValid() || Task->bReplayedAfterRefresh)
 	{
-		UE_LOG(LogAccelByteHttpRetry, Warning, TEXT("Cannot process request, HTTP Retry Scheduler is SHUTTING DOWN"));
 		return false;
 	}
-	if (State == EHttpRetrySchedulerState::UNINITIALIZED)
+
+	// a request signed before the last refresh is replayed right away, otherwise the first 401 starts the refresh
+	// and the following ones wait for it
+	const bool bSignedWithOldToken = Task->AuthorizationGeneration != Task->Authorization->GetGeneration();
+	if (!bSignedWithOldToken && !Task->Authorization->RequestRefresh())
 	{
-		UE_LOG(LogAccelByteHttpRetry, Warning, TEXT("Cannot process request, HTTP Retry Scheduler is UNINITIALIZED"));
 		return false;
 	}
 
+	UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Replaying %s with a refreshed token"), *Task->Request->GetURL());
+
+	RecordHostResult(Task, false, 0.0, CurrentTime);
+	ReleaseSlot(Task, CurrentTime);
+	Task->bReplayedAfterRefresh = true;
+	StartOrEnqueueTask(Task, CurrentTime);
 
-	FReport::LogHttpRequest(Request);
-	bool bIsStarted = Request->ProcessRequest();
+	return true;
+}
 
-	RetryList.Add(MakeShared<FHttpRetryTask>(Request, CompleteDelegate, RequestTime, InitialDelay));
+void FHttpRetryScheduler::DeliverCachedResponse(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, const FHttpResponsePtr& Response)
+{
+	UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Serving GET %s from cache"), *Request->GetURL());
 
-	return bIsStarted;
+	// called back on the next tick like a real response, never from inside ProcessRequest
+	FRegistry::TimerService.AddTimer(FPlatformTime::Seconds(), FSimpleDelegate::CreateLambda([Request, CompleteDelegate, Response]()
+	{
+		CompleteDelegate.ExecuteIfBound(Request, Response, true);
+	}));
 }
 
-bool FHttpRetryScheduler::PollRetry(double CurrentTime)
+bool FHttpRetryScheduler::CoalesceRequest(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, const FHttpAuthorizationPtr& Authorization, uint32 AuthorizationGeneration, FString& OutCoalescingKey)
 {
-	if (RetryList.Num() == 0)
+	if (!bCoalescingEnabled || Request->GetVerb() != TEXT("GET"))
+	{
+		return false;
+	}
+
+	// the authorization identifies the principal, so two users never share a response.
+	// A tracked one is kept alive by the leader task, so its address can't be reused while the leader is in flight.
+	if (Authorization.IsValid() && Authorization->HasToken() && IsAuthorizationTracked(Authorization.Get()))
+	{
+		OutCoalescingKey = FString::Printf(TEXT("GET %s\n%p:%u"), *Request->GetURL(), Authorization.Get(), AuthorizationGeneration);
+	}
+	else
+	{
+		OutCoalescingKey = FString::Printf(TEXT("GET %s\n%s"), *Request->GetURL(), *Request->GetHeader(TEXT("Authorization")));
+	}
+
+	const TWeakPtr<FHttpRetryTask>* InFlightTask = InFlightGetRequests.Find(OutCoalescingKey);
+	TSharedPtr<FHttpRetryTask> LeaderTask;
+	if (InFlightTask != nullptr)
 	{
+		LeaderTask = InFlightTask->Pin();
+	}
+
+	if (!LeaderTask.IsValid() || LeaderTask->bFinished)
+	{
+		CoalescingStats.Misses++;
 		return false;
 	}
 
-	TArray<TSharedRef<FHttpRetryTask>> CompletedTasks;
+	CoalescingStats.Hits++;
+	LeaderTask->CoalescedDelegates.Add(CompleteDelegate);
+	UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Joined GET %s to the request in flight"), *Request->GetURL());
+
+	return true;
+}
+
+bool FHttpRetryScheduler::AcquireCircuit(const TSharedRef<FHttpRetryTask>& Task, double CurrentTime, double& OutHoldUntil)
+{
+	FHttpCircuitBreaker* Breaker = CircuitBreakers.Find(Task->Host);
+	if (Breaker == nullptr || Breaker->State == EHttpCircuitState::Closed)
+	{
+		return true;
+	}
 
-	RetryList.RemoveAll([CurrentTime, &CompletedTasks](const TSharedRef<FHttpRetryTask>& CurrentTask)
+	if (Breaker->State == EHttpCircuitState::Open)
 	{
-		if (!CurrentTask->Request.IsValid())
+		if (CurrentTime < Breaker->OpenUntil)
 		{
-			return true;
+			OutHoldUntil = Breaker->OpenUntil;
+			return false;
 		}
 
-		if (CurrentTask->ScheduledRetry)
+		UE_LOG(LogAccelByteHttpRetry, Log, TEXT("Circuit of %s is HALF OPEN, probing"), *Task->Host);
+		Breaker->State = EHttpCircuitState::HalfOpen;
+		Breaker->bProbeInFlight = false;
+	}
+
+	if (Breaker->bProbeInFlight && !Task->bIsProbe)
+	{
+		OutHoldUntil = CurrentTime + CircuitBreakerConfig.HalfOpenHoldDelay;
+		return false;
+	}
+
+	Breaker->bProbeInFlight = true;
+	Task->bIsProbe = true;
+
+	return true;
+}
+
+void FHttpRetryScheduler::RecordHostResult(const TSharedRef<FHttpRetryTask>& Task, bool bFailed, double RetryAfter, double CurrentTime)
+{
+	if (CircuitBreakerConfig.FailureThreshold <= 0)
+	{
+		return;
+	}
+
+	FHttpCircuitBreaker* Breaker = CircuitBreakers.Find(Task->Host);
+	if (!bFailed)
+	{
+		if (Breaker != nullptr)
 		{
-			if (CurrentTime >= CurrentTask->NextRetryTime)
-			{
-				CurrentTask->ScheduledRetry = false;
-				FReport::LogHttpRequest(CurrentTask->Request);
-				CurrentTask->Request->ProcessRequest();
-			}
-			else
+			if (Breaker->State != EHttpCircuitState::Closed)
 			{
-				return false;
+				UE_LOG(LogAccelByteHttpRetry, Log, TEXT("Circuit of %s is CLOSED"), *Task->Host);
 			}
+			CircuitBreakers.Remove(Task->Host);
 		}
+		Task->bIsProbe = false;
+		return;
+	}
 
-		switch (CurrentTask->Request->GetStatus())
-		{
-		case EHttpRequestStatus::Processing:
-			if (CurrentTime >= CurrentTask->RequestTime + FHttpRetryScheduler::TotalTimeout)
-			{
-				CurrentTask->Request->CancelRequest();
-			}
+	if (Breaker == nullptr)
+	{
+		Breaker = &CircuitBreakers.Add(Task->Host);
+	}
+
+	const bool bWasProbe = Task->bIsProbe;
+	if (bWasProbe)
+	{
+		Breaker->bProbeInFlight = false;
+		Task->bIsProbe = false;
+	}
+
+	Breaker->ConsecutiveFailures++;
+
+	if (Breaker->State == EHttpCircuitState::HalfOpen && bWasProbe)
+	{
+		Breaker->OpenDuration = FMath::Min(Breaker->OpenDuration * 2.0, CircuitBreakerConfig.MaxOpenDuration);
+	}
+	else if (Breaker->State == EHttpCircuitState::Closed && Breaker->ConsecutiveFailures >= CircuitBreakerConfig.FailureThreshold)
+	{
+		Breaker->OpenDuration = CircuitBreakerConfig.OpenDuration;
+	}
+	else if (Breaker->State != EHttpCircuitState::Open)
+	{
+		return;
+	}
+
+	if (Breaker->State != EHttpCircuitState::Open)
+	{
+		UE_LOG(LogAccelByteHttpRetry, Warning, TEXT("Circuit of %s is OPEN for %.1f seconds after %d consecutive failures"), *Task->Host, Breaker->OpenDuration, Breaker->ConsecutiveFailures);
+	}
+
+	Breaker->State = EHttpCircuitState::Open;
+	Breaker->OpenUntil = FMath::Max3(Breaker->OpenUntil, CurrentTime + Breaker->OpenDuration, CurrentTime + RetryAfter);
+}
+
+void FHttpRetryScheduler::HoldTask(const TSharedRef<FHttpRetryTask>& Task, double HoldUntil)
+{
+	Task->ScheduledRetry = true;
+	Task->NextRetryTime = FMath::Min(HoldUntil, Task->GetTimeoutTime());
+	PushTimer(FHttpRetryTimer(Task->NextRetryTime, ETimerType::Retry, Task));
+}
+
+bool FHttpRetryScheduler::StartOrEnqueueTask(const TSharedRef<FHttpRetryTask>& Task, double CurrentTime)
+{
+	if (ParkTask(Task))
+	{
+		return true;
+	}
 
+	double HoldUntil = CurrentTime;
+	if (!AcquireCircuit(Task, CurrentTime, HoldUntil))
+	{
+		if (CircuitBreakerConfig.bFailFast)
+		{
+			// finished on the next poll, so the caller never gets called back from inside ProcessRequest
+			PushTimer(FHttpRetryTimer(CurrentTime, ETimerType::Timeout, Task));
 			return false;
-		case EHttpRequestStatus::Succeeded: //got response
-			switch (CurrentTask->Request->GetResponse()->GetResponseCode())
-			{
-			case EHttpResponseCodes::ServerError:
-			case EHttpResponseCodes::BadGateway:
-			case EHttpResponseCodes::ServiceUnavail:
-			case EHttpResponseCodes::GatewayTimeout:
-				if (CurrentTime >= CurrentTask->RequestTime + FHttpRetryScheduler::TotalTimeout)
-				{
-					CompletedTasks.Add(CurrentTask);
-					return true;
-				}
-
-				CurrentTask->ScheduleNextRetry(CurrentTime);
-
-				return false;
-			case EHttpResponseCodes::Forbidden:
-				CompletedTasks.Add(CurrentTask);
-
-				return true;
-			default:
-				CompletedTasks.Add(CurrentTask);
-
-				return true;
-			}
-		case EHttpRequestStatus::NotStarted:
-			if (CurrentTime >= CurrentTask->RequestTime + FHttpRetryScheduler::TotalTimeout)
+		}
+
+		HoldTask(Task, HoldUntil);
+		return true;
+	}
+
+	const TSharedRef<FHttpServiceQueue> Service = FindOrAddService(Task->ServiceKey);
+
+	if (Task->RetryPolicy.bBypassAdmission || Service->MaxInFlight <= 0 || Service->InFlight < Service->MaxInFlight)
+	{
+		Task->QueuedTime = CurrentTime;
+		return StartTask(Task, Service.Get(), CurrentTime);
+	}
+
+	FHttpRequestQueueStats& Stats = QueueStats[static_cast<int32>(Task->Priority)];
+	Stats.QueueDepth++;
+	Stats.MaxQueueDepth = FMath::Max(Stats.MaxQueueDepth, Stats.QueueDepth);
+	Stats.TotalQueued++;
+
+	Task->QueuedTime = CurrentTime;
+	Task->bQueued = true;
+	Service->Queues[static_cast<int32>(Task->Priority)].Enqueue(Task);
+
+	return true;
+}
+
+bool FHttpRetryScheduler::StartTask(const TSharedRef<FHttpRetryTask>& Task, FHttpServiceQueue& Service, double CurrentTime)
+{
+	FHttpRequestQueueStats& Stats = QueueStats[static_cast<int32>(Task->Priority)];
+	const double WaitTime = CurrentTime - Task->QueuedTime;
+	Stats.TotalStarted++;
+	Stats.TotalWaitTime += WaitTime;
+	Stats.MaxWaitTime = FMath::Max(Stats.MaxWaitTime, WaitTime);
+
+	if (!Task->RetryPolicy.bBypassAdmission)
+	{
+		Service.InFlight++;
+	}
+	Task->bHoldsSlot = true;
+	Task->Attempts++;
+	Task->QueueWaitTime += WaitTime;
+	Task->AttemptStartTime = CurrentTime;
+	Task->FirstByteTime = 0.0;
+
+	// the token may have been refreshed while the task waited for a retry or a free slot
+	if (Task->Authorization.IsValid())
+	{
+		Task->Authorization->Resign(Task->Request, Task->AuthorizationGeneration);
+	}
+
+	FReport::LogHttpRequest(Task->Request);
+	return Task->Request->ProcessRequest();
+}
+
+void FHttpRetryScheduler::ReleaseSlot(const TSharedRef<FHttpRetryTask>& Task, double CurrentTime)
+{
+	if (Task->bQueued)
+	{
+		// left in the queue, it will be skipped when dequeued
+		Task->bQueued = false;
+		QueueStats[static_cast<int32>(Task->Priority)].QueueDepth--;
+		return;
+	}
+
+	if (!Task->bHoldsSlot)
+	{
+		return;
+	}
+
+	Task->bHoldsSlot = false;
+	if (Task->RetryPolicy.bBypassAdmission)
+	{
+		// in flight without taking a service slot, nothing to hand over
+		return;
+	}
+
+	const TSharedRef<FHttpServiceQueue> Service = FindOrAddService(Task->ServiceKey);
+	Service->InFlight--;
+
+	for (int32 Priority = 0; Priority < static_cast<int32>(EHttpRequestPriority::Max); Priority++)
+	{
+		TSharedPtr<FHttpRetryTask> NextTask;
+		while ((Service->MaxInFlight <= 0 || Service->InFlight < Service->MaxInFlight) && Service->Queues[Priority].Dequeue(NextTask))
+		{
+			if (!NextTask.IsValid() || !NextTask->bQueued)
 			{
-				CompletedTasks.Add(CurrentTask);
-				return true;
+				continue;
 			}
 
-			return false;
-		case EHttpRequestStatus::Failed_ConnectionError: //network error
-			if (CurrentTime >= CurrentTask->RequestTime + FHttpRetryScheduler::TotalTimeout)
+			NextTask->bQueued = false;
+			QueueStats[Priority].QueueDepth--;
+			StartTask(NextTask.ToSharedRef(), Service.Get(), CurrentTime);
+		}
+	}
+}
+
+void FHttpRetryScheduler::OnRequestComplete(const TSharedRef<FHttpRetryTask>& Task, double CurrentTime)
+{
+	if (Task->bFinished || Task->ScheduledRetry)
+	{
+		return;
+	}
+
+	switch (Task->Request->GetStatus())
+	{
+	case EHttpRequestStatus::Succeeded: //got response
+		if (Task->Request->GetResponse().IsValid() && Task->Request->GetResponse()->GetResponseCode() == EHttpResponseCodes::Denied && ReplayUnauthorized(Task, CurrentTime))
+		{
+			return;
+		}
+
+		if (Task->Request->GetResponse().IsValid() && HttpRequest::IsRetryableResponseCode(Task->Request->GetResponse()->GetResponseCode()))
+		{
+			const double RetryAfter = HttpRequest::GetRetryAfterSeconds(Task->Request->GetResponse());
+			RecordHostResult(Task, true, RetryAfter, CurrentTime);
+
+			if (Task->CanRetry(Task->Request->GetResponse()->GetResponseCode()))
 			{
-				CompletedTasks.Add(CurrentTask);
-				return true;
+				ScheduleRetry(Task, CurrentTime, RetryAfter);
+				return;
 			}
+		}
+		else
+		{
+			RecordHostResult(Task, false, 0.0, CurrentTime);
+		}
 
-			CurrentTask->ScheduleNextRetry(CurrentTime);
+		FinishTask(Task);
+		return;
+	case EHttpRequestStatus::Failed_ConnectionError: //network error
+		RecordHostResult(Task, true, 0.0, CurrentTime);
 
-			return false;
-		case EHttpRequestStatus::Failed: //request cancelled
-			CompletedTasks.Add(CurrentTask);
+		if (Task->CanRetry(0))
+		{
+			ScheduleRetry(Task, CurrentTime, 0.0);
+			return;
+		}
 
-			return true;
-		default:
-			return false;
+		FinishTask(Task);
+		return;
+	case EHttpRequestStatus::Failed: //request cancelled
+		FinishTask(Task);
+		return;
+	default:
+		// still processing or not started, the timeout timer will take care of it
+		return;
+	}
+}
+
+void FHttpRetryScheduler::OnTimerExpired(const FHttpRetryTimer& Timer, double CurrentTime)
+{
+	const TSharedPtr<FHttpRetryTask> PinnedTask = Timer.Task.Pin();
+	if (!PinnedTask.IsValid() || PinnedTask->bFinished)
+	{
+		return;
+	}
+
+	const TSharedRef<FHttpRetryTask> Task = PinnedTask.ToSharedRef();
+	if (!Task->Request.IsValid())
+	{
+		FinishTask(Task);
+		return;
+	}
+
+	switch (Timer.Type)
+	{
+	case ETimerType::Retry:
+		if (!Task->ScheduledRetry || Timer.Time != Task->NextRetryTime)
+		{
+			return;
 		}
-	});
 
-	for (const auto& Task : CompletedTasks)
+		Task->ScheduledRetry = false;
+		if (CurrentTime >= Task->GetTimeoutTime())
+		{
+			FinishTask(Task);
+			return;
+		}
+
+		StartOrEnqueueTask(Task, CurrentTime);
+		return;
+	case ETimerType::Timeout:
+		if (Task->bHoldsSlot && Task->Request->GetStatus() == EHttpRequestStatus::Processing)
+		{
+			// completion callback will finish the task
+			Task->Request->CancelRequest();
+			return;
+		}
+
+		FinishTask(Task);
+		return;
+	}
+}
+
+void FHttpRetryScheduler::ScheduleRetry(const TSharedRef<FHttpRetryTask>& Task, double CurrentTime, double RetryAfter)
+{
+	ReleaseSlot(Task, CurrentTime);
+
+	// no point to wait for a server dictated delay that ends after the deadline
+	if (CurrentTime + RetryAfter >= Task->GetTimeoutTime())
 	{
-		const FHttpRequestPtr& Request = Task->Request;
-		FReport::LogHttpResponse(Request, Request->GetResponse());
-		Task->CompleteDelegate.ExecuteIfBound(Request, Request->GetResponse(), HttpRequest::IsFinished(Request));
+		FinishTask(Task);
+		return;
 	}
 
-	return true;
+	Task->ScheduleNextRetry(CurrentTime, RetryAfter);
+	PushTimer(FHttpRetryTimer(Task->NextRetryTime, ETimerType::Retry, Task));
 }
 
-void FHttpRetryScheduler::Startup()
+void FHttpRetryScheduler::FinishTask(const TSharedRef<FHttpRetryTask>& Task)
 {
-	PollRetryHandle = FTicker::GetCoreTicker().AddTicker(
-        FTickerDelegate::CreateLambda([this](float DeltaTime)
-        {
-            PollRetry(FPlatformTime::Seconds());
+	Task->bFinished = true;
+	Task->ScheduledRetry = false;
+	TaskMap.Remove(Task->Request.Get());
+	ReleaseSlot(Task, FPlatformTime::Seconds());
+
+	if (Task->bParked)
+	{
+		Task->bParked = false;
+		ParkedTasks.Remove(Task);
+	}
 
-            return true;
-        }),
-        0.2f);
+	// a delegate sending the same GET again must not join this finished request
+	if (!Task->CoalescingKey.IsEmpty())
+	{
+		const TWeakPtr<FHttpRetryTask>* InFlightTask = InFlightGetRequests.Find(Task->CoalescingKey);
+		if (InFlightTask != nullptr && InFlightTask->HasSameObject(&Task.Get()))
+		{
+			InFlightGetRequests.Remove(Task->CoalescingKey);
+		}
+	}
+
+	if (Task->bIsProbe)
+	{
+		// probe ended without telling anything about the host, let the next request probe it
+		if (FHttpCircuitBreaker* Breaker = CircuitBreakers.Find(Task->Host))
+		{
+			Breaker->bProbeInFlight = false;
+		}
+		Task->bIsProbe = false;
+	}
+
+	if (!Task->Request.IsValid())
+	{
+		return;
+	}
+
+	const FHttpRequestPtr& Request = Task->Request;
+	FReport::LogHttpResponse(Request, Request->GetResponse());
+
+	FHttpResponsePtr Response = Request->GetResponse();
+	if (Task->bCacheable)
+	{
+		// a 304 is replaced with the cached response it confirmed
+		Response = ResponseCache.OnResponse(Request, Response, Task->RevalidatedResponse);
+	}
 
+	const double FinishTime = FPlatformTime::Seconds();
+	const double TimeToFirstByte = Task->FirstByteTime > 0.0 ? Task->FirstByteTime - Task->AttemptStartTime : -1.0;
+	Metrics.Record(Request, Task->RouteTemplate, Request->GetResponse(), Task->Attempts, Task->QueueWaitTime, FinishTime - Task->StartTime, TimeToFirstByte);
+	TraceRecorder.Record(Request, Task->RouteTemplate, Request->GetResponse(), Task->bTraceSampled, Task->Attempts, FinishTime - Task->StartTime);
+	const bool bJournaled = Journal.OnRequestFinished(Request, Request->GetResponse());
+
+	// lets the caller's error handler tell a write that will be replayed from a lost one
+	TGuardValue<const IHttpRequest*> JournaledGuard(FHttpRequestJournal::CompletingJournaledRequest, bJournaled ? Request.Get() : nullptr);
+
+	// parses in the success handlers are counted on the endpoint of the request, not on a template guessed from its URL
+	FString ParseRouteTemplate;
+	if (FAsyncJsonDecoding::IsParseStatsEnabled())
+	{
+		ParseRouteTemplate = !Task->RouteTemplate.IsEmpty() ? Task->RouteTemplate : FString::Printf(TEXT("%s %s"), *Request->GetVerb(), *HttpRequest::GetRouteTemplate(Request->GetURL()));
+	}
+	TGuardValue<const FString*> RouteTemplateGuard(FAsyncJsonDecoding::CompletingRouteTemplate, &ParseRouteTemplate);
+	Task->CompleteDelegate.ExecuteIfBound(Request, Response, HttpRequest::IsFinished(Request));
+
+	for (const auto& CoalescedDelegate : Task->CoalescedDelegates)
+	{
+		CoalescedDelegate.ExecuteIfBound(Request, Response, HttpRequest::IsFinished(Request));
+	}
+	Task->CoalescedDelegates.Empty();
+}
+
+void FHttpRetryScheduler::Startup()
+{
 	State = EHttpRetrySchedulerState::INITIALIZED;
 	UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("HTTP Retry Scheduler has been INITIALIZED"));
+
+	// woken up at the earliest retry or timeout deadline instead of polling
+	if (TimerHeap.Num() > 0)
+	{
+		ArmPollRetry(TimerHeap.HeapTop().Time);
+	}
 }
 
-void FHttpRetryScheduler::Shutdown()
+void FHttpRetryScheduler::Shutdown(bool bFlushRequests)
 {
 	State = EHttpRetrySchedulerState::SHUTTING_DOWN;
 
-	if (PollRetryHandle.IsValid())
-	{
-		FTicker::GetCoreTicker().RemoveTicker(PollRetryHandle);
-		PollRetryHandle.Reset();
-	}
+	FRegistry::TimerService.RemoveTimer(PollRetryHandle);
+	Metrics.SetSnapshotInterval(0.0f);
 
 	// flush http requests
-	if (RetryList.Num() != 0)
+	if (TaskMap.Num() != 0)
 	{
-		double MaxFlushTimeSeconds = -1.0;
-		GConfig->GetDouble(TEXT("HTTP"), TEXT("MaxFlushTimeSeconds"), MaxFlushTimeSeconds, GEngineIni);
-
-		if (MaxFlushTimeSeconds <= 0)
+		if (bFlushRequests)
 		{
-			UE_LOG(LogAccelByteHttpRetry, Log, TEXT("HTTP MaxFlushTimeSeconds is not configured, it may prevent the shutdown, until all requests flushed"));
-		}
+			double MaxFlushTimeSeconds = -1.0;
+			GConfig->GetDouble(TEXT("HTTP"), TEXT("MaxFlushTimeSeconds"), MaxFlushTimeSeconds, GEngineIni);
+
+			if (MaxFlushTimeSeconds <= 0)
+			{
+				UE_LOG(LogAccelByteHttpRetry, Log, TEXT("HTTP MaxFlushTimeSeconds is not configured, it may prevent the shutdown, until all requests flushed"));
+			}
 
-		// try flush once
-		FHttpModule::Get().GetHttpManager().Flush(true);
-		FHttpModule::Get().GetHttpManager().Tick(0);
+			// try flush once
+			FHttpModule::Get().GetHttpManager().Flush(true);
+			FHttpModule::Get().GetHttpManager().Tick(0);
+		}
 
 		// cancel unfinished http requests, so don't hinder the shutdown
-		for (auto& Task : RetryList)
+		TArray<TSharedRef<FHttpRetryTask>> PendingTasks;
+		TaskMap.GenerateValueArray(PendingTasks);
+		TaskMap.Empty();
+
+		for (auto& Task : PendingTasks)
 		{
+			Task->bFinished = true;
 			if (Task->Request.IsValid() && Task->Request->GetStatus() == EHttpRequestStatus::Processing)
 			{
 				Task->Request->CancelRequest();
 			}
 		}
-		RetryList.Empty();
 	};
+
+	TimerHeap.Empty();
+	{
+		FRWScopeLock WriteLock(PolicyLock, SLT_Write);
+		Services.Empty();
+	}
+	CircuitBreakers.Empty();
+	InFlightGetRequests.Empty();
+	ParkedTasks.Empty();
+	for (const FHttpAuthorizationRef& Authorization : Authorizations)
+	{
+		Authorization->OnRefreshEnded().RemoveAll(this);
+	}
+	Authorizations.Empty();
+	Journal.Close();
+	ResponseCache.Close();
 }
 
-void FHttpRetryScheduler::FHttpRetryTask::ScheduleNextRetry(double CurrentTime)
+void FHttpRetryScheduler::FHttpRetryTask::ScheduleNextRetry(double CurrentTime, double RetryAfter)
 {
-	NextDelay *= 2;
-	NextDelay += FMath::RandRange(-NextDelay, NextDelay) / 4;
+	if (RetryAfter > 0.0)
+	{
+		NextDelay = RetryAfter;
+		NextRetryTime = CurrentTime + RetryAfter;
+		ScheduledRetry = true;
+		return;
+	}
+
+	const float ExponentialDelay = static_cast<float>(FMath::Min(RetryPolicy.MaximumDelay, RetryPolicy.InitialDelay * FMath::Pow(2.0f, FMath::Min(Attempts, 30))));
+	const float MinimumDelay = static_cast<float>(RetryPolicy.InitialDelay);
 
-	if (NextDelay > FHttpRetryScheduler::MaximumDelay)
+	switch (RetryPolicy.Jitter)
 	{
-		NextDelay = FHttpRetryScheduler::MaximumDelay;
+	case EHttpRetryJitter::None:
+		NextDelay = ExponentialDelay;
+		break;
+	case EHttpRetryJitter::Full:
+		NextDelay = FMath::FRandRange(0.0f, ExponentialDelay);
+		break;
+	case EHttpRetryJitter::Equal:
+		NextDelay = ExponentialDelay / 2 + FMath::FRandRange(0.0f, ExponentialDelay / 2);
+		break;
+	case EHttpRetryJitter::Decorrelated:
+		NextDelay = FMath::Min(RetryPolicy.MaximumDelay, static_cast<double>(FMath::FRandRange(MinimumDelay, FMath::Max(MinimumDelay, static_cast<float>(NextDelay * 3)))));
+		break;
 	}
 
 	NextRetryTime = CurrentTime + NextDelay;
 
-	if (NextRetryTime > RequestTime + FHttpRetryScheduler::TotalTimeout)
+	if (NextRetryTime > GetTimeoutTime())
 	{
-		NextRetryTime = RequestTime + FHttpRetryScheduler::TotalTimeout;
+		NextRetryTime = GetTimeoutTime();
 	}
 
 	ScheduledRetry = true;
 
 }
 
+bool FHttpRetryScheduler::FHttpRetryTask::CanRetry(int32 ResponseCode) const
+{
+	if (RetryPolicy.MaxAttempts > 0 && Attempts >= RetryPolicy.MaxAttempts)
+	{
+		return false;
+	}
+
+	if (RetryPolicy.bIdempotent)
+	{
+		return true;
+	}
+
+	// connection error (0) or a gateway error may happen after the server already applied the write
+	return ResponseCode == static_cast<int32>(ErrorCodes::StatusTooManyRequests) ||
+		ResponseCode == EHttpResponseCodes::ServiceUnavail;
+}
+
+double FHttpRetryScheduler::FHttpRetryTask::GetTimeoutTime() const
+{
+	if (RetryPolicy.TotalTimeout <= 0.0)
+	{
+		return TNumericLimits<double>::Max();
+	}
+
+	return RequestTime + RetryPolicy.TotalTimeout;
+}
+
 }
@@ -0,0 +1,221 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteHttpTrace.h"
+#include "Core/AccelByteHttpRetryScheduler.h"
+#include "Algo/Rotate.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryWriter.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteHttpTrace, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteHttpTrace);
+
+namespace AccelByte
+{
+
+namespace
+{
+	const TCHAR* const RedactedValue = TEXT("<redacted>");
+	const TCHAR* const OverflowRoute = TEXT("<other>");
+
+	uint32 ClampToUint32(int64 Value)
+	{
+		return static_cast<uint32>(FMath::Clamp<int64>(Value, 0, MAX_uint32));
+	}
+}
+
+const uint32 FHttpTraceRecorder::DumpMagic = 0x52544241; // 'ABTR'
+const int32 FHttpTraceRecorder::DumpVersion = 1;
+
+void FHttpTraceRecorder::SetConfig(const FHttpTraceConfig& InConfig)
+{
+	Config = InConfig;
+	Config.Capacity = FMath::Max(Config.Capacity, 1);
+	Config.MaxBodyBytes = FMath::Max(Config.MaxBodyBytes, 0);
+
+	if (!Config.bEnabled || Records.Num() > Config.Capacity)
+	{
+		Clear();
+	}
+	else if (NextRecord != 0 && Records.Num() < Config.Capacity)
+	{
+		// the wrapped ring grows by appending from now on, so put it back in order with the oldest record first
+		Algo::Rotate(Records, NextRecord);
+		NextRecord = 0;
+	}
+}
+
+const FHttpTraceConfig& FHttpTraceRecorder::GetConfig() const
+{
+	return Config;
+}
+
+bool FHttpTraceRecorder::ShouldSample() const
+{
+	return Config.bEnabled && (Config.SampleRate >= 1.0f || FMath::FRand() < Config.SampleRate);
+}
+
+void FHttpTraceRecorder::Record(const FHttpRequestPtr& Request, const FString& RouteTemplate, const FHttpResponsePtr& Response, bool bSampled, int32 Attempts, double Latency)
+{
+	if (!Config.bEnabled)
+	{
+		return;
+	}
+
+	const int32 Status = Response.IsValid() ? Response->GetResponseCode() : 0;
+	if (!bSampled && !(Config.bAlwaysRecordErrors && (Status == 0 || Status >= 400)))
+	{
+		return;
+	}
+
+	const FString Route = !RouteTemplate.IsEmpty()
+		? RouteTemplate
+		: FString::Printf(TEXT("%s %s"), *Request->GetVerb(), *HttpRequest::GetRouteTemplate(Request->GetURL()));
+
+	FRecord* Slot;
+	if (Records.Num() < Config.Capacity)
+	{
+		Slot = &Records.AddDefaulted_GetRef();
+	}
+	else
+	{
+		// slots are reused as they are, so their content arrays keep their allocation
+		Slot = &Records[NextRecord];
+		NextRecord = (NextRecord + 1) % Records.Num();
+	}
+
+	FRecord& Record = *Slot;
+	Record.Ticks = FDateTime::UtcNow().GetTicks();
+	Record.RouteIndex = FindOrAddRoute(Route);
+	Record.Status = static_cast<uint16>(FMath::Clamp(Status, 0, static_cast<int32>(MAX_uint16)));
+	Record.Attempts = static_cast<uint8>(FMath::Clamp(Attempts, 0, static_cast<int32>(MAX_uint8)));
+	Record.LatencyMicroseconds = ClampToUint32(static_cast<int64>(Latency * 1000000.0));
+	Record.BytesSent = ClampToUint32(Request->GetContentLength());
+	Record.BytesReceived = ClampToUint32(Response.IsValid() ? Response->GetContent().Num() : 0);
+
+	Record.Headers.Reset();
+	if (Config.bRecordHeaders)
+	{
+		CopyHeaders(Request->GetAllHeaders(), TEXT("> "), Record.Headers);
+		if (Response.IsValid())
+		{
+			CopyHeaders(Response->GetAllHeaders(), TEXT("< "), Record.Headers);
+		}
+	}
+
+	Record.RequestContent.Reset();
+	Record.ResponseContent.Reset();
+	const bool bRedactedBody = Config.RedactedBodyRoutes.ContainsByPredicate([&Route](const FString& RedactedRoute) { return Route.Contains(RedactedRoute); });
+	if (Config.MaxBodyBytes > 0 && !bRedactedBody)
+	{
+		CopyContent(Request->GetContent(), Record.RequestContent);
+		if (Response.IsValid())
+		{
+			CopyContent(Response->GetContent(), Record.ResponseContent);
+		}
+	}
+}
+
+int32 FHttpTraceRecorder::GetRecordCount() const
+{
+	return Records.Num();
+}
+
+void FHttpTraceRecorder::Clear()
+{
+	Records.Empty();
+	NextRecord = 0;
+	Routes.Empty();
+	RouteIndices.Empty();
+}
+
+bool FHttpTraceRecorder::DumpToFile(const FString& FilePath) const
+{
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+
+	uint32 Magic = DumpMagic;
+	int32 Version = DumpVersion;
+	TArray<FString> RouteTable = Routes;
+	int32 RouteCount = RouteTable.Num();
+	Writer << Magic << Version << RouteCount;
+	for (FString& Route : RouteTable)
+	{
+		Writer << Route;
+	}
+
+	int32 RecordCount = Records.Num();
+	Writer << RecordCount;
+	for (int32 i = 0; i < RecordCount; i++)
+	{
+		// oldest first, NextRecord is the oldest once the buffer wrapped
+		FRecord Record = Records[(NextRecord + i) % RecordCount];
+		Writer << Record.Ticks << Record.RouteIndex << Record.Status << Record.Attempts << Record.LatencyMicroseconds
+			<< Record.BytesSent << Record.BytesReceived << Record.Headers << Record.RequestContent << Record.ResponseContent;
+	}
+
+	if (!FFileHelper::SaveArrayToFile(Data, *FilePath))
+	{
+		UE_LOG(LogAccelByteHttpTrace, Warning, TEXT("Failed to write HTTP trace to %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogAccelByteHttpTrace, Log, TEXT("Wrote %d HTTP trace records to %s"), RecordCount, *FilePath);
+	return true;
+}
+
+uint16 FHttpTraceRecorder::FindOrAddRoute(const FString& Route)
+{
+	if (const uint16* RouteIndex = RouteIndices.Find(Route))
+	{
+		return *RouteIndex;
+	}
+
+	// route templates are bounded by the number of endpoints, this only guards against malformed URLs
+	if (Routes.Num() >= MAX_uint16)
+	{
+		return FindOrAddRoute(OverflowRoute);
+	}
+
+	const uint16 RouteIndex = static_cast<uint16>(Routes.Add(Route));
+	RouteIndices.Add(Route, RouteIndex);
+
+	return RouteIndex;
+}
+
+bool FHttpTraceRecorder::IsRedactedHeader(const FString& Name) const
+{
+	return Config.RedactedHeaders.ContainsByPredicate([&Name](const FString& RedactedHeader) { return Name.Equals(RedactedHeader, ESearchCase::IgnoreCase); });
+}
+
+void FHttpTraceRecorder::CopyHeaders(const TArray<FString>& Headers, const TCHAR* Prefix, TArray<uint8>& OutHeaders) const
+{
+	FString Lines;
+	for (const FString& Header : Headers)
+	{
+		FString Name;
+		FString Value;
+		if (!Header.Split(TEXT(":"), &Name, &Value))
+		{
+			Name = Header;
+		}
+		Name.TrimStartAndEndInline();
+
+		Lines += Prefix;
+		Lines += Name;
+		Lines += TEXT(": ");
+		Lines += IsRedactedHeader(Name) ? FString(RedactedValue) : Value.TrimStartAndEnd();
+		Lines += TEXT("\n");
+	}
+
+	const FTCHARToUTF8 Converted(*Lines);
+	OutHeaders.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+}
+
+void FHttpTraceRecorder::CopyContent(const TArray<uint8>& Content, TArray<uint8>& OutContent) const
+{
+	OutContent.Append(Content.GetData(), FMath::Min(Content.Num(), Config.MaxBodyBytes));
+}
+
+}
@@ -0,0 +1,891 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteJsonDecoder.h"
+#include "Core/AccelByteHttpRetryScheduler.h"
+#include "JsonObjectConverter.h"
+#include "JsonObjectWrapper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/UnrealType.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteJsonDecoder, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteJsonDecoder);
+
+namespace AccelByte
+{
+
+namespace
+{
+#if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION < 25
+	using FProperty = UProperty;
+	using FStrProperty = UStrProperty;
+	using FNameProperty = UNameProperty;
+	using FTextProperty = UTextProperty;
+	using FBoolProperty = UBoolProperty;
+	using FNumericProperty = UNumericProperty;
+	using FEnumProperty = UEnumProperty;
+	using FArrayProperty = UArrayProperty;
+	using FMapProperty = UMapProperty;
+	using FStructProperty = UStructProperty;
+
+	template<typename T>
+	T* CastField(UProperty* Property)
+	{
+		return Cast<T>(Property);
+	}
+#endif
+
+	const uint32 BogusCodepoint = '?';
+
+	bool bAsyncDecodingEnabled = false;
+	bool bParseStatsEnabled = false;
+	int32 AsyncDecodingSizeThreshold = 64 * 1024;
+	FCriticalSection ParseStatsLock;
+	TMap<FString, FJsonParseStats> ParseStats;
+
+	template<typename ContainerType>
+	void AppendCodepoint(ContainerType& Chars, uint32 Codepoint)
+	{
+		if (sizeof(TCHAR) == 2 && Codepoint > 0xFFFF)
+		{
+			Codepoint -= 0x10000;
+			Chars.Add(static_cast<TCHAR>(0xD800 + (Codepoint >> 10)));
+			Chars.Add(static_cast<TCHAR>(0xDC00 + (Codepoint & 0x3FF)));
+			return;
+		}
+
+		Chars.Add(static_cast<TCHAR>(Codepoint));
+	}
+
+	/**
+	 * @brief Pull reader over a UTF-8 buffer that writes every value straight into the property it belongs to.
+	 */
+	class FJsonUtf8Reader
+	{
+	public:
+		FJsonUtf8Reader(const uint8* Data, int32 Length)
+			: Current(Data)
+			, End(Data + FMath::Max(Length, 0))
+		{
+			// byte order mark
+			if (Length >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF)
+			{
+				Current += 3;
+			}
+		}
+
+		bool ReadObject(const UStruct* StructDefinition, void* OutStruct)
+		{
+			if (!Consume('{'))
+			{
+				return false;
+			}
+			if (Consume('}'))
+			{
+				return true;
+			}
+
+			TArray<TCHAR, TInlineAllocator<64>> Key;
+			while (true)
+			{
+				Key.Reset();
+				if (!ReadStringChars([&Key](uint32 Codepoint) { AppendCodepoint(Key, Codepoint); }))
+				{
+					return false;
+				}
+				Key.Add(TEXT('\0'));
+
+				if (!Consume(':'))
+				{
+					return false;
+				}
+
+				FProperty* Property = FindProperty(StructDefinition, Key);
+				const bool bRead = Property != nullptr
+					? ReadValue(Property, Property->ContainerPtrToValuePtr<void>(OutStruct))
+					: SkipValue();
+				if (!bRead)
+				{
+					return false;
+				}
+
+				if (!Consume(','))
+				{
+					return Consume('}');
+				}
+			}
+		}
+
+		bool ReadObjectArray(const UStruct* StructDefinition, TFunctionRef<void*()> AddElement)
+		{
+			if (!Consume('['))
+			{
+				return false;
+			}
+			if (Consume(']'))
+			{
+				return true;
+			}
+
+			while (true)
+			{
+				void* Element = AddElement();
+				const bool bRead = Peek() == 'n' ? ReadLiteral("null") : ReadObject(StructDefinition, Element);
+				if (!bRead)
+				{
+					return false;
+				}
+
+				if (!Consume(','))
+				{
+					return Consume(']');
+				}
+			}
+		}
+
+	private:
+		const uint8* Current;
+		const uint8* const End;
+
+		void SkipWhitespace()
+		{
+			while (Current < End && (*Current == ' ' || *Current == '\t' || *Current == '\n' || *Current == '\r'))
+			{
+				Current++;
+			}
+		}
+
+		uint8 Peek()
+		{
+			SkipWhitespace();
+			return Current < End ? *Current : 0;
+		}
+
+		bool Consume(uint8 Char)
+		{
+			if (Peek() != Char)
+			{
+				return false;
+			}
+
+			Current++;
+			return true;
+		}
+
+		bool ReadLiteral(const ANSICHAR* Literal)
+		{
+			SkipWhitespace();
+			for (; *Literal != '\0'; Literal++, Current++)
+			{
+				if (Current >= End || *Current != static_cast<uint8>(*Literal))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		bool ReadHex4(uint32& OutValue)
+		{
+			if (Current + 4 > End)
+			{
+				return false;
+			}
+
+			OutValue = 0;
+			for (int32 i = 0; i < 4; i++, Current++)
+			{
+				const uint8 Char = *Current;
+				uint32 Digit;
+				if (Char >= '0' && Char <= '9')
+				{
+					Digit = Char - '0';
+				}
+				else if (Char >= 'a' && Char <= 'f')
+				{
+					Digit = Char - 'a' + 10;
+				}
+				else if (Char >= 'A' && Char <= 'F')
+				{
+					Digit = Char - 'A' + 10;
+				}
+				else
+				{
+					return false;
+				}
+				OutValue = (OutValue << 4) | Digit;
+			}
+
+			return true;
+		}
+
+		/**
+		 * @brief Decode a JSON string, passing every unicode code point to the functor.
+		 */
+		template<typename FunctorType>
+		bool ReadStringChars(FunctorType&& OnCodepoint)
+		{
+			if (!Consume('"'))
+			{
+				return false;
+			}
+
+			while (Current < End)
+			{
+				const uint8 Byte = *Current++;
+				if (Byte == '"')
+				{
+					return true;
+				}
+
+				if (Byte == '\\')
+				{
+					if (Current >= End)
+					{
+						return false;
+					}
+
+					const uint8 Escape = *Current++;
+					switch (Escape)
+					{
+					case '"':
+					case '\\':
+					case '/':
+						OnCodepoint(Escape);
+						break;
+					case 'b':
+						OnCodepoint('\b');
+						break;
+					case 'f':
+						OnCodepoint('\f');
+						break;
+					case 'n':
+						OnCodepoint('\n');
+						break;
+					case 'r':
+						OnCodepoint('\r');
+						break;
+					case 't':
+						OnCodepoint('\t');
+						break;
+					case 'u':
+					{
+						uint32 Codepoint;
+						if (!ReadHex4(Codepoint))
+						{
+							return false;
+						}
+
+						// surrogate pair encoded as two escapes
+						if (Codepoint >= 0xD800 && Codepoint <= 0xDBFF && Current + 2 <= End && Current[0] == '\\' && Current[1] == 'u')
+						{
+							Current += 2;
+							uint32 LowSurrogate;
+							if (!ReadHex4(LowSurrogate))
+							{
+								return false;
+							}
+
+							if (LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+							{
+								Codepoint = 0x10000 + ((Codepoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+							}
+							else
+							{
+								OnCodepoint(BogusCodepoint);
+								Codepoint = LowSurrogate;
+							}
+						}
+
+						OnCodepoint(Codepoint);
+						break;
+					}
+					default:
+						return false;
+					}
+					continue;
+				}
+
+				if (Byte < 0x80)
+				{
+					OnCodepoint(Byte);
+					continue;
+				}
+
+				int32 ContinuationBytes;
+				uint32 Codepoint;
+				if ((Byte & 0xE0) == 0xC0)
+				{
+					ContinuationBytes = 1;
+					Codepoint = Byte & 0x1F;
+				}
+				else if ((Byte & 0xF0) == 0xE0)
+				{
+					ContinuationBytes = 2;
+					Codepoint = Byte & 0x0F;
+				}
+				else if ((Byte & 0xF8) == 0xF0)
+				{
+					ContinuationBytes = 3;
+					Codepoint = Byte & 0x07;
+				}
+				else
+				{
+					OnCodepoint(BogusCodepoint);
+					continue;
+				}
+
+				for (; ContinuationBytes > 0 && Current < End && (*Current & 0xC0) == 0x80; ContinuationBytes--, Current++)
+				{
+					Codepoint = (Codepoint << 6) | (*Current & 0x3F);
+				}
+
+				OnCodepoint(ContinuationBytes == 0 ? Codepoint : BogusCodepoint);
+			}
+
+			return false;
+		}
+
+		bool ReadString(FString& OutString)
+		{
+			// decoded in place into the property's own buffer
+			TArray<TCHAR>& Chars = OutString.GetCharArray();
+			Chars.Reset();
+
+			if (!ReadStringChars([&Chars](uint32 Codepoint) { AppendCodepoint(Chars, Codepoint); }))
+			{
+				return false;
+			}
+
+			if (Chars.Num() > 0)
+			{
+				Chars.Add(TEXT('\0'));
+			}
+
+			return true;
+		}
+
+		bool ReadName(FName& OutName)
+		{
+			TArray<TCHAR, TInlineAllocator<128>> Chars;
+			if (!ReadStringChars([&Chars](uint32 Codepoint) { AppendCodepoint(Chars, Codepoint); }))
+			{
+				return false;
+			}
+			Chars.Add(TEXT('\0'));
+
+			OutName = Chars.Num() < NAME_SIZE ? FName(Chars.GetData()) : NAME_None;
+			return true;
+		}
+
+		bool ReadNumber(double& OutDouble, int64& OutInteger)
+		{
+			SkipWhitespace();
+
+			ANSICHAR Buffer[64];
+			int32 Length = 0;
+			bool bIsInteger = true;
+			while (Current < End)
+			{
+				const uint8 Char = *Current;
+				if (Char == '.' || Char == 'e' || Char == 'E')
+				{
+					bIsInteger = false;
+				}
+				else if (!((Char >= '0' && Char <= '9') || Char == '-' || Char == '+'))
+				{
+					break;
+				}
+
+				if (Length >= static_cast<int32>(sizeof(Buffer)) - 1)
+				{
+					return false;
+				}
+				Buffer[Length++] = static_cast<ANSICHAR>(Char);
+				Current++;
+			}
+
+			if (Length == 0)
+			{
+				return false;
+			}
+			Buffer[Length] = '\0';
+
+			OutDouble = FCStringAnsi::Atod(Buffer);
+			OutInteger = bIsInteger ? FCStringAnsi::Atoi64(Buffer) : static_cast<int64>(OutDouble);
+
+			return true;
+		}
+
+		bool SkipValue()
+		{
+			switch (Peek())
+			{
+			case '"':
+				return ReadStringChars([](uint32) {});
+			case '{':
+			case '[':
+			{
+				int32 Depth = 0;
+				while (Current < End)
+				{
+					const uint8 Char = *Current;
+					if (Char == '"')
+					{
+						if (!ReadStringChars([](uint32) {}))
+						{
+							return false;
+						}
+						continue;
+					}
+
+					Current++;
+					if (Char == '{' || Char == '[')
+					{
+						Depth++;
+					}
+					else if ((Char == '}' || Char == ']') && --Depth == 0)
+					{
+						return true;
+					}
+				}
+				return false;
+			}
+			case 't':
+				return ReadLiteral("true");
+			case 'f':
+				return ReadLiteral("false");
+			case 'n':
+				return ReadLiteral("null");
+			default:
+			{
+				double Double;
+				int64 Integer;
+				return ReadNumber(Double, Integer);
+			}
+			}
+		}
+
+		FProperty* FindProperty(const UStruct* StructDefinition, const TArray<TCHAR, TInlineAllocator<64>>& Key) const
+		{
+			if (Key.Num() <= 1 || Key.Num() >= NAME_SIZE)
+			{
+				return nullptr;
+			}
+
+			// a key that was never used as a name can't be a property, FName comparison ignores case like FJsonObjectConverter does
+			const FName Name(Key.GetData(), FNAME_Find);
+			if (Name.IsNone())
+			{
+				return nullptr;
+			}
+
+			return StructDefinition->FindPropertyByName(Name);
+		}
+
+		/**
+		 * @brief Read an enum by name. A name the enum doesn't have fails the decode like FJsonObjectConverter fails
+		 * the import, so the caller's fallback gives the same result as before instead of keeping the default value.
+		 */
+		bool ReadEnum(const UEnum* Enum, FNumericProperty* UnderlyingProperty, void* ValuePtr)
+		{
+			FName Name;
+			if (!ReadName(Name))
+			{
+				return false;
+			}
+
+			const int64 Value = Enum->GetValueByName(Name);
+			if (Value == INDEX_NONE)
+			{
+				UE_LOG(LogAccelByteJsonDecoder, Warning, TEXT("Unable to import enum %s from string value %s"), *Enum->GetName(), *Name.ToString());
+				return false;
+			}
+
+			UnderlyingProperty->SetIntPropertyValue(ValuePtr, Value);
+			return true;
+		}
+
+		bool ReadDateTime(FDateTime& OutDateTime)
+		{
+			FString DateString;
+			if (!ReadString(DateString))
+			{
+				return false;
+			}
+
+			if (DateString == TEXT("min"))
+			{
+				OutDateTime = FDateTime::MinValue();
+			}
+			else if (DateString == TEXT("max"))
+			{
+				OutDateTime = FDateTime::MaxValue();
+			}
+			else if (DateString == TEXT("now"))
+			{
+				OutDateTime = FDateTime::UtcNow();
+			}
+			else if (!FDateTime::ParseIso8601(*DateString, OutDateTime) && !FDateTime::Parse(DateString, OutDateTime))
+			{
+				UE_LOG(LogAccelByteJsonDecoder, Warning, TEXT("Unable to import FDateTime from %s"), *DateString);
+			}
+
+			return true;
+		}
+
+		bool ReadArray(FArrayProperty* ArrayProperty, void* ValuePtr)
+		{
+			FScriptArrayHelper Helper(ArrayProperty, ValuePtr);
+			Helper.EmptyValues();
+
+			if (!Consume('['))
+			{
+				return false;
+			}
+			if (Consume(']'))
+			{
+				return true;
+			}
+
+			while (true)
+			{
+				const int32 Index = Helper.AddValue();
+				if (!ReadValue(ArrayProperty->Inner, Helper.GetRawPtr(Index)))
+				{
+					return false;
+				}
+
+				if (!Consume(','))
+				{
+					return Consume(']');
+				}
+			}
+		}
+
+		bool ReadStringMap(FMapProperty* MapProperty, FStrProperty* KeyProperty, void* ValuePtr)
+		{
+			FScriptMapHelper Helper(MapProperty, ValuePtr);
+			Helper.EmptyValues();
+
+			if (!Consume('{'))
+			{
+				return false;
+			}
+			if (Consume('}'))
+			{
+				return true;
+			}
+
+			while (true)
+			{
+				FString Key;
+				if (!ReadString(Key) || !Consume(':'))
+				{
+					Helper.Rehash();
+					return false;
+				}
+
+				if (Peek() == 'n')
+				{
+					// FJsonObjectConverter leaves null entries out of the map
+					if (!ReadLiteral("null"))
+					{
+						Helper.Rehash();
+						return false;
+					}
+				}
+				else
+				{
+					const int32 Index = Helper.AddDefaultValue_Invalid_NeedsRehash();
+					uint8* PairPtr = Helper.GetPairPtr(Index);
+					*KeyProperty->GetPropertyValuePtr(MapProperty->KeyProp->ContainerPtrToValuePtr<void>(PairPtr)) = MoveTemp(Key);
+
+					if (!ReadValue(MapProperty->ValueProp, MapProperty->ValueProp->ContainerPtrToValuePtr<void>(PairPtr)))
+					{
+						Helper.Rehash();
+						return false;
+					}
+				}
+
+				if (!Consume(','))
+				{
+					Helper.Rehash();
+					return Consume('}');
+				}
+			}
+		}
+
+		/**
+		 * @brief Read one value into the property, anything without a native path goes through FJsonObjectConverter.
+		 */
+		bool ReadValue(FProperty* Property, void* ValuePtr)
+		{
+			const uint8 Next = Peek();
+			if (Next == 'n')
+			{
+				// null keeps the default value
+				return ReadLiteral("null");
+			}
+
+			if (Property->ArrayDim != 1)
+			{
+				return ReadFallback(Property, ValuePtr);
+			}
+
+			if (FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+			{
+				if (Next == '"')
+				{
+					return ReadString(*StrProperty->GetPropertyValuePtr(ValuePtr));
+				}
+			}
+			else if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+			{
+				const UEnum* Enum = NumericProperty->GetIntPropertyEnum();
+				if (Enum != nullptr && Next == '"')
+				{
+					return ReadEnum(Enum, NumericProperty, ValuePtr);
+				}
+
+				if (Next == '-' || (Next >= '0' && Next <= '9'))
+				{
+					double Double;
+					int64 Integer;
+					if (!ReadNumber(Double, Integer))
+					{
+						return false;
+					}
+
+					if (NumericProperty->IsFloatingPoint())
+					{
+						NumericProperty->SetFloatingPointPropertyValue(ValuePtr, Double);
+					}
+					else if (NumericProperty->IsInteger())
+					{
+						NumericProperty->SetIntPropertyValue(ValuePtr, Integer);
+					}
+					return true;
+				}
+			}
+			else if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+			{
+				if (Next == 't' || Next == 'f')
+				{
+					BoolProperty->SetPropertyValue(ValuePtr, Next == 't');
+					return ReadLiteral(Next == 't' ? "true" : "false");
+				}
+			}
+			else if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+			{
+				if (Next == '"')
+				{
+					return ReadEnum(EnumProperty->GetEnum(), EnumProperty->GetUnderlyingProperty(), ValuePtr);
+				}
+
+				if (Next == '-' || (Next >= '0' && Next <= '9'))
+				{
+					double Double;
+					int64 Integer;
+					if (!ReadNumber(Double, Integer))
+					{
+						return false;
+					}
+
+					EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(ValuePtr, Integer);
+					return true;
+				}
+			}
+			else if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				if (Next == '{' && StructProperty->Struct != FJsonObjectWrapper::StaticStruct())
+				{
+					return ReadObject(StructProperty->Struct, ValuePtr);
+				}
+
+				if (Next == '"' && StructProperty->Struct == TBaseStructure<FDateTime>::Get())
+				{
+					return ReadDateTime(*static_cast<FDateTime*>(ValuePtr));
+				}
+			}
+			else if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+			{
+				if (Next == '[')
+				{
+					return ReadArray(ArrayProperty, ValuePtr);
+				}
+			}
+			else if (FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+			{
+				FStrProperty* KeyProperty = CastField<FStrProperty>(MapProperty->KeyProp);
+				if (Next == '{' && KeyProperty != nullptr)
+				{
+					return ReadStringMap(MapProperty, KeyProperty, ValuePtr);
+				}
+			}
+			else if (FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+			{
+				if (Next == '"')
+				{
+					return ReadName(*NameProperty->GetPropertyValuePtr(ValuePtr));
+				}
+			}
+			else if (FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+			{
+				if (Next == '"')
+				{
+					FString Text;
+					if (!ReadString(Text))
+					{
+						return false;
+					}
+
+					TextProperty->SetPropertyValue(ValuePtr, FText::FromString(MoveTemp(Text)));
+					return true;
+				}
+			}
+
+			return ReadFallback(Property, ValuePtr);
+		}
+
+		/**
+		 * @brief Convert a single value with FJsonObjectConverter, for types and type mismatches without a native path.
+		 */
+		bool ReadFallback(FProperty* Property, void* ValuePtr)
+		{
+			SkipWhitespace();
+			const uint8* const Start = Current;
+			if (!SkipValue())
+			{
+				return false;
+			}
+
+			// wrapped in an object, older engines can't deserialize a bare value
+			const FUTF8ToTCHAR Value(reinterpret_cast<const ANSICHAR*>(Start), static_cast<int32>(Current - Start));
+			FString Wrapped = TEXT("{\"v\":");
+			Wrapped.AppendChars(Value.Get(), Value.Length());
+			Wrapped.AppendChar(TEXT('}'));
+
+			TSharedPtr<FJsonObject> JsonObject;
+			const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Wrapped);
+			if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+			{
+				return false;
+			}
+
+			if (!FJsonObjectConverter::JsonValueToUProperty(JsonObject->TryGetField(TEXT("v")), Property, ValuePtr, 0, 0))
+			{
+				UE_LOG(LogAccelByteJsonDecoder, Warning, TEXT("Unable to import property %s"), *Property->GetName());
+			}
+
+			return true;
+		}
+	};
+}
+
+const int32 FAsyncJsonDecoding::DefaultSizeThreshold = 64 * 1024;
+const FString* FAsyncJsonDecoding::CompletingRouteTemplate = nullptr;
+
+void FAsyncJsonDecoding::SetEnabled(bool bEnabled)
+{
+	bAsyncDecodingEnabled = bEnabled;
+}
+
+void FAsyncJsonDecoding::SetSizeThreshold(int32 Bytes)
+{
+	AsyncDecodingSizeThreshold = FMath::Max(Bytes, 0);
+}
+
+bool FAsyncJsonDecoding::ShouldDecodeAsync(int32 ContentLength)
+{
+	return bAsyncDecodingEnabled && ContentLength >= AsyncDecodingSizeThreshold && FPlatformProcess::SupportsMultithreading();
+}
+
+void FAsyncJsonDecoding::SetParseStatsEnabled(bool bEnabled)
+{
+	bParseStatsEnabled = bEnabled;
+}
+
+bool FAsyncJsonDecoding::IsParseStatsEnabled()
+{
+	return bParseStatsEnabled;
+}
+
+FString FAsyncJsonDecoding::GetCompletingRouteTemplate(const FString& Url)
+{
+	if (CompletingRouteTemplate != nullptr && !CompletingRouteTemplate->IsEmpty())
+	{
+		return *CompletingRouteTemplate;
+	}
+
+	return HttpRequest::GetRouteTemplate(Url);
+}
+
+void FAsyncJsonDecoding::RecordParse(const FString& RouteTemplate, int32 Bytes, double Seconds, bool bAsync)
+{
+	FScopeLock Lock(&ParseStatsLock);
+	FJsonParseStats* Found = ParseStats.Find(RouteTemplate);
+	if (Found == nullptr)
+	{
+		// same bound as the HTTP metrics, the guessed template of an unusual URL may still hold an ID
+		Found = &ParseStats.FindOrAdd(ParseStats.Num() < FHttpMetrics::MaxRoutes ? RouteTemplate : FHttpMetrics::OtherRoute);
+	}
+	FJsonParseStats& Stats = *Found;
+	Stats.Count++;
+	Stats.AsyncCount += bAsync ? 1 : 0;
+	Stats.TotalBytes += Bytes;
+	Stats.TotalTime += Seconds;
+	Stats.MaxTime = FMath::Max(Stats.MaxTime, Seconds);
+}
+
+TMap<FString, FJsonParseStats> FAsyncJsonDecoding::GetParseStats()
+{
+	FScopeLock Lock(&ParseStatsLock);
+	return ParseStats;
+}
+
+void FAsyncJsonDecoding::ResetParseStats()
+{
+	FScopeLock Lock(&ParseStatsLock);
+	ParseStats.Empty();
+}
+
+void FAsyncJsonDecoding::DumpParseStats()
+{
+	TMap<FString, FJsonParseStats> Stats = GetParseStats();
+	Stats.ValueSort([](const FJsonParseStats& A, const FJsonParseStats& B) { return A.TotalTime > B.TotalTime; });
+
+	for (const auto& Entry : Stats)
+	{
+		UE_LOG(LogAccelByteJsonDecoder, Log, TEXT("%s: %lld parses (%lld async), %lld bytes, avg %.3f ms, max %.3f ms"),
+			*Entry.Key, Entry.Value.Count, Entry.Value.AsyncCount, Entry.Value.TotalBytes,
+			Entry.Value.GetAverageTime() * 1000.0, Entry.Value.MaxTime * 1000.0);
+	}
+}
+
+bool FJsonStructDecoder::DecodeStruct(const uint8* Utf8Data, int32 Length, const UStruct* StructDefinition, void* OutStruct)
+{
+	if (Utf8Data == nullptr || StructDefinition == nullptr || OutStruct == nullptr)
+	{
+		return false;
+	}
+
+	FJsonUtf8Reader Reader(Utf8Data, Length);
+	return Reader.ReadObject(StructDefinition, OutStruct);
+}
+
+bool FJsonStructDecoder::DecodeStructArray(const uint8* Utf8Data, int32 Length, const UStruct* StructDefinition, TFunctionRef<void*()> AddElement)
+{
+	if (Utf8Data == nullptr || StructDefinition == nullptr)
+	{
+		return false;
+	}
+
+	FJsonUtf8Reader Reader(Utf8Data, Length);
+	return Reader.ReadObjectArray(StructDefinition, AddElement);
+}
+
+}
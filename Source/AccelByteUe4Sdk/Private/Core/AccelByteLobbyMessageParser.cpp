@@ -0,0 +1,545 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteLobbyMessageParser.h"
+#include "Core/AccelByteJsonDecoder.h"
+#include "JsonObjectConverter.h"
+#include "JsonObjectWrapper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/UnrealType.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteLobbyParser, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteLobbyParser);
+
+namespace AccelByte
+{
+
+namespace
+{
+#if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION < 25
+	using FProperty = UProperty;
+	using FStrProperty = UStrProperty;
+	using FNameProperty = UNameProperty;
+	using FTextProperty = UTextProperty;
+	using FBoolProperty = UBoolProperty;
+	using FNumericProperty = UNumericProperty;
+	using FEnumProperty = UEnumProperty;
+	using FArrayProperty = UArrayProperty;
+	using FStructProperty = UStructProperty;
+
+	template<typename T>
+	T* CastField(UProperty* Property)
+	{
+		return Cast<T>(Property);
+	}
+#endif
+
+	bool IsWhitespace(TCHAR Char)
+	{
+		return Char == TEXT(' ') || Char == TEXT('\t') || Char == TEXT('\r');
+	}
+
+	int32 ParseHex4(const TCHAR* Chars)
+	{
+		int32 Value = 0;
+		for (int32 i = 0; i < 4; i++)
+		{
+			const TCHAR Char = Chars[i];
+			int32 Digit;
+			if (Char >= TEXT('0') && Char <= TEXT('9'))
+			{
+				Digit = Char - TEXT('0');
+			}
+			else if (Char >= TEXT('a') && Char <= TEXT('f'))
+			{
+				Digit = Char - TEXT('a') + 10;
+			}
+			else if (Char >= TEXT('A') && Char <= TEXT('F'))
+			{
+				Digit = Char - TEXT('A') + 10;
+			}
+			else
+			{
+				return -1;
+			}
+			Value = (Value << 4) | Digit;
+		}
+
+		return Value;
+	}
+
+	/**
+	 * @brief Copy a value, resolving the JSON escapes LobbyMessageToJson left to the JSON parser.
+	 */
+	FString Unescape(const TCHAR* Chars, int32 Len)
+	{
+		if (FCString::Strnchr(Chars, TEXT('\\'), Len) == nullptr)
+		{
+			return FString(Len, Chars);
+		}
+
+		FString Result;
+		Result.Reserve(Len);
+		for (int32 i = 0; i < Len; i++)
+		{
+			if (Chars[i] != TEXT('\\') || i + 1 >= Len)
+			{
+				Result.AppendChar(Chars[i]);
+				continue;
+			}
+
+			const TCHAR Escaped = Chars[++i];
+			switch (Escaped)
+			{
+			case TEXT('n'): Result.AppendChar(TEXT('\n')); break;
+			case TEXT('r'): Result.AppendChar(TEXT('\r')); break;
+			case TEXT('t'): Result.AppendChar(TEXT('\t')); break;
+			case TEXT('b'): Result.AppendChar(TEXT('\b')); break;
+			case TEXT('f'): Result.AppendChar(TEXT('\f')); break;
+			case TEXT('u'):
+			{
+				const int32 Codepoint = i + 4 < Len ? ParseHex4(Chars + i + 1) : -1;
+				if (Codepoint < 0)
+				{
+					Result.AppendChar(Escaped);
+					break;
+				}
+				Result.AppendChar(static_cast<TCHAR>(Codepoint));
+				i += 4;
+				break;
+			}
+			default: Result.AppendChar(Escaped); break;
+			}
+		}
+
+		return Result;
+	}
+
+	/**
+	 * @brief Writes field values of one frame into the properties they belong to.
+	 */
+	class FLobbyValueReader
+	{
+	public:
+		explicit FLobbyValueReader(const TCHAR* InData)
+			: Data(InData)
+		{
+		}
+
+		FProperty* FindProperty(const UStruct* StructDefinition, int32 Start, int32 Len) const
+		{
+			if (Len <= 0 || Len >= NAME_SIZE)
+			{
+				return nullptr;
+			}
+
+			TArray<TCHAR, TInlineAllocator<64>> Key;
+			Key.Append(Data + Start, Len);
+			Key.Add(TEXT('\0'));
+
+			// a key that was never used as a name can't be a property, FName comparison ignores case like FJsonObjectConverter does
+			const FName Name(Key.GetData(), FNAME_Find);
+			if (Name.IsNone())
+			{
+				return nullptr;
+			}
+
+			return StructDefinition->FindPropertyByName(Name);
+		}
+
+		bool ReadValue(FProperty* Property, void* ValuePtr, int32 Start, int32 Len) const
+		{
+			const TCHAR First = Len > 0 ? Data[Start] : TEXT('\0');
+			if (Property->ArrayDim == 1)
+			{
+				if (First == TEXT('['))
+				{
+					if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+					{
+						return ReadArray(ArrayProperty, ValuePtr, Start, Len);
+					}
+				}
+				else if (First == TEXT('{'))
+				{
+					FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+					if (StructProperty != nullptr && StructProperty->Struct != FJsonObjectWrapper::StaticStruct())
+					{
+						const FTCHARToUTF8 Utf8(Data + Start, Len);
+						return FJsonStructDecoder::DecodeStruct(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length(), StructProperty->Struct, ValuePtr);
+					}
+				}
+			}
+
+			if (First == TEXT('{') || First == TEXT('['))
+			{
+				return ReadJsonFallback(Property, ValuePtr, Start, Len);
+			}
+
+			ReadScalar(Property, ValuePtr, Unescape(Data + Start, Len));
+			return true;
+		}
+
+	private:
+		const TCHAR* const Data;
+
+		/**
+		 * @brief Split "[a, "b, c", {...}]" into its elements the way LobbyMessageToJson did.
+		 */
+		bool ReadArray(FArrayProperty* ArrayProperty, void* ValuePtr, int32 Start, int32 Len) const
+		{
+			if (Len < 2 || Data[Start + Len - 1] != TEXT(']'))
+			{
+				return false;
+			}
+
+			FScriptArrayHelper Helper(ArrayProperty, ValuePtr);
+			Helper.EmptyValues();
+
+			int32 Current = Start + 1;
+			const int32 End = Start + Len - 1;
+			while (Current < End)
+			{
+				while (Current < End && IsWhitespace(Data[Current]))
+				{
+					Current++;
+				}
+				if (Current >= End)
+				{
+					break;
+				}
+
+				const int32 ElementStart = Current;
+				const TCHAR First = Data[Current];
+				bool bRead = true;
+				if (First == TEXT('"'))
+				{
+					Current++;
+					while (Current < End && Data[Current] != TEXT('"'))
+					{
+						Current += Data[Current] == TEXT('\\') ? 2 : 1;
+					}
+					if (Current >= End)
+					{
+						return false;
+					}
+
+					const int32 Index = Helper.AddValue();
+					ReadScalar(ArrayProperty->Inner, Helper.GetRawPtr(Index), Unescape(Data + ElementStart + 1, Current - ElementStart - 1));
+					Current++;
+				}
+				else if (First == TEXT('{') || First == TEXT('['))
+				{
+					if (!SkipNested(Current, End))
+					{
+						return false;
+					}
+
+					const int32 Index = Helper.AddValue();
+					bRead = ReadValue(ArrayProperty->Inner, Helper.GetRawPtr(Index), ElementStart, Current - ElementStart);
+				}
+				else
+				{
+					while (Current < End && Data[Current] != TEXT(','))
+					{
+						Current++;
+					}
+
+					int32 ElementEnd = Current;
+					while (ElementEnd > ElementStart && IsWhitespace(Data[ElementEnd - 1]))
+					{
+						ElementEnd--;
+					}
+
+					const int32 Index = Helper.AddValue();
+					ReadScalar(ArrayProperty->Inner, Helper.GetRawPtr(Index), Unescape(Data + ElementStart, ElementEnd - ElementStart));
+				}
+
+				if (!bRead)
+				{
+					return false;
+				}
+
+				while (Current < End && Data[Current] != TEXT(','))
+				{
+					Current++;
+				}
+				Current++;
+			}
+
+			return true;
+		}
+
+		bool SkipNested(int32& Current, int32 End) const
+		{
+			int32 Depth = 0;
+			bool bInString = false;
+			for (; Current < End; Current++)
+			{
+				const TCHAR Char = Data[Current];
+				if (bInString)
+				{
+					if (Char == TEXT('\\'))
+					{
+						Current++;
+					}
+					else if (Char == TEXT('"'))
+					{
+						bInString = false;
+					}
+					continue;
+				}
+
+				if (Char == TEXT('"'))
+				{
+					bInString = true;
+				}
+				else if (Char == TEXT('{') || Char == TEXT('['))
+				{
+					Depth++;
+				}
+				else if ((Char == TEXT('}') || Char == TEXT(']')) && --Depth == 0)
+				{
+					Current++;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		void ReadScalar(FProperty* Property, void* ValuePtr, FString&& Value) const
+		{
+			if (Property->ArrayDim == 1)
+			{
+				if (FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+				{
+					*StrProperty->GetPropertyValuePtr(ValuePtr) = MoveTemp(Value);
+					return;
+				}
+
+				if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+				{
+					const UEnum* Enum = NumericProperty->GetIntPropertyEnum();
+					if (Enum != nullptr && !Value.IsNumeric())
+					{
+						ReadEnum(Enum, NumericProperty, Value, ValuePtr);
+					}
+					else if (NumericProperty->IsFloatingPoint())
+					{
+						NumericProperty->SetFloatingPointPropertyValue(ValuePtr, FCString::Atod(*Value));
+					}
+					else if (NumericProperty->IsInteger())
+					{
+						NumericProperty->SetIntPropertyValue(ValuePtr, FCString::Atoi64(*Value));
+					}
+					return;
+				}
+
+				if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+				{
+					BoolProperty->SetPropertyValue(ValuePtr, FCString::ToBool(*Value));
+					return;
+				}
+
+				if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+				{
+					if (Value.IsNumeric())
+					{
+						EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(ValuePtr, FCString::Atoi64(*Value));
+					}
+					else
+					{
+						ReadEnum(EnumProperty->GetEnum(), EnumProperty->GetUnderlyingProperty(), Value, ValuePtr);
+					}
+					return;
+				}
+
+				if (FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+				{
+					*NameProperty->GetPropertyValuePtr(ValuePtr) = FName(*Value);
+					return;
+				}
+
+				if (FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+				{
+					TextProperty->SetPropertyValue(ValuePtr, FText::FromString(MoveTemp(Value)));
+					return;
+				}
+			}
+
+			// everything else gets the string value LobbyMessageToJson used to produce
+			if (!FJsonObjectConverter::JsonValueToUProperty(MakeShared<FJsonValueString>(MoveTemp(Value)), Property, ValuePtr, 0, 0))
+			{
+				UE_LOG(LogAccelByteLobbyParser, Warning, TEXT("Unable to import property %s"), *Property->GetName());
+			}
+		}
+
+		void ReadEnum(const UEnum* Enum, FNumericProperty* UnderlyingProperty, const FString& Value, void* ValuePtr) const
+		{
+			const int64 EnumValue = Enum->GetValueByNameString(Value);
+			if (EnumValue == INDEX_NONE)
+			{
+				UE_LOG(LogAccelByteLobbyParser, Warning, TEXT("Unable to import enum %s from string value %s"), *Enum->GetName(), *Value);
+				return;
+			}
+
+			UnderlyingProperty->SetIntPropertyValue(ValuePtr, EnumValue);
+		}
+
+		/**
+		 * @brief Convert a JSON value with FJsonObjectConverter, for maps, object wrappers and other types without a native path.
+		 */
+		bool ReadJsonFallback(FProperty* Property, void* ValuePtr, int32 Start, int32 Len) const
+		{
+			// wrapped in an object, older engines can't deserialize a bare value
+			FString Wrapped = TEXT("{\"v\":");
+			Wrapped.AppendChars(Data + Start, Len);
+			Wrapped.AppendChar(TEXT('}'));
+
+			TSharedPtr<FJsonObject> JsonObject;
+			const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Wrapped);
+			if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+			{
+				return false;
+			}
+
+			if (!FJsonObjectConverter::JsonValueToUProperty(JsonObject->TryGetField(TEXT("v")), Property, ValuePtr, 0, 0))
+			{
+				UE_LOG(LogAccelByteLobbyParser, Warning, TEXT("Unable to import property %s"), *Property->GetName());
+			}
+
+			return true;
+		}
+	};
+}
+
+FLobbyMessageParser::FLobbyMessageParser(const FString& InMessage)
+	: Message(InMessage)
+{
+	const TCHAR* Data = *Message;
+	const int32 Length = Message.Len();
+
+	int32 LineStart = 0;
+	while (LineStart < Length)
+	{
+		int32 LineEnd = LineStart;
+		while (LineEnd < Length && Data[LineEnd] != TEXT('\n'))
+		{
+			LineEnd++;
+		}
+
+		// the key ends at the first ": " of the line, the value may contain more of them
+		for (int32 i = LineStart; i + 1 < LineEnd; i++)
+		{
+			if (Data[i] != TEXT(':') || Data[i + 1] != TEXT(' '))
+			{
+				continue;
+			}
+
+			FField& Field = Fields.AddDefaulted_GetRef();
+			int32 KeyStart = LineStart;
+			int32 KeyEnd = i;
+			while (KeyStart < KeyEnd && IsWhitespace(Data[KeyStart]))
+			{
+				KeyStart++;
+			}
+			while (KeyEnd > KeyStart && IsWhitespace(Data[KeyEnd - 1]))
+			{
+				KeyEnd--;
+			}
+			int32 ValueStart = i + 2;
+			int32 ValueEnd = LineEnd;
+			while (ValueStart < ValueEnd && IsWhitespace(Data[ValueStart]))
+			{
+				ValueStart++;
+			}
+			while (ValueEnd > ValueStart && IsWhitespace(Data[ValueEnd - 1]))
+			{
+				ValueEnd--;
+			}
+
+			Field.Key = { KeyStart, KeyEnd - KeyStart };
+			Field.Value = { ValueStart, ValueEnd - ValueStart };
+			break;
+		}
+
+		LineStart = LineEnd + 1;
+	}
+
+	Type = GetStringField(TEXT("type"));
+}
+
+const FString& FLobbyMessageParser::GetType() const
+{
+	return Type;
+}
+
+const FString& FLobbyMessageParser::GetMessage() const
+{
+	return Message;
+}
+
+bool FLobbyMessageParser::HasField(const TCHAR* Key) const
+{
+	return FindField(Key) != nullptr;
+}
+
+FString FLobbyMessageParser::GetStringField(const TCHAR* Key) const
+{
+	const FField* Field = FindField(Key);
+	if (Field == nullptr)
+	{
+		return FString();
+	}
+
+	return Unescape(*Message + Field->Value.Start, Field->Value.Len);
+}
+
+int32 FLobbyMessageParser::GetIntegerField(const TCHAR* Key) const
+{
+	const FField* Field = FindField(Key);
+	if (Field == nullptr)
+	{
+		return 0;
+	}
+
+	// stops at the end of the digits, no copy of the value needed
+	return FCString::Atoi(*Message + Field->Value.Start);
+}
+
+bool FLobbyMessageParser::DecodeStruct(const UStruct* StructDefinition, void* OutStruct) const
+{
+	if (StructDefinition == nullptr || OutStruct == nullptr)
+	{
+		return false;
+	}
+
+	const FLobbyValueReader Reader(*Message);
+	bool bSuccess = true;
+	for (const FField& Field : Fields)
+	{
+		FProperty* Property = Reader.FindProperty(StructDefinition, Field.Key.Start, Field.Key.Len);
+		if (Property != nullptr && !Reader.ReadValue(Property, Property->ContainerPtrToValuePtr<void>(OutStruct), Field.Value.Start, Field.Value.Len))
+		{
+			UE_LOG(LogAccelByteLobbyParser, Warning, TEXT("Malformed value of %s in lobby message %s"), *Property->GetName(), *Type);
+			bSuccess = false;
+		}
+	}
+
+	return bSuccess;
+}
+
+const FLobbyMessageParser::FField* FLobbyMessageParser::FindField(const TCHAR* Key) const
+{
+	const TCHAR* Data = *Message;
+	const int32 KeyLen = FCString::Strlen(Key);
+
+	return Fields.FindByPredicate([Data, Key, KeyLen](const FField& Field)
+	{
+		return Field.Key.Len == KeyLen && FCString::Strnicmp(Data + Field.Key.Start, Key, KeyLen) == 0;
+	});
+}
+
+}
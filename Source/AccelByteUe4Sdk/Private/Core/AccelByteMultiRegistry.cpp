@@ -3,22 +3,267 @@
 // and restrictions contact your company contract manager.
 
 #include "Core/AccelByteMultiRegistry.h"
+#include "Core/AccelByteTimerService.h"
+#include "Misc/ScopeRWLock.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Async/Async.h"
 
 using namespace AccelByte;
 using namespace AccelByte::Api;
 
-TSharedPtr<FApiClient> AccelByte::FMultiRegistry::GetApiClient(FString key)
+namespace
 {
-	if (!ApiClientInstances.Contains(key))
+	struct FApiClientEntry
 	{
-		TSharedPtr<FApiClient> NewClient = MakeShared<FApiClient>();
+		FApiClientPtr Client;
+		FThreadSafeCounter64 LastAccessMs;
+	};
 
-		NewClient->Credentials.SetClientCredentials(FRegistry::Settings.ClientId, FRegistry::Settings.ClientSecret);
+	struct FApiClientShard
+	{
+		FRWLock Lock;
+		TMap<FString, FApiClientEntry> Clients;
+	};
+
+	const int32 ApiClientShardCount = 16;
+	FApiClientShard ApiClientShards[ApiClientShardCount];
 
-		ApiClientInstances.Add(key, NewClient);
+	int64 GetAccessTimeMs()
+	{
+		return static_cast<int64>(FPlatformTime::Seconds() * 1000.0);
+	}
+
+	FApiClientShard& GetShard(uint32 KeyHash)
+	{
+		return ApiClientShards[KeyHash % ApiClientShardCount];
+	}
+
+	// the last reference may be dropped on any thread, the timers removed by the client's destructor are game thread only
+	void DeleteApiClient(FApiClient* Client)
+	{
+		if (IsInGameThread())
+		{
+			delete Client;
+			return;
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [Client]()
+		{
+			delete Client;
+		});
+	}
+
+	// lobby, telemetry and timers are game thread only, so removed clients are shut down and released there
+	void ReleaseApiClient(FApiClientPtr&& Client)
+	{
+		if (IsInGameThread())
+		{
+			Client->Shutdown();
+			Client.Reset();
+			return;
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [Client = MoveTemp(Client)]() mutable
+		{
+			Client->Shutdown();
+			Client.Reset();
+		});
+	}
+}
+
+AccelByte::FApiClient::FApiClient()
+	: OwnedHttpRetryScheduler(MakeUnique<FHttpRetryScheduler>())
+	, Settings(FRegistry::Settings)
+	, HttpRetryScheduler(*OwnedHttpRetryScheduler)
+{
+	HttpRetryScheduler.CopyPolicies(FRegistry::HttpRetryScheduler);
+	HttpRetryScheduler.Startup();
+	HttpRetryScheduler.AddAuthorization(Credentials.GetAuthorization());
+}
+
+AccelByte::FApiClient::FApiClient(FHttpRetryScheduler& SharedHttpRetryScheduler, AccelByte::Settings& InSettings)
+	: Settings(InSettings)
+	, HttpRetryScheduler(SharedHttpRetryScheduler)
+{
+	HttpRetryScheduler.AddAuthorization(Credentials.GetAuthorization());
+}
+
+AccelByte::FApiClient::~FApiClient()
+{
+	if (OwnedHttpRetryScheduler.IsValid())
+	{
+		OwnedHttpRetryScheduler->Shutdown(false);
 	}
+	else
+	{
+		HttpRetryScheduler.RemoveAuthorization(Credentials.GetAuthorization());
+	}
+}
+
+void AccelByte::FApiClient::Shutdown()
+{
+	if (Lobby.IsConstructed())
+	{
+		Lobby->Disconnect();
+	}
+	if (GameTelemetry.IsConstructed())
+	{
+		GameTelemetry->Shutdown();
+	}
+	Credentials.Shutdown();
+}
+
+bool AccelByte::FApiClient::IsIdle()
+{
+	// token refreshes and logins go through FRegistry::HttpRetryScheduler, so they aren't counted by the client's scheduler
+	if (Credentials.GetSessionState() == AccelByte::Credentials::ESessionState::Refreshing)
+	{
+		return false;
+	}
+	if (Lobby.IsConstructed() && Lobby->IsConnected())
+	{
+		return false;
+	}
+
+	return HttpRetryScheduler.GetPendingTaskCount() == 0;
+}
+
+FApiClientPtr AccelByte::FMultiRegistry::GetApiClient(FString key)
+{
+	const uint32 KeyHash = GetTypeHash(key);
+	FApiClientShard& Shard = GetShard(KeyHash);
+
+	{
+		FRWScopeLock ReadLock(Shard.Lock, SLT_ReadOnly);
+		if (FApiClientEntry* Entry = Shard.Clients.FindByHash(KeyHash, key))
+		{
+			Entry->LastAccessMs.Set(GetAccessTimeMs());
+			return Entry->Client;
+		}
+	}
+
+	// the client registers its credentials and timers with schedulers that are game thread only
+	checkf(IsInGameThread(), TEXT("API client %s must be created on the game thread, later lookups are safe from any thread"), *key);
 
-	return ApiClientInstances[key];
+	FRWScopeLock WriteLock(Shard.Lock, SLT_Write);
+
+	// another thread may have created it between the two locks
+	if (FApiClientEntry* Entry = Shard.Clients.FindByHash(KeyHash, key))
+	{
+		Entry->LastAccessMs.Set(GetAccessTimeMs());
+		return Entry->Client;
+	}
+
+	FApiClientEntry& NewEntry = Shard.Clients.AddByHash(KeyHash, MoveTemp(key));
+	NewEntry.Client = FApiClientPtr(new FApiClient(), &DeleteApiClient);
+	NewEntry.Client->Credentials.SetClientCredentials(FRegistry::Settings.ClientId, FRegistry::Settings.ClientSecret);
+	NewEntry.LastAccessMs.Set(GetAccessTimeMs());
+
+	return NewEntry.Client;
+}
+
+bool AccelByte::FMultiRegistry::RemoveApiClient(const FString& Key)
+{
+	const uint32 KeyHash = GetTypeHash(Key);
+	FApiClientShard& Shard = GetShard(KeyHash);
+
+	FApiClientPtr Client;
+	{
+		FRWScopeLock WriteLock(Shard.Lock, SLT_Write);
+		FApiClientEntry* Entry = Shard.Clients.FindByHash(KeyHash, Key);
+		if (Entry == nullptr)
+		{
+			return false;
+		}
+
+		Client = MoveTemp(Entry->Client);
+		Shard.Clients.RemoveByHash(KeyHash, Key);
+	}
+
+	ReleaseApiClient(MoveTemp(Client));
+
+	return true;
+}
+
+int32 AccelByte::FMultiRegistry::RemoveIdleApiClients(double IdleSeconds)
+{
+	const int64 IdleSinceMs = GetAccessTimeMs() - static_cast<int64>(IdleSeconds * 1000.0);
+	TArray<FApiClientPtr> IdleClients;
+
+	for (FApiClientShard& Shard : ApiClientShards)
+	{
+		FRWScopeLock WriteLock(Shard.Lock, SLT_Write);
+		for (auto It = Shard.Clients.CreateIterator(); It; ++It)
+		{
+			// a client held by the caller or waiting for a response is in use even when nobody looked it up lately
+			FApiClientEntry& Entry = It.Value();
+			if (Entry.Client.IsUnique() && Entry.LastAccessMs.GetValue() <= IdleSinceMs && Entry.Client->IsIdle())
+			{
+				IdleClients.Add(MoveTemp(Entry.Client));
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	for (FApiClientPtr& Client : IdleClients)
+	{
+		ReleaseApiClient(MoveTemp(Client));
+	}
+
+	return IdleClients.Num();
+}
+
+void AccelByte::FMultiRegistry::SetIdleApiClientTimeout(double IdleSeconds)
+{
+	FRegistry::TimerService.RemoveTimer(IdleEvictionHandle);
+
+	if (IdleSeconds <= 0.0)
+	{
+		return;
+	}
+
+	const float Period = static_cast<float>(FMath::Clamp(IdleSeconds / 4.0, 1.0, 60.0));
+	IdleEvictionHandle = FRegistry::TimerService.AddTicker(FTickerDelegate::CreateLambda([IdleSeconds](float DeltaTime)
+	{
+		RemoveIdleApiClients(IdleSeconds);
+
+		return true;
+	}), Period);
+}
+
+int32 AccelByte::FMultiRegistry::GetApiClientCount()
+{
+	int32 Count = 0;
+	for (FApiClientShard& Shard : ApiClientShards)
+	{
+		FRWScopeLock ReadLock(Shard.Lock, SLT_ReadOnly);
+		Count += Shard.Clients.Num();
+	}
+
+	return Count;
+}
+
+void AccelByte::FMultiRegistry::Shutdown()
+{
+	FRegistry::TimerService.RemoveTimer(IdleEvictionHandle);
+
+	TArray<FApiClientPtr> Clients;
+	for (FApiClientShard& Shard : ApiClientShards)
+	{
+		FRWScopeLock WriteLock(Shard.Lock, SLT_Write);
+		for (auto& Entry : Shard.Clients)
+		{
+			Clients.Add(MoveTemp(Entry.Value.Client));
+		}
+		Shard.Clients.Empty();
+	}
+
+	// destroyed now, not at static destruction after the timer service may be gone
+	for (FApiClientPtr& Client : Clients)
+	{
+		Client->Shutdown();
+	}
+	Clients.Empty();
 }
 
-TMap<FString, TSharedPtr<FApiClient>> FMultiRegistry::ApiClientInstances;
+FDelegateHandle FMultiRegistry::IdleEvictionHandle;
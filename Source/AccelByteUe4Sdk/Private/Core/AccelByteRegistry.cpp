@@ -4,6 +4,9 @@
 
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteTimerService.h"
+#include "Core/AccelByteReport.h"
+#include "Algo/Find.h"
 #include "Api/AccelByteUserApi.h"
 #include "Api/AccelByteUserProfileApi.h"
 #include "Api/AccelByteCategoryApi.h"
@@ -35,43 +38,127 @@
 #include "GameServerApi/AccelByteServerMatchmakingApi.h"
 #include "GameServerApi/AccelByteServerLobby.h"
 #include "GameServerApi/AccelByteServerCloudSaveApi.h"
+#include "GameServerApi/AccelByteServerBatchApi.h"
 
 using namespace AccelByte;
 using namespace AccelByte::Api;
 
+namespace
+{
+	template<typename T>
+	TUniquePtr<T> MakeClientService()
+	{
+		return MakeUnique<T>(FRegistry::Credentials, FRegistry::Settings, FRegistry::HttpRetryScheduler);
+	}
+
+	template<typename T>
+	TUniquePtr<T> MakeServerService()
+	{
+		return MakeUnique<T>(FRegistry::ServerCredentials, FRegistry::ServerSettings);
+	}
+
+	TUniquePtr<Api::GameTelemetry> MakeGameTelemetry()
+	{
+		TUniquePtr<Api::GameTelemetry> GameTelemetry = MakeClientService<Api::GameTelemetry>();
+		GameTelemetry->Startup();
+
+		return GameTelemetry;
+	}
+}
+
+// constructed first and destroyed last, the other objects remove their timers when they are destroyed
+FTimerService FRegistry::TimerService;
 Settings FRegistry::Settings;
 Credentials FRegistry::Credentials;
 ServerSettings FRegistry::ServerSettings;
 ServerCredentials FRegistry::ServerCredentials;
 FHttpRetryScheduler FRegistry::HttpRetryScheduler;
-Api::User FRegistry::User(FRegistry::Credentials, FRegistry::Settings);
-Api::UserProfile FRegistry::UserProfile(FRegistry::Credentials, FRegistry::Settings);
-Api::Category FRegistry::Category(FRegistry::Credentials, FRegistry::Settings);
-Api::Entitlement FRegistry::Entitlement(FRegistry::Credentials, FRegistry::Settings);
-Api::Order FRegistry::Order(FRegistry::Credentials, FRegistry::Settings);
-Api::Item FRegistry::Item(FRegistry::Credentials, FRegistry::Settings);
-Api::Wallet FRegistry::Wallet(FRegistry::Credentials, FRegistry::Settings);
-Api::Fulfillment FRegistry::Fulfillment(FRegistry::Credentials, FRegistry::Settings);
-Api::CloudStorage FRegistry::CloudStorage(FRegistry::Credentials, FRegistry::Settings);
-Api::Lobby FRegistry::Lobby(FRegistry::Credentials, FRegistry::Settings);
-Api::GameProfile FRegistry::GameProfile(FRegistry::Credentials, FRegistry::Settings);
-Api::Statistic FRegistry::Statistic(FRegistry::Credentials, FRegistry::Settings);
-Api::QosManager FRegistry::QosManager(FRegistry::Credentials, FRegistry::Settings);
-Api::CloudSave FRegistry::CloudSave(FRegistry::Credentials, FRegistry::Settings);
-Api::Qos FRegistry::Qos;
-Api::Leaderboard FRegistry::Leaderboard(FRegistry::Credentials, FRegistry::Settings);
-Api::GameTelemetry FRegistry::GameTelemetry(FRegistry::Credentials, FRegistry::Settings);
-Api::Agreement FRegistry::Agreement(FRegistry::Credentials, FRegistry::Settings);
-Api::Achievement FRegistry::Achievement(FRegistry::Credentials, FRegistry::Settings);
-Api::SessionBrowser FRegistry::SessionBrowser(FRegistry::Credentials, FRegistry::Settings);
-Api::UGC FRegistry::UGC(FRegistry::Credentials, FRegistry::Settings);
-GameServerApi::ServerOauth2 FRegistry::ServerOauth2(FRegistry::ServerCredentials, FRegistry::ServerSettings);
-GameServerApi::ServerDSM FRegistry::ServerDSM(FRegistry::ServerCredentials, FRegistry::ServerSettings);
-GameServerApi::ServerStatistic FRegistry::ServerStatistic(FRegistry::ServerCredentials, FRegistry::ServerSettings);
-GameServerApi::ServerEcommerce FRegistry::ServerEcommerce(FRegistry::ServerCredentials, FRegistry::ServerSettings);
-GameServerApi::ServerQosManager FRegistry::ServerQosManager(FRegistry::ServerCredentials, FRegistry::ServerSettings);
-GameServerApi::ServerGameTelemetry FRegistry::ServerGameTelemetry(FRegistry::ServerCredentials, FRegistry::ServerSettings);
-GameServerApi::ServerAchievement FRegistry::ServerAchievement(FRegistry::ServerCredentials, FRegistry::ServerSettings);
-GameServerApi::ServerMatchmaking FRegistry::ServerMatchmaking(FRegistry::ServerCredentials, FRegistry::ServerSettings);
-GameServerApi::ServerLobby FRegistry::ServerLobby(FRegistry::ServerCredentials, FRegistry::ServerSettings);
-GameServerApi::ServerCloudSave FRegistry::ServerCloudSave(FRegistry::ServerCredentials, FRegistry::ServerSettings);
\ No newline at end of file
+TLazyService<Api::User> FRegistry::User(&MakeClientService<Api::User>);
+TLazyService<Api::UserProfile> FRegistry::UserProfile(&MakeClientService<Api::UserProfile>);
+TLazyService<Api::Category> FRegistry::Category(&MakeClientService<Api::Category>);
+TLazyService<Api::Entitlement> FRegistry::Entitlement(&MakeClientService<Api::Entitlement>);
+TLazyService<Api::Order> FRegistry::Order(&MakeClientService<Api::Order>);
+TLazyService<Api::Item> FRegistry::Item(&MakeClientService<Api::Item>);
+TLazyService<Api::Wallet> FRegistry::Wallet(&MakeClientService<Api::Wallet>);
+TLazyService<Api::Fulfillment> FRegistry::Fulfillment(&MakeClientService<Api::Fulfillment>);
+TLazyService<Api::CloudStorage> FRegistry::CloudStorage(&MakeClientService<Api::CloudStorage>);
+TLazyService<Api::Lobby> FRegistry::Lobby(&MakeClientService<Api::Lobby>);
+TLazyService<Api::GameProfile> FRegistry::GameProfile(&MakeClientService<Api::GameProfile>);
+TLazyService<Api::Statistic> FRegistry::Statistic(&MakeClientService<Api::Statistic>);
+TLazyService<Api::QosManager> FRegistry::QosManager(&MakeClientService<Api::QosManager>);
+TLazyService<Api::CloudSave> FRegistry::CloudSave(&MakeClientService<Api::CloudSave>);
+TLazyService<Api::Qos> FRegistry::Qos(&MakeClientService<Api::Qos>);
+TLazyService<Api::Leaderboard> FRegistry::Leaderboard(&MakeClientService<Api::Leaderboard>);
+TLazyService<Api::GameTelemetry> FRegistry::GameTelemetry(&MakeGameTelemetry);
+TLazyService<Api::Agreement> FRegistry::Agreement(&MakeClientService<Api::Agreement>);
+TLazyService<Api::Achievement> FRegistry::Achievement(&MakeClientService<Api::Achievement>);
+TLazyService<Api::SessionBrowser> FRegistry::SessionBrowser(&MakeClientService<Api::SessionBrowser>);
+TLazyService<Api::UGC> FRegistry::UGC(&MakeClientService<Api::UGC>);
+TLazyService<GameServerApi::ServerOauth2> FRegistry::ServerOauth2(&MakeServerService<GameServerApi::ServerOauth2>);
+TLazyService<GameServerApi::ServerDSM> FRegistry::ServerDSM(&MakeServerService<GameServerApi::ServerDSM>);
+TLazyService<GameServerApi::ServerStatistic> FRegistry::ServerStatistic(&MakeServerService<GameServerApi::ServerStatistic>);
+TLazyService<GameServerApi::ServerEcommerce> FRegistry::ServerEcommerce(&MakeServerService<GameServerApi::ServerEcommerce>);
+TLazyService<GameServerApi::ServerQosManager> FRegistry::ServerQosManager(&MakeServerService<GameServerApi::ServerQosManager>);
+TLazyService<GameServerApi::ServerGameTelemetry> FRegistry::ServerGameTelemetry(&MakeServerService<GameServerApi::ServerGameTelemetry>);
+TLazyService<GameServerApi::ServerAchievement> FRegistry::ServerAchievement(&MakeServerService<GameServerApi::ServerAchievement>);
+TLazyService<GameServerApi::ServerMatchmaking> FRegistry::ServerMatchmaking(&MakeServerService<GameServerApi::ServerMatchmaking>);
+TLazyService<GameServerApi::ServerLobby> FRegistry::ServerLobby(&MakeServerService<GameServerApi::ServerLobby>);
+TLazyService<GameServerApi::ServerCloudSave> FRegistry::ServerCloudSave(&MakeServerService<GameServerApi::ServerCloudSave>);
+TLazyService<GameServerApi::ServerBatch> FRegistry::ServerBatch(&MakeServerService<GameServerApi::ServerBatch>);
+
+void FRegistry::WarmUp(const TArray<FString>& ServiceNames)
+{
+	struct FService
+	{
+		const TCHAR* Name;
+		void (*Construct)();
+	};
+
+	static const FService Services[] =
+	{
+		{ TEXT("User"), []() { FRegistry::User.Get(); } },
+		{ TEXT("UserProfile"), []() { FRegistry::UserProfile.Get(); } },
+		{ TEXT("Category"), []() { FRegistry::Category.Get(); } },
+		{ TEXT("Entitlement"), []() { FRegistry::Entitlement.Get(); } },
+		{ TEXT("Order"), []() { FRegistry::Order.Get(); } },
+		{ TEXT("Item"), []() { FRegistry::Item.Get(); } },
+		{ TEXT("Wallet"), []() { FRegistry::Wallet.Get(); } },
+		{ TEXT("Fulfillment"), []() { FRegistry::Fulfillment.Get(); } },
+		{ TEXT("CloudStorage"), []() { FRegistry::CloudStorage.Get(); } },
+		{ TEXT("Lobby"), []() { FRegistry::Lobby.Get(); } },
+		{ TEXT("GameProfile"), []() { FRegistry::GameProfile.Get(); } },
+		{ TEXT("Statistic"), []() { FRegistry::Statistic.Get(); } },
+		{ TEXT("QosManager"), []() { FRegistry::QosManager.Get(); } },
+		{ TEXT("CloudSave"), []() { FRegistry::CloudSave.Get(); } },
+		{ TEXT("Qos"), []() { FRegistry::Qos.Get(); } },
+		{ TEXT("Leaderboard"), []() { FRegistry::Leaderboard.Get(); } },
+		{ TEXT("GameTelemetry"), []() { FRegistry::GameTelemetry.Get(); } },
+		{ TEXT("Agreement"), []() { FRegistry::Agreement.Get(); } },
+		{ TEXT("Achievement"), []() { FRegistry::Achievement.Get(); } },
+		{ TEXT("SessionBrowser"), []() { FRegistry::SessionBrowser.Get(); } },
+		{ TEXT("UGC"), []() { FRegistry::UGC.Get(); } },
+		{ TEXT("ServerOauth2"), []() { FRegistry::ServerOauth2.Get(); } },
+		{ TEXT("ServerDSM"), []() { FRegistry::ServerDSM.Get(); } },
+		{ TEXT("ServerStatistic"), []() { FRegistry::ServerStatistic.Get(); } },
+		{ TEXT("ServerEcommerce"), []() { FRegistry::ServerEcommerce.Get(); } },
+		{ TEXT("ServerQosManager"), []() { FRegistry::ServerQosManager.Get(); } },
+		{ TEXT("ServerGameTelemetry"), []() { FRegistry::ServerGameTelemetry.Get(); } },
+		{ TEXT("ServerAchievement"), []() { FRegistry::ServerAchievement.Get(); } },
+		{ TEXT("ServerMatchmaking"), []() { FRegistry::ServerMatchmaking.Get(); } },
+		{ TEXT("ServerLobby"), []() { FRegistry::ServerLobby.Get(); } },
+		{ TEXT("ServerCloudSave"), []() { FRegistry::ServerCloudSave.Get(); } },
+		{ TEXT("ServerBatch"), []() { FRegistry::ServerBatch.Get(); } },
+	};
+
+	for (const FString& ServiceName : ServiceNames)
+	{
+		const FService* Service = Algo::FindByPredicate(Services, [&ServiceName](const FService& Entry) { return ServiceName.Equals(Entry.Name, ESearchCase::IgnoreCase); });
+		if (Service == nullptr)
+		{
+			UE_LOG(LogAccelByte, Warning, TEXT("Unknown AccelByte service %s in the warm-up list"), *ServiceName);
+			continue;
+		}
+
+		Service->Construct();
+	}
+}
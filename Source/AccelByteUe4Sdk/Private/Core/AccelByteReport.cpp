@@ -1,4 +1,4 @@
-// Copyright (c) 2019 - 2020 AccelByte Inc. All Rights Reserved.
+// Copyright (c) 2019 - 2021 AccelByte Inc. All Rights Reserved.
 // This is licensed software from AccelByte Inc, for limitations
 // and restrictions contact your company contract manager.
 
@@ -8,9 +8,43 @@ DEFINE_LOG_CATEGORY(LogAccelByte);
 
 namespace AccelByte
 {
-	void FReport::LogHttpRequest(const FHttpRequestPtr & Request)
+	namespace
 	{
-		if (!UObjectInitialized()) return;
+		void AppendHeaders(FString& LogMessage, const TArray<FString>& Headers)
+		{
+			for (const FString& Header : Headers)
+			{
+				LogMessage += TEXT("\n");
+				LogMessage += Header;
+			}
+		}
+
+		// one UTF-8 conversion of at most MaxLoggedContentBytes, a cut multi-byte character only garbles the last one
+		void AppendContent(FString& LogMessage, const TArray<uint8>& Content)
+		{
+			LogMessage += TEXT("\nContent-Length: ");
+			LogMessage.AppendInt(Content.Num());
+			LogMessage += TEXT("\n\n");
+
+			const int32 LoggedBytes = FMath::Min(Content.Num(), FReport::MaxLoggedContentBytes);
+			if (LoggedBytes > 0)
+			{
+				const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Content.GetData()), LoggedBytes);
+				LogMessage.AppendChars(Converted.Get(), Converted.Length());
+			}
+			if (LoggedBytes < Content.Num())
+			{
+				LogMessage += FString::Printf(TEXT("\n... %d more bytes"), Content.Num() - LoggedBytes);
+			}
+			LogMessage += TEXT("\n---\n");
+		}
+	}
+
+	const int32 FReport::MaxLoggedContentBytes = 8 * 1024;
+
+	void FReport::LogHttpRequest(const FHttpRequestPtr& Request)
+	{
+		if (!UE_LOG_ACTIVE(LogAccelByte, Log) || !UObjectInitialized()) return;
 
 		if (!Request.IsValid())
 		{
@@ -22,30 +56,23 @@ namespace AccelByte
 
 		if (UE_LOG_ACTIVE(LogAccelByte, Verbose))
 		{
-			FString LogMessage = "";
-			LogMessage += "\n---";
-			for (const FString& Header : Request->GetAllHeaders())
-			{
-				LogMessage += "\n" + Header;
-			}
 			//INTENTIONAL: Request->GetContent() && Request->GetContentLength() could throw an error if it doesn't have content
+			const TArray<uint8>& Content = Request->GetContent();
 
-			LogMessage += "Content-Length: " + FString::FromInt(Request->GetContentLength());
-
-			LogMessage += "\n\n";
-			for (auto a : Request->GetContent())
-			{
-				LogMessage += static_cast<char>(a);
-			}
-			LogMessage += "\n---\n";
+			FString LogMessage;
+			LogMessage.Reserve(256 + FMath::Min(Content.Num(), MaxLoggedContentBytes));
+			LogMessage += TEXT("\n---");
+			AppendHeaders(LogMessage, Request->GetAllHeaders());
+			AppendContent(LogMessage, Content);
 
 			UE_LOG(LogAccelByte, Verbose, TEXT("%s"), *LogMessage);
 		}
 	}
 
-	void FReport::LogHttpResponse(const FHttpRequestPtr Request, const FHttpResponsePtr Response)
+	void FReport::LogHttpResponse(const FHttpRequestPtr& Request, const FHttpResponsePtr& Response)
 	{
-		if (!UObjectInitialized()) return;
+		// error responses are logged as warnings, so they still show up when Log is filtered out
+		if (!UE_LOG_ACTIVE(LogAccelByte, Warning) || !UObjectInitialized()) return;
 		
 		if (!Response.IsValid())
 		{
@@ -53,40 +80,33 @@ namespace AccelByte
 			return;
 		}
 
-		const FString ShortLogMessage = FString::Printf(TEXT("HTTP %d %s %s, %p"), Response->GetResponseCode(), *Request->GetVerb(), *Response->GetURL(), Request.Get());
-		
-		if (Response->GetResponseCode() >= 400)
-		{
-			UE_LOG(LogAccelByte, Warning, TEXT("%s"), *ShortLogMessage);
-		}
-		else if (Response->GetResponseCode() >= 300)
+		const int32 ResponseCode = Response->GetResponseCode();
+		if (ResponseCode >= 300)
 		{
-			UE_LOG(LogAccelByte, Warning, TEXT("%s"), *ShortLogMessage);
+			UE_LOG(LogAccelByte, Warning, TEXT("HTTP %d %s %s, %p"), ResponseCode, *Request->GetVerb(), *Response->GetURL(), Request.Get());
 		}
 		else
 		{
-			UE_LOG(LogAccelByte, Log, TEXT("%s"), *ShortLogMessage);
+			UE_LOG(LogAccelByte, Log, TEXT("HTTP %d %s %s, %p"), ResponseCode, *Request->GetVerb(), *Response->GetURL(), Request.Get());
 		}
 
 		if (UE_LOG_ACTIVE(LogAccelByte, Verbose))
 		{
-			FString LogMessage = "";
-			LogMessage += "\n---";
-			for (const FString& Header : Response->GetAllHeaders())
-			{
-				LogMessage += "\n" + Header;
-			}
-			LogMessage += "\nContent-Length: " + FString::FromInt(Response->GetContent().Num());
-			LogMessage += "\n\n" + Response->GetContentAsString();
-			LogMessage += "\n---\n";
+			const TArray<uint8>& Content = Response->GetContent();
+
+			FString LogMessage;
+			LogMessage.Reserve(256 + FMath::Min(Content.Num(), MaxLoggedContentBytes));
+			LogMessage += TEXT("\n---");
+			AppendHeaders(LogMessage, Response->GetAllHeaders());
+			AppendContent(LogMessage, Content);
 
 			UE_LOG(LogAccelByte, Verbose, TEXT("%s"), *LogMessage);
 		}
 	}
 
-	void FReport::Log(const FString Message)
+	void FReport::Log(const FString& Message)
 	{
-		if (!UObjectInitialized()) return;
+		if (!UE_LOG_ACTIVE(LogAccelByte, Log) || !UObjectInitialized()) return;
 
 		UE_LOG(LogAccelByte, Log, TEXT("%s"), *Message);
 	}
@@ -4,6 +4,7 @@
 
 #include "Core/AccelByteServerCredentials.h"
 #include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteTimerService.h"
 #include "Api/AccelByteOauth2Api.h"
 #include "GameServerApi/AccelByteServerOauth2Api.h"
 #include "Models/AccelByteOauth2Models.h"
@@ -19,14 +20,25 @@ namespace AccelByte
 
 ServerCredentials::ServerCredentials()
 	: ClientAccessToken(TEXT(""))
+	, ClientAuthorization(MakeShared<FHttpAuthorization, ESPMode::ThreadSafe>())
 	, ClientNamespace(TEXT(""))
 	, ClientSessionState(ESessionState::Invalid)
 {
+	ClientAuthorization->SetRefreshHandler(FHttpAuthorizationRefreshDelegate::CreateRaw(this, &ServerCredentials::RefreshTokenNow));
+}
+
+ServerCredentials::~ServerCredentials()
+{
+	// the scheduler may hold the authorization longer than these credentials live
+	ClientAuthorization->SetRefreshHandler(FHttpAuthorizationRefreshDelegate());
+	RemoveFromTicker(PollRefreshTokenHandle);
 }
 
 void ServerCredentials::ForgetAll()
 {
 	ClientAccessToken = FString();
+	ClientAuthorization->Reset();
+	RemoveFromTicker(PollRefreshTokenHandle);
 
 	ClientSessionState = ESessionState::Invalid;
 }
@@ -45,16 +57,7 @@ void ServerCredentials::SetClientToken(const FString& AccessToken, double Expire
 	ClientNamespace = Namespace;
 
 	ClientSessionState = ESessionState::Valid;
-
-	if (!PollRefreshTokenHandle.IsValid()) {
-		PollRefreshTokenHandle = FTicker::GetCoreTicker().AddTicker(
-			FTickerDelegate::CreateLambda([this](float DeltaTime)
-				{
-					PollRefreshToken(FPlatformTime::Seconds());
-					return true;
-				}),
-			0.2f);
-	}
+	ClientAuthorization->SetAccessToken(ClientAccessToken);
 }
 
 void ServerCredentials::Startup()
@@ -68,11 +71,7 @@ void ServerCredentials::Shutdown()
 
 void ServerCredentials::RemoveFromTicker(FDelegateHandle& handle)
 {
-	if (handle.IsValid())
-	{
-		FTicker::GetCoreTicker().RemoveTicker(handle);
-		handle.Reset();
-	}
+	FRegistry::TimerService.RemoveTimer(handle);
 }
 void ServerCredentials::PollRefreshToken(double CurrentTime)
 {
@@ -82,11 +81,12 @@ void ServerCredentials::PollRefreshToken(double CurrentTime)
 		case ESessionState::Valid:
 			if (GetRefreshTime() <= CurrentTime)
 			{
-				FRegistry::ServerOauth2.LoginWithClientCredentials(FVoidHandler::CreateLambda([&]() 
+				ClientAuthorization->BeginRefresh();
+				FRegistry::ServerOauth2->LoginWithClientCredentials(FVoidHandler::CreateLambda([this]() 
 					{ 
 						ClientSessionState = ESessionState::Valid; 
 					}),
-					FErrorHandler::CreateLambda([&](int32 Code, const FString& Message) 
+					FErrorHandler::CreateLambda([this, CurrentTime](int32 Code, const FString& Message) 
 						{ 
 							if (ClientRefreshBackoff <= 0.0)
 							{
@@ -97,6 +97,7 @@ void ServerCredentials::PollRefreshToken(double CurrentTime)
 							ClientRefreshBackoff += FMath::FRandRange(1.0, 60.0);
 							ScheduleRefreshToken(CurrentTime + ClientRefreshBackoff);
 							ClientSessionState = ESessionState::Expired; 
+							ClientAuthorization->EndRefresh();
 						}));
 
 				ClientSessionState = ESessionState::Refreshing;
@@ -112,6 +113,31 @@ void ServerCredentials::PollRefreshToken(double CurrentTime)
 void ServerCredentials::ScheduleRefreshToken(double RefreshTime)
 {
 	ClientRefreshTime = RefreshTime;
+
+	if (FRegistry::TimerService.RescheduleTimer(PollRefreshTokenHandle, RefreshTime))
+	{
+		return;
+	}
+
+	PollRefreshTokenHandle = FRegistry::TimerService.AddTimer(RefreshTime, FSimpleDelegate::CreateLambda([this]()
+	{
+		PollRefreshTokenHandle.Reset();
+		PollRefreshToken(FPlatformTime::Seconds());
+	}));
+}
+
+bool ServerCredentials::RefreshTokenNow()
+{
+	// an expired session is backing off after a failed refresh, don't let 401 responses hammer the token endpoint
+	if (ClientSessionState != ESessionState::Valid)
+	{
+		return ClientSessionState == ESessionState::Refreshing;
+	}
+
+	ScheduleRefreshToken(0.0);
+	PollRefreshToken(FPlatformTime::Seconds());
+
+	return ClientSessionState == ESessionState::Refreshing;
 }
 
 void ServerCredentials::SetMatchId(const FString& GivenMatchId)
@@ -129,6 +155,16 @@ const FString& ServerCredentials::GetClientAccessToken() const
 	return ClientAccessToken;
 }
 
+FString ServerCredentials::GetClientAuthorizationHeader() const
+{
+	return *ClientAuthorization->GetHeader();
+}
+
+const FHttpAuthorizationRef& ServerCredentials::GetClientAuthorization() const
+{
+	return ClientAuthorization;
+}
+
 const FString& ServerCredentials::GetClientNamespace() const
 {
 	return ClientNamespace;
@@ -0,0 +1,182 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteTimerService.h"
+
+namespace AccelByte
+{
+
+FDelegateHandle FTimerService::AddTicker(const FTickerDelegate& Delegate, float Period)
+{
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	FTimer Timer;
+	Timer.Period = FMath::Max(Period, 0.0f);
+	Timer.DueTime = CurrentTime + Timer.Period;
+	Timer.LastTime = CurrentTime;
+	Timer.bRepeat = true;
+	Timer.TickerDelegate = Delegate;
+
+	return AddEntry(MoveTemp(Timer));
+}
+
+FDelegateHandle FTimerService::AddTimer(double DueTime, const FSimpleDelegate& Delegate)
+{
+	FTimer Timer;
+	Timer.DueTime = DueTime;
+	Timer.TimerDelegate = Delegate;
+
+	return AddEntry(MoveTemp(Timer));
+}
+
+FDelegateHandle FTimerService::AddEntry(FTimer&& Timer)
+{
+	const FDelegateHandle Handle(FDelegateHandle::GenerateNewHandle);
+	Deadlines.HeapPush(FDeadline(Timer.DueTime, Handle));
+	Timers.Add(Handle, MoveTemp(Timer));
+	UpdateCoreTicker(FPlatformTime::Seconds());
+
+	return Handle;
+}
+
+bool FTimerService::RescheduleTimer(const FDelegateHandle& Handle, double DueTime)
+{
+	FTimer* Timer = Timers.Find(Handle);
+	if (Timer == nullptr)
+	{
+		return false;
+	}
+
+	// the old heap entry goes stale because its time no longer matches
+	Timer->DueTime = DueTime;
+	Deadlines.HeapPush(FDeadline(DueTime, Handle));
+	UpdateCoreTicker(FPlatformTime::Seconds());
+
+	return true;
+}
+
+void FTimerService::RemoveTimer(FDelegateHandle& Handle)
+{
+	// the heap entry is skipped when it expires, the core ticker may wake up once for nothing
+	Timers.Remove(Handle);
+	Handle.Reset();
+}
+
+bool FTimerService::IsTimerActive(const FDelegateHandle& Handle) const
+{
+	return Timers.Contains(Handle);
+}
+
+int32 FTimerService::GetTimerCount() const
+{
+	return Timers.Num();
+}
+
+void FTimerService::Tick(double CurrentTime)
+{
+	// only what is due now, timers added by the delegates below wait for the next frame
+	TArray<FDeadline, TInlineAllocator<16>> DueDeadlines;
+	while (Deadlines.Num() > 0 && Deadlines.HeapTop().Time <= CurrentTime)
+	{
+		FDeadline Deadline(0.0, FDelegateHandle());
+		Deadlines.HeapPop(Deadline, false);
+		DueDeadlines.Add(Deadline);
+	}
+
+	for (const FDeadline& Deadline : DueDeadlines)
+	{
+		FTimer* Timer = Timers.Find(Deadline.Handle);
+		if (Timer == nullptr || Timer->DueTime != Deadline.Time)
+		{
+			continue;
+		}
+
+		// delegates are copied out, they may add or remove timers and reallocate the map
+		if (Timer->bRepeat)
+		{
+			const float DeltaTime = static_cast<float>(CurrentTime - Timer->LastTime);
+			Timer->LastTime = CurrentTime;
+			// no burst of calls to catch up after a hitch, and a 0 period fires once per frame
+			Timer->DueTime = CurrentTime + FMath::Max<double>(Timer->Period, KINDA_SMALL_NUMBER);
+			Deadlines.HeapPush(FDeadline(Timer->DueTime, Deadline.Handle));
+
+			const FTickerDelegate Delegate = Timer->TickerDelegate;
+			if (!Delegate.IsBound() || !Delegate.Execute(DeltaTime))
+			{
+				Timers.Remove(Deadline.Handle);
+			}
+		}
+		else
+		{
+			const FSimpleDelegate Delegate = MoveTemp(Timer->TimerDelegate);
+			Timers.Remove(Deadline.Handle);
+			Delegate.ExecuteIfBound();
+		}
+	}
+
+	UpdateCoreTicker(CurrentTime);
+}
+
+void FTimerService::Shutdown()
+{
+	if (CoreTickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(CoreTickerHandle);
+		CoreTickerHandle.Reset();
+	}
+
+	Timers.Empty();
+	Deadlines.Empty();
+}
+
+void FTimerService::UpdateCoreTicker(double CurrentTime)
+{
+	// drop stale entries on top, so the core ticker is set for a deadline that still exists
+	while (Deadlines.Num() > 0)
+	{
+		const FDeadline& Top = Deadlines.HeapTop();
+		const FTimer* Timer = Timers.Find(Top.Handle);
+		if (Timer != nullptr && Timer->DueTime == Top.Time)
+		{
+			break;
+		}
+		Deadlines.HeapPopDiscard(false);
+	}
+
+	if (Deadlines.Num() == 0)
+	{
+		if (CoreTickerHandle.IsValid())
+		{
+			FTicker::GetCoreTicker().RemoveTicker(CoreTickerHandle);
+			CoreTickerHandle.Reset();
+		}
+		return;
+	}
+
+	const double NextTime = Deadlines.HeapTop().Time;
+	if (CoreTickerHandle.IsValid())
+	{
+		if (CoreTickerDueTime <= NextTime)
+		{
+			return;
+		}
+		FTicker::GetCoreTicker().RemoveTicker(CoreTickerHandle);
+	}
+
+	CoreTickerDueTime = NextTime;
+	CoreTickerHandle = FTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FTimerService::OnCoreTick),
+		static_cast<float>(FMath::Max(NextTime - CurrentTime, 0.0)));
+}
+
+bool FTimerService::OnCoreTick(float DeltaTime)
+{
+	// one shot, Tick adds a new entry for the next deadline
+	CoreTickerHandle.Reset();
+	Tick(FPlatformTime::Seconds());
+
+	return false;
+}
+
+}
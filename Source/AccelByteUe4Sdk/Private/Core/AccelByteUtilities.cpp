@@ -31,7 +31,7 @@ void FAccelByteUtilities::RemoveEmptyStrings(TSharedPtr<FJsonObject> JsonPtr)
 
 void FAccelByteNetUtilities::GetPublicIP(const THandler<FAccelByteModelsPubIp>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	FString Url = FString::Printf(TEXT("https://api.ipify.org?format=json"));
 	FString Verb = TEXT("GET");
 	FString ContentType = TEXT("application/json");
@@ -47,7 +47,7 @@ void FAccelByteNetUtilities::GetPublicIP(const THandler<FAccelByteModelsPubIp>&
 
 void FAccelByteNetUtilities::DownloadFrom(const FString& Url, const FHttpRequestProgressDelegate& OnProgress, const THandler<TArray<uint8>>& OnDownloaded, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FString Verb = TEXT("GET");
 	FString Accept = TEXT("application/octet-stream");
@@ -63,7 +63,7 @@ void FAccelByteNetUtilities::DownloadFrom(const FString& Url, const FHttpRequest
 
 void FAccelByteNetUtilities::UploadTo(const FString& Url, const TArray<uint8>& DataUpload, const FHttpRequestProgressDelegate& OnProgress, const AccelByte::FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FString Verb = TEXT("PUT");
 	FString ContentType = TEXT("application/octet-stream");
@@ -6,12 +6,17 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteServerSettings.h"
 
 namespace AccelByte
 {
 namespace GameServerApi
 {
+namespace
+{
+	constexpr FHttpEndpoint UnlockAchievementEndpoint(EHttpVerb::Put, TEXT("/v1/admin/namespaces/{namespace}/users/{userId}/achievements/{achievementCode}/unlock"));
+}
 
 ServerAchievement::ServerAchievement(const AccelByte::ServerCredentials& Credentials, const AccelByte::ServerSettings& Settings) : Credentials(Credentials), Settings(Settings)
 {}
@@ -21,7 +26,7 @@ ServerAchievement::~ServerAchievement()
 
 void ServerAchievement::UnlockAchievement(const FString& UserId, const FString& AchievementCode, const FVoidHandler OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	
 	if (UserId.IsEmpty())
 	{
@@ -34,18 +39,11 @@ void ServerAchievement::UnlockAchievement(const FString& UserId, const FString&
 		return;
 	}
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/users/%s/achievements/%s/unlock"), *Settings.AchievementServerUrl, *Credentials.GetClientNamespace(), *UserId, *AchievementCode);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FHttpRequestBuilder Request(UnlockAchievementEndpoint, Settings.AchievementServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Path(TEXT("achievementCode"), AchievementCode)
+		.Authorization(Credentials.GetClientAuthorization());
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
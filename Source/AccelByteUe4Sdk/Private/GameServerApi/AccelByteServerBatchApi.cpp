@@ -0,0 +1,294 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "GameServerApi/AccelByteServerBatchApi.h"
+#include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteTimerService.h"
+#include "Core/AccelByteReport.h"
+
+namespace AccelByte
+{
+namespace GameServerApi
+{
+namespace
+{
+	FVoidHandler ThenComplete(const FVoidHandler& OnSuccess, const FSimpleDelegate& OnComplete)
+	{
+		return FVoidHandler::CreateLambda([OnSuccess, OnComplete]()
+		{
+			OnSuccess.ExecuteIfBound();
+			OnComplete.ExecuteIfBound();
+		});
+	}
+
+	template<typename T>
+	THandler<T> ThenComplete(const THandler<T>& OnSuccess, const FSimpleDelegate& OnComplete)
+	{
+		return THandler<T>::CreateLambda([OnSuccess, OnComplete](const T& Result)
+		{
+			OnSuccess.ExecuteIfBound(Result);
+			OnComplete.ExecuteIfBound();
+		});
+	}
+
+	FErrorHandler ThenComplete(const FErrorHandler& OnError, const FSimpleDelegate& OnComplete)
+	{
+		return FErrorHandler::CreateLambda([OnError, OnComplete](int32 Code, const FString& Message)
+		{
+			OnError.ExecuteIfBound(Code, Message);
+			OnComplete.ExecuteIfBound();
+		});
+	}
+}
+
+ServerBatch::ServerBatch(const AccelByte::ServerCredentials& Credentials, const AccelByte::ServerSettings& Settings)
+	: Statistic(Credentials, Settings)
+	, Achievement(Credentials, Settings)
+	, Ecommerce(Credentials, Settings)
+	, CloudSave(Credentials, Settings)
+{}
+
+ServerBatch::~ServerBatch()
+{
+	FRegistry::TimerService.RemoveTimer(FlushHandle);
+}
+
+void ServerBatch::SetFlushWindow(FTimespan Window)
+{
+	FlushWindow = Window > FTimespan::Zero() ? Window : FTimespan::Zero();
+}
+
+void ServerBatch::SetMaxBatchSize(int32 Size)
+{
+	MaxBatchSize = FMath::Max(Size, 1);
+}
+
+void ServerBatch::SetMaxConcurrentRequests(int32 Count)
+{
+	MaxConcurrentRequests = FMath::Max(Count, 1);
+	StartRequests();
+}
+
+void ServerBatch::IncrementUserStatItems(const FString& UserId, const TArray<FAccelByteModelsBulkStatItemInc>& Data, const THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>>& OnSuccess, const FErrorHandler& OnError)
+{
+	ACCELBYTE_LOG_FUNCTION();
+
+	if (Data.Num() == 0)
+	{
+		OnSuccess.ExecuteIfBound({});
+		return;
+	}
+
+	PendingStatIncrements.Add({ UserId, Data, OnSuccess, OnError });
+	PendingStatItemCount += Data.Num();
+
+	if (PendingStatItemCount >= MaxBatchSize)
+	{
+		Flush();
+	}
+	else
+	{
+		ScheduleFlush();
+	}
+}
+
+void ServerBatch::UnlockAchievement(const FString& UserId, const FString& AchievementCode, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
+{
+	ACCELBYTE_LOG_FUNCTION();
+
+	EnqueueRequest([this, UserId, AchievementCode, OnSuccess, OnError](const FSimpleDelegate& OnComplete)
+	{
+		Achievement.UnlockAchievement(UserId, AchievementCode, ThenComplete(OnSuccess, OnComplete), ThenComplete(OnError, OnComplete));
+	});
+}
+
+void ServerBatch::GrantUserEntitlements(const FString& UserId, const TArray<FAccelByteModelsEntitlementGrant>& EntitlementGrant, const THandler<TArray<FAccelByteModelsStackableEntitlementInfo>>& OnSuccess, const FErrorHandler& OnError)
+{
+	ACCELBYTE_LOG_FUNCTION();
+
+	EnqueueRequest([this, UserId, EntitlementGrant, OnSuccess, OnError](const FSimpleDelegate& OnComplete)
+	{
+		Ecommerce.GrantUserEntitlements(UserId, EntitlementGrant, ThenComplete(OnSuccess, OnComplete), ThenComplete(OnError, OnComplete));
+	});
+}
+
+void ServerBatch::SaveUserRecord(const FString& Key, const FString& UserId, const FJsonObject& RecordRequest, bool bIsPublic, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
+{
+	ACCELBYTE_LOG_FUNCTION();
+
+	TSharedRef<FJsonObject> Record = MakeShared<FJsonObject>(RecordRequest);
+	EnqueueRequest([this, Key, UserId, Record, bIsPublic, OnSuccess, OnError](const FSimpleDelegate& OnComplete)
+	{
+		CloudSave.SaveUserRecord(Key, UserId, *Record, bIsPublic, ThenComplete(OnSuccess, OnComplete), ThenComplete(OnError, OnComplete));
+	});
+}
+
+void ServerBatch::Flush()
+{
+	FRegistry::TimerService.RemoveTimer(FlushHandle);
+
+	if (PendingStatIncrements.Num() == 0)
+	{
+		return;
+	}
+
+	// a user's increments are never split, so a bulk request only goes over the cap for a single oversized user
+	TArray<FStatIncrementJob> Jobs;
+	int32 ItemCount = 0;
+	for (FStatIncrementJob& Job : PendingStatIncrements)
+	{
+		if (ItemCount > 0 && ItemCount + Job.Data.Num() > MaxBatchSize)
+		{
+			EnqueueStatIncrements(MoveTemp(Jobs), ItemCount);
+			Jobs.Reset();
+			ItemCount = 0;
+		}
+
+		ItemCount += Job.Data.Num();
+		Jobs.Add(MoveTemp(Job));
+	}
+	EnqueueStatIncrements(MoveTemp(Jobs), ItemCount);
+
+	PendingStatIncrements.Reset();
+	PendingStatItemCount = 0;
+}
+
+int32 ServerBatch::GetPendingCount() const
+{
+	return PendingStatIncrements.Num() + QueuedRequestCount;
+}
+
+void ServerBatch::ScheduleFlush()
+{
+	if (FlushHandle.IsValid())
+	{
+		return;
+	}
+
+	FlushHandle = FRegistry::TimerService.AddTimer(FPlatformTime::Seconds() + FlushWindow.GetTotalSeconds(), FSimpleDelegate::CreateLambda([this]()
+	{
+		FlushHandle.Reset();
+		Flush();
+	}));
+}
+
+void ServerBatch::EnqueueStatIncrements(TArray<FStatIncrementJob>&& Jobs, int32 ItemCount)
+{
+	TArray<FAccelByteModelsBulkUserStatItemInc> Data;
+	Data.Reserve(ItemCount);
+	for (const FStatIncrementJob& Job : Jobs)
+	{
+		for (const FAccelByteModelsBulkStatItemInc& Item : Job.Data)
+		{
+			FAccelByteModelsBulkUserStatItemInc& UserItem = Data.AddDefaulted_GetRef();
+			UserItem.inc = Item.inc;
+			UserItem.userId = Job.UserId;
+			UserItem.statCode = Item.statCode;
+		}
+	}
+
+	TSharedRef<TArray<FStatIncrementJob>> SharedJobs = MakeShared<TArray<FStatIncrementJob>>(MoveTemp(Jobs));
+	EnqueueRequest([this, Data = MoveTemp(Data), SharedJobs](const FSimpleDelegate& OnComplete)
+	{
+		Statistic.IncrementManyUsersStatItems(Data, THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>>::CreateLambda([SharedJobs, OnComplete](const TArray<FAccelByteModelsBulkStatItemOperationResult>& Results)
+		{
+			SplitStatIncrementResults(*SharedJobs, Results);
+			OnComplete.ExecuteIfBound();
+		}), FErrorHandler::CreateLambda([SharedJobs, OnComplete](int32 Code, const FString& Message)
+		{
+			for (const FStatIncrementJob& Job : *SharedJobs)
+			{
+				Job.OnError.ExecuteIfBound(Code, Message);
+			}
+			OnComplete.ExecuteIfBound();
+		}));
+	});
+}
+
+void ServerBatch::SplitStatIncrementResults(const TArray<FStatIncrementJob>& Jobs, const TArray<FAccelByteModelsBulkStatItemOperationResult>& Results)
+{
+	typedef TPair<FString, FString> FResultKey;
+	TMultiMap<FResultKey, int32> ResultIndices;
+	for (int32 i = 0; i < Results.Num(); i++)
+	{
+		ResultIndices.Add(FResultKey(Results[i].UserId, Results[i].StatCode), i);
+	}
+
+	// a result is matched on user and stat code, so a reordered or shorter answer is never handed to the wrong user
+	int32 Position = 0;
+	for (const FStatIncrementJob& Job : Jobs)
+	{
+		TArray<FAccelByteModelsBulkStatItemOperationResult> JobResults;
+		JobResults.Reserve(Job.Data.Num());
+		FString MissingStatCode;
+		for (const FAccelByteModelsBulkStatItemInc& Item : Job.Data)
+		{
+			int32 ResultIndex = INDEX_NONE;
+			if (const int32* Found = ResultIndices.Find(FResultKey(Job.UserId, Item.statCode)))
+			{
+				ResultIndex = *Found;
+			}
+			else if (Results.IsValidIndex(Position) && Results[Position].UserId.IsEmpty() && Results[Position].StatCode == Item.statCode)
+			{
+				// without a user ID only the result at the item's own position can belong to it
+				ResultIndex = Position;
+			}
+			Position++;
+
+			if (ResultIndex == INDEX_NONE)
+			{
+				MissingStatCode = Item.statCode;
+				continue;
+			}
+
+			ResultIndices.RemoveSingle(FResultKey(Results[ResultIndex].UserId, Results[ResultIndex].StatCode), ResultIndex);
+			JobResults.Add(Results[ResultIndex]);
+		}
+
+		if (!MissingStatCode.IsEmpty())
+		{
+			const FString Message = FString::Printf(TEXT("Bulk stat increment returned no result for stat %s of user %s."), *MissingStatCode, *Job.UserId);
+			Job.OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidResponse), Message);
+			continue;
+		}
+
+		Job.OnSuccess.ExecuteIfBound(JobResults);
+	}
+}
+
+void ServerBatch::EnqueueRequest(FRequestJob&& Job)
+{
+	RequestQueue.Enqueue(MoveTemp(Job));
+	QueuedRequestCount++;
+	StartRequests();
+}
+
+void ServerBatch::StartRequests()
+{
+	// a request failing synchronously completes inside this loop, the loop picks up the freed slot itself
+	if (bStartingRequests)
+	{
+		return;
+	}
+	bStartingRequests = true;
+
+	FRequestJob Job;
+	while (InFlightCount < MaxConcurrentRequests && RequestQueue.Dequeue(Job))
+	{
+		QueuedRequestCount--;
+		InFlightCount++;
+		Job(FSimpleDelegate::CreateRaw(this, &ServerBatch::OnRequestComplete));
+	}
+
+	bStartingRequests = false;
+}
+
+void ServerBatch::OnRequestComplete()
+{
+	InFlightCount--;
+	StartRequests();
+}
+
+} // Namespace GameServerApi
+} // Namespace AccelByte
@@ -6,6 +6,7 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteServerSettings.h"
 #include "Models/AccelByteCloudSaveModels.h"
 
@@ -13,6 +14,23 @@ namespace AccelByte
 {
 namespace GameServerApi
 {
+	namespace
+	{
+		constexpr FHttpEndpoint GameRecordsEndpoint(EHttpVerb::Get, TEXT("/v1/admin/namespaces/{namespace}/records"));
+		constexpr FHttpEndpoint SaveGameRecordEndpoint(EHttpVerb::Post, TEXT("/v1/admin/namespaces/{namespace}/records/{key}"));
+		constexpr FHttpEndpoint GetGameRecordEndpoint(EHttpVerb::Get, TEXT("/v1/admin/namespaces/{namespace}/records/{key}"));
+		constexpr FHttpEndpoint ReplaceGameRecordEndpoint(EHttpVerb::Put, TEXT("/v1/admin/namespaces/{namespace}/records/{key}"));
+		constexpr FHttpEndpoint DeleteGameRecordEndpoint(EHttpVerb::Delete, TEXT("/v1/admin/namespaces/{namespace}/records/{key}"));
+		constexpr FHttpEndpoint SaveUserRecordEndpoint(EHttpVerb::Post, TEXT("/v1/admin/namespaces/{namespace}/users/{userId}/records/{key}"));
+		constexpr FHttpEndpoint SavePublicUserRecordEndpoint(EHttpVerb::Post, TEXT("/v1/admin/namespaces/{namespace}/users/{userId}/records/{key}/public"));
+		constexpr FHttpEndpoint GetUserRecordEndpoint(EHttpVerb::Get, TEXT("/v1/admin/namespaces/{namespace}/users/{userId}/records/{key}"));
+		constexpr FHttpEndpoint GetPublicUserRecordEndpoint(EHttpVerb::Get, TEXT("/v1/admin/namespaces/{namespace}/users/{userId}/records/{key}/public"));
+		constexpr FHttpEndpoint ReplaceUserRecordEndpoint(EHttpVerb::Put, TEXT("/v1/admin/namespaces/{namespace}/users/{userId}/records/{key}"));
+		constexpr FHttpEndpoint ReplacePublicUserRecordEndpoint(EHttpVerb::Put, TEXT("/v1/admin/namespaces/{namespace}/users/{userId}/records/{key}/public"));
+		constexpr FHttpEndpoint DeleteUserRecordEndpoint(EHttpVerb::Delete, TEXT("/v1/admin/namespaces/{namespace}/users/{userId}/records/{key}"));
+		constexpr FHttpEndpoint DeletePublicUserRecordEndpoint(EHttpVerb::Delete, TEXT("/v1/admin/namespaces/{namespace}/users/{userId}/records/{key}/public"));
+	}
+
 	ServerCloudSave::ServerCloudSave(const ServerCredentials& Credentials, const ServerSettings& Settings) : Credentials(Credentials), Settings(Settings)
 	{}
 
@@ -21,82 +39,49 @@ namespace GameServerApi
 
 	void ServerCloudSave::RetrieveGameRecordsKey(const THandler<FAccelByteModelsPaginatedRecordsKey>& OnSuccess, const FErrorHandler& OnError, int32 Offset, int32 Limit)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/records"), *Settings.CloudSaveServerUrl, *Credentials.GetClientNamespace());
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-		FString Content = TEXT("");
-		FString Query = TEXT("");
+		ACCELBYTE_LOG_FUNCTION();
 
+		FHttpRequestBuilder Request(GameRecordsEndpoint, Settings.CloudSaveServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Authorization(Credentials.GetClientAuthorization());
 		if (Offset >= 0)
 		{
-			Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-			Query.Append(FString::Printf(TEXT("offset=%d"), Offset));
+			Request.Query(TEXT("offset"), Offset);
 		}
 		if (Limit >= 0)
 		{
-			Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-			Query.Append(FString::Printf(TEXT("limit=%d"), Limit));
+			Request.Query(TEXT("limit"), Limit);
 		}
-		Url.Append(Query.IsEmpty() ? TEXT("") : FString::Printf(TEXT("?%s"), *Query));
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void ServerCloudSave::SaveGameRecord(const FString& Key, const FJsonObject& RecordRequest, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/records/%s"), *Settings.CloudSaveServerUrl, *Credentials.GetClientNamespace(), *Key);
-		FString Verb = TEXT("POST");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-		FString Content = TEXT("");
+		ACCELBYTE_LOG_FUNCTION();
+
+		FString Content;
 		TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>(RecordRequest);
 		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
 		FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
+		FHttpRequestBuilder Request(SaveGameRecordEndpoint, Settings.CloudSaveServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Path(TEXT("key"), Key)
+			.Authorization(Credentials.GetClientAuthorization())
+			.Content(MoveTemp(Content));
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void ServerCloudSave::GetGameRecord(const FString& Key, const THandler<FAccelByteModelsGameRecord>& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/records/%s"), *Settings.CloudSaveServerUrl, *Credentials.GetClientNamespace(), *Key);
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-		FString Content = TEXT("");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
+		ACCELBYTE_LOG_FUNCTION();
+
+		FHttpRequestBuilder Request(GetGameRecordEndpoint, Settings.CloudSaveServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Path(TEXT("key"), Key)
+			.Authorization(Credentials.GetClientAuthorization());
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(
 			Request,
@@ -121,93 +106,61 @@ namespace GameServerApi
 
 	void ServerCloudSave::ReplaceGameRecord(const FString& Key, const FJsonObject& RecordRequest, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/records/%s"), *Settings.CloudSaveServerUrl, *Credentials.GetClientNamespace(), *Key);
-		FString Verb = TEXT("PUT");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-		FString Content = TEXT("");
+		ACCELBYTE_LOG_FUNCTION();
+
+		FString Content;
 		TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>(RecordRequest);
 		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
 		FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
+		FHttpRequestBuilder Request(ReplaceGameRecordEndpoint, Settings.CloudSaveServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Path(TEXT("key"), Key)
+			.Authorization(Credentials.GetClientAuthorization())
+			.Content(MoveTemp(Content));
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void ServerCloudSave::DeleteGameRecord(const FString& Key, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/records/%s"), *Settings.CloudSaveServerUrl, *Credentials.GetClientNamespace(), *Key);
-		FString Verb = TEXT("DELETE");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-		FString Content = TEXT("");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
+		ACCELBYTE_LOG_FUNCTION();
+
+		FHttpRequestBuilder Request(DeleteGameRecordEndpoint, Settings.CloudSaveServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Path(TEXT("key"), Key)
+			.Authorization(Credentials.GetClientAuthorization());
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 	void ServerCloudSave::SaveUserRecord(const FString& Key, const FString& UserId, const FJsonObject& RecordRequest, bool bIsPublic, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url             = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/users/%s/records/%s%s"), *Settings.CloudSaveServerUrl, *Credentials.GetClientNamespace(), *UserId, *Key, (bIsPublic ? TEXT("/public") : TEXT("")));
-		FString Verb            = TEXT("POST");
-		FString ContentType     = TEXT("application/json");
-		FString Accept          = TEXT("application/json");
-		FString Content         = TEXT("");
+		ACCELBYTE_LOG_FUNCTION();
+
+		FString Content;
 		TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>(RecordRequest);
 		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
 		FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
+		FHttpRequestBuilder Request(bIsPublic ? SavePublicUserRecordEndpoint : SaveUserRecordEndpoint, Settings.CloudSaveServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Path(TEXT("userId"), UserId)
+			.Path(TEXT("key"), Key)
+			.Authorization(Credentials.GetClientAuthorization())
+			.Content(MoveTemp(Content));
 
-		FRegistry::HttpRetryScheduler.ProcessRequest(Request,  CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void ServerCloudSave::GetUserRecord(const FString& Key, const FString& UserId, const THandler<FAccelByteModelsUserRecord>& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization   = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/users/%s/records/%s"), *Settings.CloudSaveServerUrl, *Credentials.GetClientNamespace(), *UserId, *Key);
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-		FString Content = TEXT("");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
+		ACCELBYTE_LOG_FUNCTION();
+
+		FHttpRequestBuilder Request(GetUserRecordEndpoint, Settings.CloudSaveServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Path(TEXT("userId"), UserId)
+			.Path(TEXT("key"), Key)
+			.Authorization(Credentials.GetClientAuthorization());
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(
 			Request,
@@ -234,22 +187,13 @@ namespace GameServerApi
 
 	void ServerCloudSave::GetPublicUserRecord(const FString& Key, const FString& UserId, const THandler<FAccelByteModelsUserRecord>& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/users/%s/records/%s/public"), *Settings.CloudSaveServerUrl, *Credentials.GetClientNamespace(), *UserId, *Key);
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-		FString Content = TEXT("");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
+		ACCELBYTE_LOG_FUNCTION();
+
+		FHttpRequestBuilder Request(GetPublicUserRecordEndpoint, Settings.CloudSaveServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Path(TEXT("userId"), UserId)
+			.Path(TEXT("key"), Key)
+			.Authorization(Credentials.GetClientAuthorization());
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(
 			Request,
@@ -276,47 +220,32 @@ namespace GameServerApi
 
 	void ServerCloudSave::ReplaceUserRecord(const FString& Key, const FString& UserId, const FJsonObject& RecordRequest, bool bIsPublic, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/users/%s/records/%s%s"), *Settings.CloudSaveServerUrl, *Credentials.GetClientNamespace(), *UserId, *Key, (bIsPublic ? TEXT("/public") : TEXT("")));
-		FString Verb = TEXT("PUT");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-		FString Content = TEXT("");
+		ACCELBYTE_LOG_FUNCTION();
+
+		FString Content;
 		TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>(RecordRequest);
 		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
 		FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
+		FHttpRequestBuilder Request(bIsPublic ? ReplacePublicUserRecordEndpoint : ReplaceUserRecordEndpoint, Settings.CloudSaveServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Path(TEXT("userId"), UserId)
+			.Path(TEXT("key"), Key)
+			.Authorization(Credentials.GetClientAuthorization())
+			.Content(MoveTemp(Content));
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void ServerCloudSave::DeleteUserRecord(const FString& Key, const FString& UserId, bool bIsPublic, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/users/%s/records/%s%s"), *Settings.CloudSaveServerUrl, *Credentials.GetClientNamespace(), *UserId, *Key, (bIsPublic ? TEXT("/public") : TEXT("")));
-		FString Verb = TEXT("DELETE");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-		FString Content = TEXT("");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
+		ACCELBYTE_LOG_FUNCTION();
+
+		FHttpRequestBuilder Request(bIsPublic ? DeletePublicUserRecordEndpoint : DeleteUserRecordEndpoint, Settings.CloudSaveServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Path(TEXT("userId"), UserId)
+			.Path(TEXT("key"), Key)
+			.Authorization(Credentials.GetClientAuthorization());
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
@@ -9,6 +9,7 @@
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteServerSettings.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteEnvironment.h"
 #include "Core/AccelByteUtilities.h"
@@ -19,10 +20,18 @@ namespace AccelByte
 {
     namespace GameServerApi
     {
+		namespace
+		{
+			constexpr FHttpEndpoint RegisterServerEndpoint(EHttpVerb::Post, TEXT("/namespaces/{namespace}/servers/register"));
+			constexpr FHttpEndpoint ShutdownServerEndpoint(EHttpVerb::Post, TEXT("/namespaces/{namespace}/servers/shutdown"));
+			constexpr FHttpEndpoint RegisterLocalServerEndpoint(EHttpVerb::Post, TEXT("/namespaces/{namespace}/servers/local/register"));
+			constexpr FHttpEndpoint DeregisterLocalServerEndpoint(EHttpVerb::Post, TEXT("/namespaces/{namespace}/servers/local/deregister"));
+			constexpr FHttpEndpoint GetSessionIdEndpoint(EHttpVerb::Get, TEXT("/namespaces/{namespace}/servers/{serverName}/session"));
+		}
 
 		void ServerDSM::RegisterServerToDSM(const int32 Port, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 		{
-			FReport::Log(FString(__FUNCTION__));
+			ACCELBYTE_LOG_FUNCTION();
 			ParseCommandParam();
 
 			if (ServerType != EServerType::NONE)
@@ -41,11 +50,6 @@ namespace AccelByte
 			else
 			{
 				ServerName = Environment::GetEnvironmentVariable("POD_NAME", 100);
-				FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::ServerCredentials.GetClientAccessToken());
-				FString Url = FString::Printf(TEXT("%s/namespaces/%s/servers/register"), *FRegistry::ServerSettings.DSMControllerServerUrl, *FRegistry::ServerCredentials.GetClientNamespace());
-				FString Verb = TEXT("POST");
-				FString ContentType = TEXT("application/json");
-				FString Accept = TEXT("application/json");
 				const FAccelByteModelsRegisterServerRequest Register{
 					Game_version,
 					DSPubIp,
@@ -53,16 +57,13 @@ namespace AccelByte
 					Port,
 					Provider
 				};
-				FString Contents;
-				FJsonObjectConverter::UStructToJsonObjectString(Register, Contents);
-				FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-				Request->SetURL(Url);
-				Request->SetHeader(TEXT("Authorization"), Authorization);
-				Request->SetVerb(Verb);
-				Request->SetHeader(TEXT("Content-Type"), ContentType);
-				Request->SetHeader(TEXT("Accept"), Accept);
-				Request->SetContentAsString(Contents);
-				FReport::Log(TEXT("Starting DSM Register Request..."));
+				FString Content;
+				FJsonObjectConverter::UStructToJsonObjectString(Register, Content);
+				FHttpRequestBuilder Request(RegisterServerEndpoint, FRegistry::ServerSettings.DSMControllerServerUrl);
+				Request.Path(TEXT("namespace"), FRegistry::ServerCredentials.GetClientNamespace())
+					.Authorization(FRegistry::ServerCredentials.GetClientAuthorization())
+					.Content(MoveTemp(Content));
+				ACCELBYTE_LOG(TEXT("Starting DSM Register Request..."));
 
 				OnRegisterResponse.BindLambda([this, OnSuccess, OnError](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccessful)
 				{
@@ -85,13 +86,13 @@ namespace AccelByte
 
 				});
 
-				FRegistry::HttpRetryScheduler.ProcessRequest(Request, OnRegisterResponse, FPlatformTime::Seconds());
+				FRegistry::HttpRetryScheduler.ProcessRequest(Request, OnRegisterResponse, FPlatformTime::Seconds(), EHttpRequestPriority::Matchmaking);
 			}
 		}
 
 		void ServerDSM::SendShutdownToDSM(const bool KillMe, const FString& MatchId, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 		{
-			FReport::Log(FString(__FUNCTION__));
+			ACCELBYTE_LOG_FUNCTION();
 			if (ServerType == EServerType::LOCALSERVER)
 			{
 				OnError.ExecuteIfBound(409, TEXT("Server not registered as Cloud Server."));
@@ -107,34 +108,26 @@ namespace AccelByte
 			}
 			else
 			{
-				FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::ServerCredentials.GetClientAccessToken());
-				FString Url = FString::Printf(TEXT("%s/namespaces/%s/servers/shutdown"), *FRegistry::ServerSettings.DSMControllerServerUrl, *FRegistry::ServerCredentials.GetClientNamespace());
-				FString Verb = TEXT("POST");
-				FString ContentType = TEXT("application/json");
-				FString Accept = TEXT("application/json");
 				const FAccelByteModelsShutdownServerRequest Shutdown{
 					KillMe,
 					ServerName,
 					MatchId
 				};
-				FString Contents;
-				FJsonObjectConverter::UStructToJsonObjectString(Shutdown, Contents);
-				FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-				Request->SetURL(Url);
-				Request->SetHeader(TEXT("Authorization"), Authorization);
-				Request->SetVerb(Verb);
-				Request->SetHeader(TEXT("Content-Type"), ContentType);
-				Request->SetHeader(TEXT("Accept"), Accept);
-				Request->SetContentAsString(Contents);
-				FReport::Log(TEXT("Starting DSM Shutdown Request..."));
+				FString Content;
+				FJsonObjectConverter::UStructToJsonObjectString(Shutdown, Content);
+				FHttpRequestBuilder Request(ShutdownServerEndpoint, FRegistry::ServerSettings.DSMControllerServerUrl);
+				Request.Path(TEXT("namespace"), FRegistry::ServerCredentials.GetClientNamespace())
+					.Authorization(FRegistry::ServerCredentials.GetClientAuthorization())
+					.Content(MoveTemp(Content));
+				ACCELBYTE_LOG(TEXT("Starting DSM Shutdown Request..."));
 				ServerType = EServerType::NONE;
-				FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+				FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Matchmaking);
 			}
 		}
 
 		void ServerDSM::RegisterLocalServerToDSM(const FString IPAddress, const int32 Port, const FString ServerName_, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 		{
-			FReport::Log(FString(__FUNCTION__));
+			ACCELBYTE_LOG_FUNCTION();
 			if (ServerType != EServerType::NONE)
 			{
 				OnError.ExecuteIfBound(409, TEXT("Server already registered."));
@@ -142,26 +135,18 @@ namespace AccelByte
 			else
 			{
 				this->ServerName = ServerName_;
-				FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::ServerCredentials.GetClientAccessToken());
-				FString Url = FString::Printf(TEXT("%s/namespaces/%s/servers/local/register"), *FRegistry::ServerSettings.DSMControllerServerUrl, *FRegistry::ServerCredentials.GetClientNamespace());
-				FString Verb = TEXT("POST");
-				FString ContentType = TEXT("application/json");
-				FString Accept = TEXT("application/json");
 				const FAccelByteModelsRegisterLocalServerRequest Register{
 					IPAddress,
 					ServerName_,
 					Port
 				};
-				FString Contents;
-				FJsonObjectConverter::UStructToJsonObjectString(Register, Contents);
-				FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-				Request->SetURL(Url);
-				Request->SetHeader(TEXT("Authorization"), Authorization);
-				Request->SetVerb(Verb);
-				Request->SetHeader(TEXT("Content-Type"), ContentType);
-				Request->SetHeader(TEXT("Accept"), Accept);
-				Request->SetContentAsString(Contents);
-				FReport::Log(TEXT("Starting DSM Register Local Request..."));
+				FString Content;
+				FJsonObjectConverter::UStructToJsonObjectString(Register, Content);
+				FHttpRequestBuilder Request(RegisterLocalServerEndpoint, FRegistry::ServerSettings.DSMControllerServerUrl);
+				Request.Path(TEXT("namespace"), FRegistry::ServerCredentials.GetClientNamespace())
+					.Authorization(FRegistry::ServerCredentials.GetClientAuthorization())
+					.Content(MoveTemp(Content));
+				ACCELBYTE_LOG(TEXT("Starting DSM Register Local Request..."));
 
 				OnRegisterResponse.BindLambda([this, OnSuccess, OnError](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccessful)
 				{
@@ -179,13 +164,13 @@ namespace AccelByte
 
 				});
 
-				FRegistry::HttpRetryScheduler.ProcessRequest(Request, OnRegisterResponse, FPlatformTime::Seconds());
+				FRegistry::HttpRetryScheduler.ProcessRequest(Request, OnRegisterResponse, FPlatformTime::Seconds(), EHttpRequestPriority::Matchmaking);
 			}
 		}
 
 		void ServerDSM::RegisterLocalServerToDSM(const int32 Port, const FString ServerName_, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 		{
-			FReport::Log(FString(__FUNCTION__));
+			ACCELBYTE_LOG_FUNCTION();
 
 			GetPubIpDelegate.BindLambda([this, Port, ServerName_, OnSuccess, OnError](const FAccelByteModelsPubIp& Result)
 			{
@@ -196,52 +181,36 @@ namespace AccelByte
 
 		void ServerDSM::DeregisterLocalServerFromDSM(const FString& ServerName_, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 		{
-			FReport::Log(FString(__FUNCTION__));
+			ACCELBYTE_LOG_FUNCTION();
 			if (ServerType == EServerType::CLOUDSERVER)
 			{
 				OnError.ExecuteIfBound(409, TEXT("Server not registered as Local Server."));
 			}
 			else
 			{
-				FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::ServerCredentials.GetClientAccessToken());
-				FString Url = FString::Printf(TEXT("%s/namespaces/%s/servers/local/deregister"), *FRegistry::ServerSettings.DSMControllerServerUrl, *FRegistry::ServerCredentials.GetClientNamespace());
-				FString Verb = TEXT("POST");
-				FString ContentType = TEXT("application/json");
-				FString Accept = TEXT("application/json");
 				const FAccelByteModelsDeregisterLocalServerRequest Deregister{
 					ServerName_
 				};
-				FString Contents;
-				FJsonObjectConverter::UStructToJsonObjectString(Deregister, Contents);
-				FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-				Request->SetURL(Url);
-				Request->SetHeader(TEXT("Authorization"), Authorization);
-				Request->SetVerb(Verb);
-				Request->SetHeader(TEXT("Content-Type"), ContentType);
-				Request->SetHeader(TEXT("Accept"), Accept);
-				Request->SetContentAsString(Contents);
-				FReport::Log(TEXT("Starting DSM Deregister Request..."));
+				FString Content;
+				FJsonObjectConverter::UStructToJsonObjectString(Deregister, Content);
+				FHttpRequestBuilder Request(DeregisterLocalServerEndpoint, FRegistry::ServerSettings.DSMControllerServerUrl);
+				Request.Path(TEXT("namespace"), FRegistry::ServerCredentials.GetClientNamespace())
+					.Authorization(FRegistry::ServerCredentials.GetClientAuthorization())
+					.Content(MoveTemp(Content));
+				ACCELBYTE_LOG(TEXT("Starting DSM Deregister Request..."));
 				ServerType = EServerType::NONE;
-				FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+				FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Matchmaking);
 			}
 		}
 
 		void ServerDSM::GetSessionId(const THandler<FAccelByteModelsServerSessionResponse>& OnSuccess, const FErrorHandler& OnError)
 		{
-			FReport::Log(FString(__FUNCTION__));
-			FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::ServerCredentials.GetClientAccessToken());
-			FString Url = FString::Printf(TEXT("%s/namespaces/%s/servers/%s/session"), *FRegistry::ServerSettings.DSMControllerServerUrl, *FRegistry::ServerCredentials.GetClientNamespace(), *ServerName);
-			FString Verb = TEXT("GET");
-			FString ContentType = TEXT("application/json");
-			FString Accept = TEXT("application/json");
-
-			FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-			Request->SetURL(Url);
-			Request->SetHeader(TEXT("Authorization"), Authorization);
-			Request->SetVerb(Verb);
-			Request->SetHeader(TEXT("Content-Type"), ContentType);
-			Request->SetHeader(TEXT("Accept"), Accept);
-			FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+			ACCELBYTE_LOG_FUNCTION();
+			FHttpRequestBuilder Request(GetSessionIdEndpoint, FRegistry::ServerSettings.DSMControllerServerUrl);
+			Request.Path(TEXT("namespace"), FRegistry::ServerCredentials.GetClientNamespace())
+				.Path(TEXT("serverName"), ServerName)
+				.Authorization(FRegistry::ServerCredentials.GetClientAuthorization());
+			FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Matchmaking);
 		}
 
 		// Should not be called from constructor, FCommandLine::Get() is not ready.
@@ -251,7 +220,7 @@ namespace AccelByte
 			TArray<FString> Tokens;
 			TArray<FString> Switches;
 			FCommandLine::Parse(CommandParams, Tokens, Switches);
-			FReport::Log(FString::Printf(TEXT("Params: %s"), CommandParams));
+			ACCELBYTE_LOG(TEXT("Params: %s"), CommandParams);
 			for (auto Param : Switches)
 			{
 				if (Param.Contains("provider"))
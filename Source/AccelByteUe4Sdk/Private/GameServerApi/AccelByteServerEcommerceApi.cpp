@@ -6,12 +6,27 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteServerSettings.h"
 
 namespace AccelByte
 {
 namespace GameServerApi
 {
+namespace
+{
+	constexpr FHttpEndpoint QueryUserEntitlementsEndpoint(EHttpVerb::Get, TEXT("/admin/namespaces/{namespace}/users/{userId}/entitlements"));
+	constexpr FHttpEndpoint GetEntitlementEndpoint(EHttpVerb::Get, TEXT("/admin/namespaces/{namespace}/entitlements/{entitlementId}"));
+	constexpr FHttpEndpoint GetUserEntitlementEndpoint(EHttpVerb::Get, TEXT("/admin/namespaces/{namespace}/users/{userId}/entitlements/{entitlementId}"));
+	constexpr FHttpEndpoint GrantUserEntitlementsEndpoint(EHttpVerb::Post, TEXT("/admin/namespaces/{namespace}/users/{userId}/entitlements"));
+	constexpr FHttpEndpoint CreditUserWalletEndpoint(EHttpVerb::Put, TEXT("/admin/namespaces/{namespace}/users/{userId}/wallets/{currencyCode}/credit"));
+	constexpr FHttpEndpoint RevokeUserEntitlementsEndpoint(EHttpVerb::Put, TEXT("/admin/namespaces/{namespace}/users/{userId}/entitlements/revoke/byIds"));
+	constexpr FHttpEndpoint RevokeUserEntitlementEndpoint(EHttpVerb::Put, TEXT("/admin/namespaces/{namespace}/users/{userId}/entitlements/{entitlementId}/revoke"));
+	constexpr FHttpEndpoint ConsumeUserEntitlementEndpoint(EHttpVerb::Put, TEXT("/admin/namespaces/{namespace}/users/{userId}/entitlements/{entitlementId}/decrement"));
+	constexpr FHttpEndpoint DisableUserEntitlementEndpoint(EHttpVerb::Put, TEXT("/admin/namespaces/{namespace}/users/{userId}/entitlements/{entitlementId}/disable"));
+	constexpr FHttpEndpoint EnableUserEntitlementEndpoint(EHttpVerb::Put, TEXT("/admin/namespaces/{namespace}/users/{userId}/entitlements/{entitlementId}/enable"));
+	constexpr FHttpEndpoint DebitUserWalletEndpoint(EHttpVerb::Put, TEXT("/admin/namespaces/{namespace}/users/{userId}/wallets/{walletId}/debit"));
+}
 
 ServerEcommerce::ServerEcommerce(const AccelByte::ServerCredentials& Credentials, const AccelByte::ServerSettings& Settings) : Credentials(Credentials), Settings(Settings)
 {}
@@ -22,75 +37,46 @@ ServerEcommerce::~ServerEcommerce()
 void ServerEcommerce::QueryUserEntitlements(const FString& UserId, bool bActiveOnly, const FString& EntitlementName, const TArray<FString>& ItemIds, const int32& Offset, const int32& Limit,
 	const THandler<FAccelByteModelsEntitlementPagingSlicedResult>& OnSuccess, const FErrorHandler& OnError, EAccelByteEntitlementClass EntitlementClass, EAccelByteAppType AppType)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/admin/namespaces/%s/users/%s/entitlements"), *Settings.PlatformServerUrl, *Credentials.GetClientNamespace(), *UserId);
-	
-	FString Query = FString::Printf(TEXT("activeOnly=%s"), bActiveOnly ? TEXT("true") : TEXT("false"));
-	if (!EntitlementName.IsEmpty())
-	{
-		Query.Append(FString::Printf(TEXT("entitlementName=%s"), *EntitlementName));
-	}
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(QueryUserEntitlementsEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Query(TEXT("activeOnly"), bActiveOnly)
+		.Query(TEXT("entitlementName"), EntitlementName)
+		.Authorization(Credentials.GetClientAuthorization());
 	for (const FString& ItemId : ItemIds)
 	{
-		if (!ItemId.IsEmpty())
-		{
-			Query.Append(FString::Printf(TEXT("itemId=%s"), *ItemId));
-		}
+		Request.Query(TEXT("itemId"), ItemId);
 	}
-	if (Offset>=0)
+	if (Offset >= 0)
 	{
-		Query.Append(FString::Printf(TEXT("offset=%d"), Offset));
+		Request.Query(TEXT("offset"), Offset);
 	}
-	if (Limit>=0)
+	if (Limit >= 0)
 	{
-		Query.Append(FString::Printf(TEXT("limit=%d"), Limit));
+		Request.Query(TEXT("limit"), Limit);
 	}
 	if (EntitlementClass != EAccelByteEntitlementClass::NONE)
 	{
-		Query.Append(FString::Printf(TEXT("entitlementClazz=%s"), *FindObject<UEnum>(ANY_PACKAGE, TEXT("EAccelByteEntitlementClass"), true)->GetNameStringByValue((int32)EntitlementClass)));
+		Request.Query(TEXT("entitlementClazz"), FindObject<UEnum>(ANY_PACKAGE, TEXT("EAccelByteEntitlementClass"), true)->GetNameStringByValue((int32)EntitlementClass));
 	}
 	if (AppType != EAccelByteAppType::NONE)
 	{
-		Query.Append(FString::Printf(TEXT("appType=%s"), *FindObject<UEnum>(ANY_PACKAGE, TEXT("EAccelByteAppType"), true)->GetNameStringByValue((int32)AppType)));
+		Request.Query(TEXT("appType"), FindObject<UEnum>(ANY_PACKAGE, TEXT("EAccelByteAppType"), true)->GetNameStringByValue((int32)AppType));
 	}
 
-	Url.Append(Query.IsEmpty() ? TEXT("") : FString::Printf(TEXT("?%s"),*Query));
-	
-	FString Verb            = TEXT("GET");
-	FString ContentType     = TEXT("application/json");
-	FString Accept          = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void ServerEcommerce::GetUserEntitlementById(const FString& Entitlementid, const THandler<FAccelByteModelsEntitlementInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/admin/namespaces/%s/entitlements/%s"), *Settings.PlatformServerUrl, *Credentials.GetClientNamespace(), *Entitlementid);
-
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FHttpRequestBuilder Request(GetEntitlementEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("entitlementId"), Entitlementid)
+		.Authorization(Credentials.GetClientAuthorization());
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
@@ -98,187 +84,133 @@ void ServerEcommerce::GetUserEntitlementById(const FString& Entitlementid, const
 void ServerEcommerce::GetUserEntitlementById(const FString& UserId, const FString& EntitlementId,
 	const THandler<FAccelByteModelsEntitlementInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/admin/namespaces/%s/users/%s/entitlements/%s"), *Settings.PlatformServerUrl, *Credentials.GetClientNamespace(), *UserId, *EntitlementId);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FHttpRequestBuilder Request(GetUserEntitlementEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Path(TEXT("entitlementId"), EntitlementId)
+		.Authorization(Credentials.GetClientAuthorization());
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void ServerEcommerce::GrantUserEntitlements(const FString& UserId, const TArray<FAccelByteModelsEntitlementGrant>& EntitlementGrant, const THandler<TArray<FAccelByteModelsStackableEntitlementInfo>>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/admin/namespaces/%s/users/%s/entitlements"), *Settings.PlatformServerUrl, *Credentials.GetClientNamespace(), *UserId);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Contents = "[";
+	ACCELBYTE_LOG_FUNCTION();
+
+	FString Content = "[";
 	for (int i =0; i < EntitlementGrant.Num(); i++)
 	{
-		FString Content;
-		FJsonObjectConverter::UStructToJsonObjectString(EntitlementGrant[i], Content);
-		Contents += Content;
+		FString Item;
+		FJsonObjectConverter::UStructToJsonObjectString(EntitlementGrant[i], Item);
+		Content += Item;
 		if (i < EntitlementGrant.Num() - 1)
 		{
-			Contents += ",";
+			Content += ",";
 		}
 		else
 		{
-			Contents += "]";
+			Content += "]";
 		}
 	}
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Contents);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(GrantUserEntitlementsEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Authorization(Credentials.GetClientAuthorization())
+		.Content(MoveTemp(Content));
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), FHttpRetryPolicy::NonIdempotent());
 }
 
 void ServerEcommerce::CreditUserWallet(const FString& UserId, const FString& CurrencyCode, const FAccelByteModelsCreditUserWalletRequest& CreditUserWalletRequest, const THandler<FAccelByteModelsWalletInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/admin/namespaces/%s/users/%s/wallets/%s/credit"), *Settings.PlatformServerUrl, *Credentials.GetClientNamespace(), *UserId, *CurrencyCode);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content = TEXT("");
+	ACCELBYTE_LOG_FUNCTION();
+
+	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(CreditUserWalletRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(CreditUserWalletEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Path(TEXT("currencyCode"), CurrencyCode)
+		.Authorization(Credentials.GetClientAuthorization())
+		.Content(MoveTemp(Content));
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), FHttpRetryPolicy::NonIdempotent());
 }
 
 void ServerEcommerce::RevokeUserEntitlements(const FString& UserId, const TArray<FString>& EntitlementIds,
 	const THandler<FAccelByteModelsBulkRevokeEntitlements>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(RevokeUserEntitlementsEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Query(TEXT("entitlementIds"), EntitlementIds)
+		.Authorization(Credentials.GetClientAuthorization());
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/admin/namespaces/%s/users/%s/entitlements/revoke/byIds?entitlementIds="), *Settings.PlatformServerUrl, *Credentials.GetClientNamespace(), *UserId);
-	for(int i = 0; i < EntitlementIds.Num(); i++)
-	{
-		Url += EntitlementIds[i];
-		if(i != EntitlementIds.Num() - 1)
-			Url += TEXT("%2C");
-	}
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void ServerEcommerce::RevokeUserEntitlement(const FString& UserId, const FString& EntitlementId,
 	const THandler<FAccelByteModelsEntitlementInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/admin/namespaces/%s/users/%s/entitlements/%s/revoke"), *Settings.PlatformServerUrl, *Credentials.GetClientNamespace(), *UserId, *EntitlementId);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(RevokeUserEntitlementEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Path(TEXT("entitlementId"), EntitlementId)
+		.Authorization(Credentials.GetClientAuthorization());
+
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
-	
 }
 
 void ServerEcommerce::ConsumeUserEntitlement(const FString& UserId, const FString& EntitlementId, int32 UseCount,
 	const THandler<FAccelByteModelsEntitlementInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/admin/namespaces/%s/users/%s/entitlements/%s/decrement"), *Settings.PlatformServerUrl, *Credentials.GetClientNamespace(), *UserId, *EntitlementId);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content = FString::Printf(TEXT("{\"useCount\":%d}"), UseCount);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(ConsumeUserEntitlementEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Path(TEXT("entitlementId"), EntitlementId)
+		.Authorization(Credentials.GetClientAuthorization())
+		.Content(MoveTemp(Content));
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), FHttpRetryPolicy::NonIdempotent());
 }
 
 void ServerEcommerce::DisableUserEntitlement(const FString& UserId, const FString& EntitlementId,
 	const THandler<FAccelByteModelsEntitlementInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/admin/namespaces/%s/users/%s/entitlements/%s/disable"), *Settings.PlatformServerUrl, *Credentials.GetClientNamespace(), *UserId, *EntitlementId);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(DisableUserEntitlementEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Path(TEXT("entitlementId"), EntitlementId)
+		.Authorization(Credentials.GetClientAuthorization());
+
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void ServerEcommerce::EnableUserEntitlement(const FString& UserId, const FString& EntitlementId,
 	const THandler<FAccelByteModelsEntitlementInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/admin/namespaces/%s/users/%s/entitlements/%s/enable"), *Settings.PlatformServerUrl, *Credentials.GetClientNamespace(), *UserId, *EntitlementId);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(EnableUserEntitlementEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Path(TEXT("entitlementId"), EntitlementId)
+		.Authorization(Credentials.GetClientAuthorization());
+
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
@@ -286,24 +218,19 @@ void ServerEcommerce::DebitUserWallet(const FString& UserId, const FString& Wall
 	const FAccelByteModelsDebitUserWalletRequest& DebitUserWalletRequest,
 	const THandler<FAccelByteModelsWalletInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/admin/namespaces/%s/users/%s/wallets/%s/debit"), *Settings.PlatformServerUrl, *Credentials.GetClientNamespace(), *UserId, *WalletId);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content = TEXT("");
+	ACCELBYTE_LOG_FUNCTION();
+
+	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(DebitUserWalletRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(DebitUserWalletEndpoint, Settings.PlatformServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Path(TEXT("walletId"), WalletId)
+		.Authorization(Credentials.GetClientAuthorization())
+		.Content(MoveTemp(Content));
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), FHttpRetryPolicy::NonIdempotent());
 }
 } // Namespace GameServerApi
 } // Namespace AccelByte
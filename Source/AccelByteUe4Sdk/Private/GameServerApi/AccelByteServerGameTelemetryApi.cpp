@@ -5,8 +5,10 @@
 #include "GameServerApi/AccelByteServerGameTelemetryApi.h"
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteTimerService.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteServerSettings.h"
 #include "JsonUtilities.h"
 
@@ -14,6 +16,10 @@ namespace AccelByte
 {
 namespace GameServerApi
 {
+namespace
+{
+	constexpr FHttpEndpoint SendProtectedEventsEndpoint(EHttpVerb::Post, TEXT("/v1/protected/events"));
+}
 
 ServerGameTelemetry::ServerGameTelemetry(const AccelByte::ServerCredentials & Credentials, const AccelByte::ServerSettings & Settings)
 : Credentials(Credentials)
@@ -24,8 +30,7 @@ ServerGameTelemetry::~ServerGameTelemetry()
 {
 	if(UObjectInitialized() && GameTelemetryTickDelegateHandle.IsValid())
 	{
-		FTicker::GetCoreTicker().RemoveTicker(GameTelemetryTickDelegateHandle);
-		GameTelemetryTickDelegateHandle.Reset();
+		FRegistry::TimerService.RemoveTimer(GameTelemetryTickDelegateHandle);
 	}
 }
 
@@ -49,7 +54,7 @@ void ServerGameTelemetry::SetImmediateEventList(const TArray<FString>& EventName
 
 void ServerGameTelemetry::Send(FAccelByteModelsTelemetryBody TelemetryBody, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (ImmediateEvents.Contains(TelemetryBody.EventName))
 	{
@@ -62,14 +67,14 @@ void ServerGameTelemetry::Send(FAccelByteModelsTelemetryBody TelemetryBody, cons
 		{
 			bTelemetryJobStarted = true;
 			GameTelemetryTickDelegate = FTickerDelegate::CreateRaw(this, &ServerGameTelemetry::PeriodicTelemetry);
-			GameTelemetryTickDelegateHandle = FTicker::GetCoreTicker().AddTicker(GameTelemetryTickDelegate, static_cast<float>(TelemetryInterval.GetSeconds()));
+			GameTelemetryTickDelegateHandle = FRegistry::TimerService.AddTicker(GameTelemetryTickDelegate, static_cast<float>(TelemetryInterval.GetSeconds()));
 		}
 	}
 }
 
 bool ServerGameTelemetry::PeriodicTelemetry(float DeltaTime)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	if (JobQueue.IsEmpty()) { return true; }
 
@@ -101,15 +106,9 @@ bool ServerGameTelemetry::PeriodicTelemetry(float DeltaTime)
 
 void ServerGameTelemetry::SendProtectedEvents(TArray<FAccelByteModelsTelemetryBody> Events, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/protected/events"), *FRegistry::ServerSettings.GameTelemetryServerUrl);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content = TEXT("");
+	ACCELBYTE_LOG_FUNCTION();
 
+	FString Content;
 	TArray<TSharedPtr<FJsonValue>> JsonArray;
 	for (const auto& Event : Events)
 	{
@@ -123,15 +122,11 @@ void ServerGameTelemetry::SendProtectedEvents(TArray<FAccelByteModelsTelemetryBo
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(JsonArray, Writer);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(SendProtectedEventsEndpoint, FRegistry::ServerSettings.GameTelemetryServerUrl);
+	Request.Authorization(Credentials.GetClientAuthorization())
+		.Content(MoveTemp(Content));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Telemetry);
 }
 
 } 
@@ -6,6 +6,7 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteServerSettings.h"
 #include "Models/AccelByteLobbyModels.h"
 
@@ -13,6 +14,17 @@ namespace AccelByte
 {
 namespace GameServerApi
 {
+	namespace
+	{
+		constexpr FHttpEndpoint GetPartyDataByUserIdEndpoint(EHttpVerb::Get, TEXT("/v1/admin/party/namespaces/{namespace}/users/{userId}/party"));
+		constexpr FHttpEndpoint GetPartyStorageEndpoint(EHttpVerb::Get, TEXT("/v1/admin/party/namespaces/{namespace}/parties/{partyId}"));
+		constexpr FHttpEndpoint GetActivePartiesEndpoint(EHttpVerb::Get, TEXT("/v1/admin/party/namespaces/{namespace}/parties"));
+		constexpr FHttpEndpoint WritePartyStorageEndpoint(EHttpVerb::Put, TEXT("/v1/admin/party/namespaces/{namespace}/parties/{partyId}/attributes"));
+		constexpr FHttpEndpoint GetSessionAttributeAllEndpoint(EHttpVerb::Get, TEXT("/v1/admin/player/namespaces/{namespace}/users/{userId}/attributes"));
+		constexpr FHttpEndpoint GetSessionAttributeEndpoint(EHttpVerb::Get, TEXT("/v1/admin/player/namespaces/{namespace}/users/{userId}/attributes/{key}"));
+		constexpr FHttpEndpoint SetSessionAttributeEndpoint(EHttpVerb::Put, TEXT("/v1/admin/player/namespaces/{namespace}/users/{userId}/attributes"));
+	}
+
 	ServerLobby::ServerLobby(const ServerCredentials& Credentials, const ServerSettings& Settings) : Credentials(Credentials), Settings(Settings)
 	{}
 
@@ -21,7 +33,7 @@ namespace GameServerApi
 
 	void ServerLobby::GetPartyDataByUserId(const FString & UserId, const THandler<FAccelByteModelsDataPartyResponse> OnSuccess, const FErrorHandler & OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 
 		if (UserId.IsEmpty())
 		{
@@ -29,18 +41,10 @@ namespace GameServerApi
 			return;
 		}
 
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/party/namespaces/%s/users/%s/party"), *Settings.LobbyServerUrl, *Credentials.GetClientNamespace(), *UserId);
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
+		FHttpRequestBuilder Request(GetPartyDataByUserIdEndpoint, Settings.LobbyServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Path(TEXT("userId"), UserId)
+			.Authorization(Credentials.GetClientAuthorization());
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
@@ -58,27 +62,19 @@ namespace GameServerApi
 
 	void ServerLobby::GetPartyStorage(const FString & PartyId, const THandler<FAccelByteModelsPartyDataNotif>& OnSuccess, const FErrorHandler & OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
-
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/party/namespaces/%s/parties/%s"), *Settings.LobbyServerUrl, *Credentials.GetClientNamespace(), *PartyId);
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
+		ACCELBYTE_LOG_FUNCTION();
 
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
+		FHttpRequestBuilder Request(GetPartyStorageEndpoint, Settings.LobbyServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Path(TEXT("partyId"), PartyId)
+			.Authorization(Credentials.GetClientAuthorization());
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void ServerLobby::GetActiveParties(const int32& Limit, const int32& Offset, const THandler<FAccelByteModelsActivePartiesData>& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 
 		if (Limit <= 0)
 		{
@@ -91,31 +87,11 @@ namespace GameServerApi
 			return;
 		}
 
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/party/namespaces/%s/parties"), *Settings.LobbyServerUrl, *Credentials.GetClientNamespace());
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-		FString Query = TEXT("");
-
-		if (Limit >= 0)
-		{
-			Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-			Query.Append(FString::Printf(TEXT("limit=%d"), Limit));
-		}
-		if (Offset >= 0)
-		{
-			Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-			Query.Append(FString::Printf(TEXT("offset=%d"), Offset));
-		}
-		Url.Append(Query.IsEmpty() ? TEXT("") : FString::Printf(TEXT("?%s"), *Query));
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
+		FHttpRequestBuilder Request(GetActivePartiesEndpoint, Settings.LobbyServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Query(TEXT("limit"), Limit)
+			.Query(TEXT("offset"), Offset)
+			.Authorization(Credentials.GetClientAuthorization());
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
@@ -167,62 +143,40 @@ namespace GameServerApi
 			}
 		}
 
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/party/namespaces/%s/parties"), *Settings.LobbyServerUrl, *Credentials.GetClientNamespace());
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-		FString Query = TEXT("");
-
+		FHttpRequestBuilder Request(GetActivePartiesEndpoint, Settings.LobbyServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Authorization(Credentials.GetClientAuthorization());
 		if (Limit >= 0)
 		{
-			Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-			Query.Append(FString::Printf(TEXT("limit=%d"), Limit));
+			Request.Query(TEXT("limit"), Limit);
 		}
 		if (Offset >= 0)
 		{
-			Query.Append(Query.IsEmpty() ? TEXT("") : TEXT("&"));
-			Query.Append(FString::Printf(TEXT("offset=%d"), Offset));
+			Request.Query(TEXT("offset"), Offset);
 		}
-		Url.Append(Query.IsEmpty() ? TEXT("") : FString::Printf(TEXT("?%s"), *Query));
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void ServerLobby::RequestWritePartyStorage(const FString &PartyId, const FAccelByteModelsPartyDataUpdateRequest& PartyDataRequest, const THandler<FAccelByteModelsPartyDataNotif>& OnSuccess, const FErrorHandler& OnError, FSimpleDelegate OnConflicted)
 	{
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/party/namespaces/%s/parties/%s/attributes"), *Settings.LobbyServerUrl, *Credentials.GetClientNamespace(), *PartyId);
-		FString Verb = TEXT("PUT");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-
-		FString Contents = "{\n";
+		FString Content = "{\n";
 		FString CustomAttribute;
 		FJsonObjectConverter::UStructToJsonObjectString(PartyDataRequest.Custom_attribute, CustomAttribute);
 		FString UpdatedAt = FString::Printf(TEXT("\"updatedAt\": %lld"), PartyDataRequest.UpdatedAt);
 		FString CustomString = FString::Printf(TEXT("\"custom_attribute\": %s"), *CustomAttribute);
-		Contents += UpdatedAt;
-		Contents += ",\n";
-		Contents += CustomString;
-		Contents += "}";
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Contents);
+		Content += UpdatedAt;
+		Content += ",\n";
+		Content += CustomString;
+		Content += "}";
+
+		FHttpRequestBuilder Request(WritePartyStorageEndpoint, Settings.LobbyServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Path(TEXT("partyId"), PartyId)
+			.Authorization(Credentials.GetClientAuthorization())
+			.Content(MoveTemp(Content));
 
 		FErrorHandler ErrorHandler = AccelByte::FErrorHandler::CreateLambda([OnConflicted](int32 Code, FString Message)
 		{
@@ -267,7 +221,7 @@ namespace GameServerApi
 
 	void ServerLobby::GetSessionAttributeAll(const FString& UserId, const THandler<FAccelByteModelsGetSessionAttributeAllResponse>& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 
 		if (UserId.IsEmpty())
 		{
@@ -275,25 +229,17 @@ namespace GameServerApi
 			return;
 		}
 
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/player/namespaces/%s/users/%s/attributes"), *Settings.LobbyServerUrl, *Credentials.GetClientNamespace(), *UserId);
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
+		FHttpRequestBuilder Request(GetSessionAttributeAllEndpoint, Settings.LobbyServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Path(TEXT("userId"), UserId)
+			.Authorization(Credentials.GetClientAuthorization());
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void ServerLobby::GetSessionAttribute(const FString& UserId, const FString& Key, const THandler<FAccelByteModelsGetSessionAttributeResponse>& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 
 		if (UserId.IsEmpty())
 		{
@@ -307,25 +253,18 @@ namespace GameServerApi
 			return;
 		}
 
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/player/namespaces/%s/users/%s/attributes/%s"), *Settings.LobbyServerUrl, *Credentials.GetClientNamespace(), *UserId, *Key);
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
+		FHttpRequestBuilder Request(GetSessionAttributeEndpoint, Settings.LobbyServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Path(TEXT("userId"), UserId)
+			.Path(TEXT("key"), Key)
+			.Authorization(Credentials.GetClientAuthorization());
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void ServerLobby::SetSessionAttribute(const FString& UserId, const TMap<FString, FString>& Attributes, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 	{
-		FReport::Log(FString(__FUNCTION__));
+		ACCELBYTE_LOG_FUNCTION();
 
 		if (UserId.IsEmpty())
 		{
@@ -342,21 +281,14 @@ namespace GameServerApi
 		FAccelByteModelsSetSessionAttributeRequest Body;
 		Body.Attributes = Attributes;
 
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-		FString Url = FString::Printf(TEXT("%s/v1/admin/player/namespaces/%s/users/%s/attributes"), *Settings.LobbyServerUrl, *Credentials.GetClientNamespace(), *UserId);
-		FString Verb = TEXT("PUT");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
 		FString Content;
 		FJsonObjectConverter::UStructToJsonObjectString(Body, Content);
 
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
+		FHttpRequestBuilder Request(SetSessionAttributeEndpoint, Settings.LobbyServerUrl);
+		Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+			.Path(TEXT("userId"), UserId)
+			.Authorization(Credentials.GetClientAuthorization())
+			.Content(MoveTemp(Content));
 
 		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
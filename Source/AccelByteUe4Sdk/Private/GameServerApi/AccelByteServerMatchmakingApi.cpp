@@ -6,13 +6,23 @@
 #include "Modules/ModuleManager.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteTimerService.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteServerSettings.h"
 
 namespace AccelByte
 {
 namespace GameServerApi
 {
+namespace
+{
+	constexpr FHttpEndpoint QuerySessionStatusEndpoint(EHttpVerb::Get, TEXT("/namespaces/{namespace}/sessions/{matchId}/status"));
+	constexpr FHttpEndpoint EnqueueJoinableSessionEndpoint(EHttpVerb::Post, TEXT("/namespaces/{namespace}/sessions"));
+	constexpr FHttpEndpoint DequeueJoinableSessionEndpoint(EHttpVerb::Post, TEXT("/namespaces/{namespace}/sessions/dequeue"));
+	constexpr FHttpEndpoint AddUserToSessionEndpoint(EHttpVerb::Post, TEXT("/v1/admin/namespaces/{namespace}/channels/{channel}/sessions/{matchId}"));
+	constexpr FHttpEndpoint RemoveUserFromSessionEndpoint(EHttpVerb::Delete, TEXT("/v1/admin/namespaces/{namespace}/channels/{channel}/sessions/{matchId}/users/{userId}"));
+}
 
 ServerMatchmaking::ServerMatchmaking(const AccelByte::ServerCredentials& Credentials, const AccelByte::ServerSettings& Setting) : Credentials(Credentials), Settings(Setting)
 {
@@ -35,72 +45,48 @@ ServerMatchmaking::ServerMatchmaking(const AccelByte::ServerCredentials& Credent
 
 void ServerMatchmaking::QuerySessionStatus(const FString MatchId, const  THandler<FAccelByteModelsMatchmakingResult>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/sessions/%s/status"), *Settings.MatchmakingServerUrl,*Credentials.GetClientNamespace(), *MatchId);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Contents;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Contents);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(QuerySessionStatusEndpoint, Settings.MatchmakingServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("matchId"), MatchId)
+		.Authorization(Credentials.GetClientAuthorization());
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Matchmaking);
 }
 
 void ServerMatchmaking::EnqueueJoinableSession(const FAccelByteModelsMatchmakingResult& MatchmakingResult, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/sessions"), *Settings.MatchmakingServerUrl,*Credentials.GetClientNamespace());
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Contents;
-	FJsonObjectConverter::UStructToJsonObjectString(MatchmakingResult, Contents);
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Contents);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	ACCELBYTE_LOG_FUNCTION();
+
+	FString Content;
+	FJsonObjectConverter::UStructToJsonObjectString(MatchmakingResult, Content);
+
+	FHttpRequestBuilder Request(EnqueueJoinableSessionEndpoint, Settings.MatchmakingServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Authorization(Credentials.GetClientAuthorization())
+		.Content(MoveTemp(Content));
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Matchmaking);
 }
 
 void ServerMatchmaking::DequeueJoinableSession(const FString& MatchId, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/sessions/dequeue"), *Settings.MatchmakingServerUrl, *Credentials.GetClientNamespace());
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Contents = FString::Printf(TEXT("{\"match_id\":\"%s\"}"), *MatchId);
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Contents);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	ACCELBYTE_LOG_FUNCTION();
+
+	FString Content = FString::Printf(TEXT("{\"match_id\":\"%s\"}"), *MatchId);
+
+	FHttpRequestBuilder Request(DequeueJoinableSessionEndpoint, Settings.MatchmakingServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Authorization(Credentials.GetClientAuthorization())
+		.Content(MoveTemp(Content));
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Matchmaking);
 }
 
 void ServerMatchmaking::AddUserToSession(const FString& ChannelName, const FString& MatchId, const FString& UserId, const FVoidHandler& OnSuccess, const FErrorHandler& OnError, const FString& PartyId)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	FAccelByteModelsAddUserIntoSessionRequest Body = FAccelByteModelsAddUserIntoSessionRequest
 	{
@@ -108,44 +94,35 @@ void ServerMatchmaking::AddUserToSession(const FString& ChannelName, const FStri
 		PartyId
 	};
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/channels/%s/sessions/%s"), *Settings.MatchmakingServerUrl, *Credentials.GetClientNamespace(), *ChannelName, *MatchId);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Contents;
-	FJsonObjectConverter::UStructToJsonObjectString(Body, Contents);
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Contents);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FString Content;
+	FJsonObjectConverter::UStructToJsonObjectString(Body, Content);
+
+	FHttpRequestBuilder Request(AddUserToSessionEndpoint, Settings.MatchmakingServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("channel"), ChannelName)
+		.Path(TEXT("matchId"), MatchId)
+		.Authorization(Credentials.GetClientAuthorization())
+		.Content(MoveTemp(Content));
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Matchmaking);
 }
 
 void ServerMatchmaking::RemoveUserFromSession(const FString& ChannelName, const FString& MatchId, const FString& UserId, const FVoidHandler& OnSuccess, const FErrorHandler& OnError, const FAccelByteModelsMatchmakingResult& Body)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/channels/%s/sessions/%s/users/%s"), *Settings.MatchmakingServerUrl, *Credentials.GetClientNamespace(), *ChannelName, *MatchId, *UserId);
-	FString Verb = TEXT("DELETE");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Contents;
-	FJsonObjectConverter::UStructToJsonObjectString(Body, Contents);
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Contents);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	ACCELBYTE_LOG_FUNCTION();
+
+	FString Content;
+	FJsonObjectConverter::UStructToJsonObjectString(Body, Content);
+
+	FHttpRequestBuilder Request(RemoveUserFromSessionEndpoint, Settings.MatchmakingServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("channel"), ChannelName)
+		.Path(TEXT("matchId"), MatchId)
+		.Path(TEXT("userId"), UserId)
+		.Authorization(Credentials.GetClientAuthorization())
+		.Content(MoveTemp(Content));
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Matchmaking);
 }
 
 void ServerMatchmaking::ActivateSessionStatusPolling(const FString& MatchId, const THandler<FAccelByteModelsMatchmakingResult>& OnSuccess, const FErrorHandler& OnError, uint32 IntervalSec)
@@ -155,7 +132,7 @@ void ServerMatchmaking::ActivateSessionStatusPolling(const FString& MatchId, con
 		StatusPollingMatchId = MatchId;
 		OnStatusPollingResponseSuccess = OnSuccess;
 		OnStatusPollingResponseError = OnError;
-		StatusPollingDelegateHandle = FTicker::GetCoreTicker().AddTicker(StatusPollingDelegate, IntervalSec);
+		StatusPollingDelegateHandle = FRegistry::TimerService.AddTicker(StatusPollingDelegate, IntervalSec);
 		bStatusPollingActive = true;
 	}
 }
@@ -164,14 +141,14 @@ void ServerMatchmaking::DeactivateStatusPolling()
 {
 	if (UObjectInitialized() && (bStatusPollingActive || StatusPollingDelegateHandle.IsValid()))
 	{
-		FTicker::GetCoreTicker().RemoveTicker(StatusPollingDelegateHandle);
+		FRegistry::TimerService.RemoveTimer(StatusPollingDelegateHandle);
 		bStatusPollingActive = false;
 	}
 }
 
 bool ServerMatchmaking::StatusPollingTick(float DeltaTime)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 	QuerySessionStatus(StatusPollingMatchId, OnStatusPollingResponseSuccess, OnStatusPollingResponseError);
 	return true;
 }
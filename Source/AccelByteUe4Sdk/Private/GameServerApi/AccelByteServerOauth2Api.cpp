@@ -6,6 +6,7 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "JsonUtilities.h"
 #include "Runtime/Core/Public/Misc/Base64.h"
 
@@ -13,32 +14,26 @@ namespace AccelByte
 {
 namespace GameServerApi
 {
+namespace
+{
+	constexpr FHttpEndpoint TokenEndpoint(EHttpVerb::Post, TEXT("/v3/oauth/token"));
+}
 
 void ServerOauth2::GetAccessTokenWithClientCredentialsGrant(const FString& ClientId, const FString& ClientSecret, const THandler<FOauth2Token>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization   = TEXT("Basic " + FBase64::Encode(ClientId + ":" + ClientSecret));
-	FString Url             = FString::Printf(TEXT("%s/v3/oauth/token"), *FRegistry::ServerSettings.IamServerUrl);
-	FString Verb            = TEXT("POST");
-	FString ContentType     = TEXT("application/x-www-form-urlencoded");
-	FString Accept          = TEXT("application/json");
-	FString Content         = FString::Printf(TEXT("grant_type=client_credentials"));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestBuilder Request(TokenEndpoint, FRegistry::ServerSettings.IamServerUrl);
+	Request.Authorization(TEXT("Basic ") + FBase64::Encode(ClientId + ":" + ClientSecret))
+		.ContentType(TEXT("application/x-www-form-urlencoded"))
+		.Content(TEXT("grant_type=client_credentials"));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestPriority::Auth);
 }
 
 void ServerOauth2::LoginWithClientCredentials(const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	GetAccessTokenWithClientCredentialsGrant(Settings.ClientId, Settings.ClientSecret, THandler<FOauth2Token>::CreateLambda([OnSuccess](const FOauth2Token& Result)
 	{
@@ -52,7 +47,7 @@ void ServerOauth2::LoginWithClientCredentials(const FVoidHandler& OnSuccess, con
 
 void ServerOauth2::ForgetAllCredentials()
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	Credentials.ForgetAll();
 }
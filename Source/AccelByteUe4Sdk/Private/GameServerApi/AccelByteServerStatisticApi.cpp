@@ -6,12 +6,20 @@
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpEndpoint.h"
 #include "Core/AccelByteServerSettings.h"
 
 namespace AccelByte
 {
 namespace GameServerApi
 {
+namespace
+{
+	constexpr FHttpEndpoint CreateUserStatItemsEndpoint(EHttpVerb::Post, TEXT("/v1/admin/namespaces/{namespace}/users/{userId}/statitems/bulk"));
+	constexpr FHttpEndpoint GetUserStatItemsEndpoint(EHttpVerb::Get, TEXT("/v1/admin/namespaces/{namespace}/users/{userId}/statitems"));
+	constexpr FHttpEndpoint IncrementManyUsersStatItemsEndpoint(EHttpVerb::Put, TEXT("/v1/admin/namespaces/{namespace}/statitems/value/bulk"));
+	constexpr FHttpEndpoint IncrementUserStatItemsEndpoint(EHttpVerb::Put, TEXT("/v1/admin/namespaces/{namespace}/users/{userId}/statitems/value/bulk"));
+}
 
 ServerStatistic::ServerStatistic(const AccelByte::ServerCredentials& Credentials, const AccelByte::ServerSettings& Setting) : Credentials(Credentials), Settings(Setting)
 {}
@@ -21,13 +29,8 @@ ServerStatistic::~ServerStatistic()
 
 void ServerStatistic::CreateUserStatItems(const FString& UserId, const TArray<FString>& StatCodes, const THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/users/%s/statitems/bulk"), *Settings.StatisticServerUrl, *Credentials.GetClientNamespace(), *UserId);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Contents = "[";
 	FString Content;
 	FAccelByteModelsBulkStatItemCreate statItemCreate;
@@ -47,65 +50,39 @@ void ServerStatistic::CreateUserStatItems(const FString& UserId, const TArray<FS
 		}
 	}
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Contents);
+	FHttpRequestBuilder Request(CreateUserStatItemsEndpoint, Settings.StatisticServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Authorization(Credentials.GetClientAuthorization())
+		.Content(Contents);
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void ServerStatistic::GetAllUserStatItems(const FString& UserId, const THandler<FAccelByteModelsUserStatItemPagingSlicedResult>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
 	ServerStatistic::GetUserStatItems(UserId, {}, {}, OnSuccess, OnError);
 }
 
 void ServerStatistic::GetUserStatItems(const FString& UserId, const TArray<FString>& StatCodes, const TArray<FString>& Tags, const THandler<FAccelByteModelsUserStatItemPagingSlicedResult>& OnSuccess, const FErrorHandler & OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
-
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/users/%s/statitems"), *Settings.StatisticServerUrl, *Credentials.GetClientNamespace(), *UserId);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
-
-	for (int i = 0; i < StatCodes.Num(); i++)
-	{
-		Url.Append((i == 0) ? TEXT("?statCodes=") : TEXT("%2C")).Append(StatCodes[i]);
-	}
-
-
-	for (int i = 0; i < Tags.Num(); i++)
-	{
-		Url.Append((i == 0) ? TEXT("?tags=") : TEXT("%2C")).Append(Tags[i]);
-	}
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	ACCELBYTE_LOG_FUNCTION();
+
+	FHttpRequestBuilder Request(GetUserStatItemsEndpoint, Settings.StatisticServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Query(TEXT("statCodes"), StatCodes)
+		.Query(TEXT("tags"), Tags)
+		.Authorization(Credentials.GetClientAuthorization());
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void ServerStatistic::IncrementManyUsersStatItems(const TArray<FAccelByteModelsBulkUserStatItemInc>& Data, const THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/statitems/value/bulk"), *Settings.StatisticServerUrl, *Credentials.GetClientNamespace());
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Contents = "[";
 	FString Content;
 	for (int i = 0; i < Data.Num(); i++)
@@ -121,25 +98,17 @@ void ServerStatistic::IncrementManyUsersStatItems(const TArray<FAccelByteModelsB
 			Contents += "]";
 		}
 	}
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Contents);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(IncrementManyUsersStatItemsEndpoint, Settings.StatisticServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Authorization(Credentials.GetClientAuthorization())
+		.Content(Contents);
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), FHttpRetryPolicy::NonIdempotent());
 }
 
 void ServerStatistic::IncrementUserStatItems(const FString& UserId, const TArray<FAccelByteModelsBulkStatItemInc>& Data, const THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>>& OnSuccess, const FErrorHandler& OnError)
 {
-	FReport::Log(FString(__FUNCTION__));
+	ACCELBYTE_LOG_FUNCTION();
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/users/%s/statitems/value/bulk"), *Settings.StatisticServerUrl, *Credentials.GetClientNamespace(), *UserId);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Contents = "[";
 	FString Content;
 	for (int i = 0; i < Data.Num(); i++)
@@ -155,14 +124,12 @@ void ServerStatistic::IncrementUserStatItems(const FString& UserId, const TArray
 			Contents += "]";
 		}
 	}
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Contents);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestBuilder Request(IncrementUserStatItemsEndpoint, Settings.StatisticServerUrl);
+	Request.Path(TEXT("namespace"), Credentials.GetClientNamespace())
+		.Path(TEXT("userId"), UserId)
+		.Authorization(Credentials.GetClientAuthorization())
+		.Content(Contents);
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), FHttpRetryPolicy::NonIdempotent());
 }
 
 } // Namespace Api
@@ -11,6 +11,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -20,7 +21,7 @@ namespace Api
 class ACCELBYTEUE4SDK_API Achievement
 {
 public:
-	Achievement(const Credentials& Credentials, const Settings& Settings);
+	Achievement(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~Achievement();
 
 	/**
@@ -69,6 +70,7 @@ public:
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 
 	Achievement() = delete;
 	Achievement(Achievement const&) = delete;
@@ -13,6 +13,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -22,11 +23,12 @@ namespace Api
 class ACCELBYTEUE4SDK_API Agreement
 {
 public:
-	Agreement(const Credentials& Credentials, const Settings& Settings);
+	Agreement(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~Agreement();
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 public:
 	/**
 	* @brief Retrieve all active latest policies based on a namespace and country. The namespace is current client namespace. The country will be read from user token.
@@ -11,6 +11,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -22,11 +23,12 @@ namespace Api
 class ACCELBYTEUE4SDK_API Category
 {
 public:
-	Category(const Credentials& Credentials, const Settings& Settings);
+	Category(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~Category();
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 public:
 	/**
 	 * @brief This function gets root categories that exist in the specified namespace.
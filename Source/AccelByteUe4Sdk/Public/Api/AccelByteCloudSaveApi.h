@@ -11,6 +11,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -20,7 +21,7 @@ namespace Api
 class ACCELBYTEUE4SDK_API CloudSave
 {
 public:
-	CloudSave(const Credentials& Credentials, const Settings& Settings);
+	CloudSave(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~CloudSave();
 
 	/**
@@ -160,6 +161,7 @@ public:
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 
 	CloudSave() = delete;
 	CloudSave(CloudSave const&) = delete;
@@ -11,6 +11,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -22,11 +23,12 @@ namespace Api
 class ACCELBYTEUE4SDK_API CloudStorage
 {
 public:
-	CloudStorage(const Credentials& Credentials, const Settings& Settings);
+	CloudStorage(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~CloudStorage();
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 public:
 	/**
 	 * @brief This function gets list of slot(s) those owned by the player.
@@ -10,6 +10,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -19,11 +20,12 @@ namespace Api
 class ACCELBYTEUE4SDK_API Entitlement
 {
 public:
-	Entitlement(const Credentials& Credentials, const Settings& Settings);
+	Entitlement(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~Entitlement();
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 public:
 	/**
 	* @brief Get list of user's Entitlement(s).
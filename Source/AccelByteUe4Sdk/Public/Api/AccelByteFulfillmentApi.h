@@ -10,6 +10,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -19,11 +20,12 @@ namespace Api
 class ACCELBYTEUE4SDK_API Fulfillment
 {
 public:
-	Fulfillment(const Credentials& Credentials, const Settings& Settings);
+	Fulfillment(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~Fulfillment();
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 public:
 	/**
 	* @brief Redeem Campaign Code to Receive In Game Item.
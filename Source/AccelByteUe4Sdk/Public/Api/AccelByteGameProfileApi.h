@@ -16,6 +16,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -25,11 +26,12 @@ namespace Api
 class ACCELBYTEUE4SDK_API GameProfile
 {
 public:
-	GameProfile(const Credentials& Credentials, const Settings& Settings);
+	GameProfile(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~GameProfile();
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 
 public:
 
@@ -15,6 +15,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -24,7 +25,7 @@ namespace Api
 class ACCELBYTEUE4SDK_API GameTelemetry
 {
 public:
-	GameTelemetry(const Credentials& Credentials, const Settings& Settings);
+	GameTelemetry(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~GameTelemetry();
 
 	/**
@@ -73,6 +74,7 @@ private:
 
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 
 	FTimespan TelemetryInterval = FTimespan(0, 1, 0);
 	TSet<FString> ImmediateEvents;
@@ -10,6 +10,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -19,11 +20,12 @@ namespace Api
 class ACCELBYTEUE4SDK_API Item
 {
 public:
-	Item(const Credentials& Credentials, const Settings& Settings);
+	Item(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~Item();
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 public:
 	/**
 	 * @brief Get one item information from an online store.
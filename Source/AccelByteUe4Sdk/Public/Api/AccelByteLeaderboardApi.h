@@ -13,6 +13,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -22,11 +23,12 @@ namespace Api
 class ACCELBYTEUE4SDK_API Leaderboard
 {
 public:
-	Leaderboard(const Credentials& Credentials, const Settings& Settings);
+	Leaderboard(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~Leaderboard();
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 public:
 	/**
 	* @brief Get leaderboard rankings in a specified timeframe.
@@ -16,6 +16,8 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
+class FLobbyMessageParser;
 
 namespace Api
 {
@@ -41,6 +43,66 @@ enum class EWebSocketEvent : uint8
 
 ENUM_CLASS_FLAGS(EWebSocketEvent);
 	
+/**
+ * @brief Counters of the messages sent while the lobby was reconnecting.
+ */
+struct ACCELBYTEUE4SDK_API FLobbyOutboundQueueStats
+{
+	int64 QueuedCount = 0;
+	// Queued messages sent once the lobby reconnected.
+	int64 SentCount = 0;
+	// Messages refused because the queue was full.
+	int64 OverflowCount = 0;
+	// Queued messages dropped because they were older than the TTL of their type or their request timed out.
+	int64 ExpiredCount = 0;
+	// Queued messages dropped because the lobby gave up reconnecting or was disconnected.
+	int64 DisconnectedCount = 0;
+	// Seconds the sent messages spent in the queue.
+	double TotalQueueTime = 0.0;
+	double MaxQueueTime = 0.0;
+
+	double GetAverageQueueTime() const
+	{
+		return SentCount > 0 ? TotalQueueTime / SentCount : 0.0;
+	}
+};
+
+/**
+ * @brief Groups of lobby requests sharing a client side rate limit.
+ */
+enum class ELobbyMessageCategory : uint8
+{
+	Chat,		// personal, party and channel chat
+	Presence,	// presence updates, a delayed update is replaced by a newer one
+	Other,
+	Count
+};
+
+/**
+ * @brief Counters of the rate limit of a message category.
+ */
+struct ACCELBYTEUE4SDK_API FLobbyRateLimitStats
+{
+	// Messages held back until the category had a token again.
+	int64 DelayedCount = 0;
+	// Delayed messages sent.
+	int64 DelayedSentCount = 0;
+	// Delayed presence updates replaced by a newer one before they were sent.
+	int64 CoalescedCount = 0;
+	// Messages refused because too many messages of the category were already delayed.
+	int64 SuppressedCount = 0;
+	// Delayed messages dropped because their request timed out, the lobby gave up reconnecting or was disconnected.
+	int64 DroppedCount = 0;
+	// Seconds the delayed messages were held back.
+	double TotalDelay = 0.0;
+	double MaxDelay = 0.0;
+
+	double GetAverageDelay() const
+	{
+		return DelayedSentCount > 0 ? TotalDelay / DelayedSentCount : 0.0;
+	}
+};
+
 /**
  * @brief Lobby API for chatting and party management.
  * Unlike other servers which use HTTP, Lobby server uses WebSocket (RFC 6455).
@@ -48,11 +110,15 @@ ENUM_CLASS_FLAGS(EWebSocketEvent);
 class ACCELBYTEUE4SDK_API Lobby
 {
 public:
-	Lobby(const Credentials& Credentials, const Settings& Settings, float PingDelay = 30.f, float InitialBackoffDelay = 1.f, float MaxBackoffDelay = 30.f, float TotalTimeout = 60.f, TSharedPtr<IWebSocket> WebSocket = nullptr);
+	static const float DefaultRequestTimeout;
+	static const int32 DefaultMaxOutboundQueueSize;
+
+	Lobby(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef, float PingDelay = 30.f, float InitialBackoffDelay = 1.f, float MaxBackoffDelay = 30.f, float TotalTimeout = 60.f, TSharedPtr<IWebSocket> WebSocket = nullptr);
 	~Lobby();
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 
 public:
 
@@ -431,16 +497,46 @@ public:
 	 */
 	FString SendInfoPartyRequest();
 
+	/**
+	 * @brief Get information about current party.
+	 * The response goes to OnResponse only, not to the delegate of its type, and exactly one of OnResponse and OnError is called.
+	 *
+	 * @param OnResponse Called with the response, a response with an error code has it in its Code.
+	 * @param OnError Called when the lobby isn't connected, disconnects or doesn't answer within TimeoutSeconds.
+	 * @param TimeoutSeconds Seconds to wait for the response.
+	 */
+	FString SendInfoPartyRequest(const FPartyInfoResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds = DefaultRequestTimeout);
+
 	/**
 	 * @brief Create a party.
 	 */
     FString SendCreatePartyRequest();
 
+	/**
+	 * @brief Create a party.
+	 * The response goes to OnResponse only, not to the delegate of its type, and exactly one of OnResponse and OnError is called.
+	 *
+	 * @param OnResponse Called with the response, a response with an error code has it in its Code.
+	 * @param OnError Called when the lobby isn't connected, disconnects or doesn't answer within TimeoutSeconds.
+	 * @param TimeoutSeconds Seconds to wait for the response.
+	 */
+	FString SendCreatePartyRequest(const FPartyCreateResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds = DefaultRequestTimeout);
+
 	/**
 	 * @brief Leave current party.
 	 */
     FString SendLeavePartyRequest();
 
+	/**
+	 * @brief Leave current party.
+	 * The response goes to OnResponse only, not to the delegate of its type, and exactly one of OnResponse and OnError is called.
+	 *
+	 * @param OnResponse Called with the response, a response with an error code has it in its Code.
+	 * @param OnError Called when the lobby isn't connected, disconnects or doesn't answer within TimeoutSeconds.
+	 * @param TimeoutSeconds Seconds to wait for the response.
+	 */
+	FString SendLeavePartyRequest(const FPartyLeaveResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds = DefaultRequestTimeout);
+
 	/**
 	 * @brief Invite a user to party.
 	 * 
@@ -448,6 +544,17 @@ public:
 	 */
     FString SendInviteToPartyRequest(const FString& UserId);
 
+	/**
+	 * @brief Invite a user to party.
+	 * The response goes to OnResponse only, not to the delegate of its type, and exactly one of OnResponse and OnError is called.
+	 *
+	 * @param UserId The target user ID to be invited.
+	 * @param OnResponse Called with the response, a response with an error code has it in its Code.
+	 * @param OnError Called when the lobby isn't connected, disconnects or doesn't answer within TimeoutSeconds.
+	 * @param TimeoutSeconds Seconds to wait for the response.
+	 */
+	FString SendInviteToPartyRequest(const FString& UserId, const FPartyInviteResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds = DefaultRequestTimeout);
+
     /**
      * @brief Set presence status on lobby service
      *
@@ -463,6 +570,18 @@ public:
 	 * @param InvitationToken Random string from the invitation notice.
 	 */
 	FString SendAcceptInvitationRequest(const FString& PartyId, const FString& InvitationToken);
+
+	/**
+	 * @brief Accept a party invitation.
+	 * The response goes to OnResponse only, not to the delegate of its type, and exactly one of OnResponse and OnError is called.
+	 *
+	 * @param PartyId Party ID from the invitation notice.
+	 * @param InvitationToken Random string from the invitation notice.
+	 * @param OnResponse Called with the response, a response with an error code has it in its Code.
+	 * @param OnError Called when the lobby isn't connected, disconnects or doesn't answer within TimeoutSeconds.
+	 * @param TimeoutSeconds Seconds to wait for the response.
+	 */
+	FString SendAcceptInvitationRequest(const FString& PartyId, const FString& InvitationToken, const FPartyJoinResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds = DefaultRequestTimeout);
 	
 	/**
 	* @brief Reject a party invitation.
@@ -479,6 +598,17 @@ public:
 	 */
 	FString SendKickPartyMemberRequest(const FString& UserId);
 
+	/**
+	 * @brief Kick a party member.
+	 * The response goes to OnResponse only, not to the delegate of its type, and exactly one of OnResponse and OnError is called.
+	 *
+	 * @param UserId The target user ID to be kicked.
+	 * @param OnResponse Called with the response, a response with an error code has it in its Code.
+	 * @param OnError Called when the lobby isn't connected, disconnects or doesn't answer within TimeoutSeconds.
+	 * @param TimeoutSeconds Seconds to wait for the response.
+	 */
+	FString SendKickPartyMemberRequest(const FString& UserId, const FPartyKickResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds = DefaultRequestTimeout);
+
 	/**
 	 * @brief Generate and Get Party code.
 	 * 
@@ -580,6 +710,18 @@ public:
 	*/
 	FString SendCancelMatchmaking(FString GameMode, bool IsTempParty = false);
 
+	/**
+	 * @brief cancel the currently running matchmaking process
+	 * The response goes to OnResponse only, not to the delegate of its type, and exactly one of OnResponse and OnError is called.
+	 *
+	 * @param GameMode The mode that party member want to cancel.
+	 * @param IsTempParty Is canceling matchmaking that was started using temporary party.
+	 * @param OnResponse Called with the response, a response with an error code has it in its Code.
+	 * @param OnError Called when the lobby isn't connected, disconnects or doesn't answer within TimeoutSeconds.
+	 * @param TimeoutSeconds Seconds to wait for the response.
+	 */
+	FString SendCancelMatchmaking(FString GameMode, bool IsTempParty, const FMatchmakingResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds = DefaultRequestTimeout);
+
 	/**
 	* @brief send ready consent request
 	*
@@ -587,6 +729,17 @@ public:
 	*/
 	FString SendReadyConsentRequest(FString MatchId);
 
+	/**
+	 * @brief send ready consent request
+	 * The response goes to OnResponse only, not to the delegate of its type, and exactly one of OnResponse and OnError is called.
+	 *
+	 * @param MatchId The id of a match user ready to play.
+	 * @param OnResponse Called with the response, a response with an error code has it in its Code.
+	 * @param OnError Called when the lobby isn't connected, disconnects or doesn't answer within TimeoutSeconds.
+	 * @param TimeoutSeconds Seconds to wait for the response.
+	 */
+	FString SendReadyConsentRequest(FString MatchId, const FReadyConsentResponse& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds = DefaultRequestTimeout);
+
 	// Friends
 	/**
 	* @brief Send request friend request.
@@ -793,6 +946,63 @@ public:
 		ParsingError = OnParsingError;
 	}
 
+	/**
+	 * @brief delegate for handling a message refused because the queue of messages sent while reconnecting is full.
+	 */
+	DECLARE_DELEGATE_TwoParams(FOutboundQueueFull, const FString& /*MessageType*/, int32 /*QueueSize*/);
+
+	void SetOutboundQueueFullDelegate(const FOutboundQueueFull& OnOutboundQueueFull)
+	{
+		OutboundQueueFull = OnOutboundQueueFull;
+	}
+
+	/**
+	 * @brief Set how many messages sent while the lobby is reconnecting are kept to be sent once it is connected again.
+	 * Messages above the limit aren't sent, the send function returns an empty message ID. 0 disables queueing.
+	 */
+	void SetMaxOutboundQueueSize(int32 MaxSize);
+
+	/**
+	 * @brief Set how long a queued message of a type is still worth sending, older ones are dropped when the lobby reconnects.
+	 * Matchmaking requests expire after 10 seconds by default, other messages are kept until the reconnection gives up.
+	 *
+	 * @param MessageType Type of the request, e.g. startMatchmakingRequest.
+	 * @param Seconds Time to live, 0 keeps the message until the reconnection gives up.
+	 */
+	void SetOutboundMessageTTL(const FString& MessageType, float Seconds);
+
+	int32 GetOutboundQueueSize() const;
+
+	const FLobbyOutboundQueueStats& GetOutboundQueueStats() const;
+
+	/**
+	 * @brief Set the token bucket limiting the requests of a category sent to the lobby, so bursts don't get the client
+	 * disconnected by the server rate limit. Requests above the limit are delayed in order, up to 64 per category.
+	 * Presence updates are coalesced, only the newest delayed one is sent, so 1 / MessagesPerSecond is the coalescing window.
+	 * Defaults: chat 5 per second with a burst of 10, presence 1 per 2 seconds, other 20 per second with a burst of 40.
+	 *
+	 * @param Category Requests the limit applies to.
+	 * @param MessagesPerSecond Token refill rate, 0 disables the limit.
+	 * @param Burst Bucket size, the number of requests sent back to back after an idle time.
+	 */
+	void SetRateLimit(ELobbyMessageCategory Category, float MessagesPerSecond, int32 Burst);
+
+	const FLobbyRateLimitStats& GetRateLimitStats(ELobbyMessageCategory Category) const;
+
+	/**
+	 * @brief delegate for handling a lobby message type registered with SetMessageHandler.
+	 */
+	DECLARE_DELEGATE_OneParam(FMessageHandler, const FLobbyMessageParser&);
+
+	/**
+	 * @brief Handle a lobby message type the SDK has no delegate for, the handler decodes the frame itself, e.g. Message.Decode(Model).
+	 * Overrides the SDK handling of a type it already handles, an unbound handler removes the override and restores the SDK handling.
+	 *
+	 * @param MessageType Value of the type field of the message, e.g. partyInfoResponse.
+	 * @param Handler Called with the parsed frame.
+	 */
+	void SetMessageHandler(const FString& MessageType, const FMessageHandler& Handler);
+
 	// Party
 	/**
 	* @brief set info party response
@@ -1333,9 +1543,25 @@ private:
 	void OnConnected();
 	void OnConnectionError(const FString& Error);
 	void OnMessage(const FString& Message);
+	void InitMessageHandlers();
 	void OnClosed(int32 StatusCode, const FString& Reason, bool WasClean);
 
     FString SendRawRequest(FString MessageType, FString MessageIDPrefix, FString CustomPayload = TEXT(""));
+	template<typename Model, typename DelegateType>
+	FString SendRequest(const FString& MessageType, const FString& MessageIDPrefix, const FString& CustomPayload, const DelegateType& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds);
+	void AddPendingRequest(const FString& MessageID, TFunction<void(const FLobbyMessageParser&)>&& OnResponse, const FErrorHandler& OnError, float TimeoutSeconds);
+	bool CompletePendingRequest(const FLobbyMessageParser& Message);
+	void ExpirePendingRequests();
+	void FailPendingRequests(int32 Code, const FString& Message);
+	void DropTimedOutMessages(const TSet<FString>& MessageIDs);
+	void ArmPendingRequestTimer();
+	void DrainOutboundQueue();
+	void DropOutboundQueue(int64& DropCounter, int32 ErrorCode, const FString& Reason);
+	bool SendRateLimited(const FString& MessageType, const FString& MessageID, const FString& Content);
+	void SendDelayedMessages();
+	void ArmRateLimitTimer();
+	void DropDelayedMessages(int32 ErrorCode, const FString& Reason);
+	void FailPendingRequest(const FString& MessageID, int32 ErrorCode, const FString& Reason);
     bool Tick(float DeltaTime);
     FString GenerateMessageID(FString Prefix = TEXT(""));
 	void CreateWebSocket();
@@ -1363,6 +1589,68 @@ private:
     FErrorHandler ParsingError;
 	FDisconnectNotif DisconnectNotif;
 	FConnectionClosed ConnectionClosed;
+	struct FPendingRequest
+	{
+		TFunction<void(const FLobbyMessageParser&)> OnResponse;
+		FErrorHandler OnError;
+	};
+
+	struct FPendingRequestDeadline
+	{
+		double Deadline;
+		FString MessageID;
+	};
+
+	// requests sent with a response callback, keyed on their message ID
+	TMap<FString, FPendingRequest> PendingRequests;
+	// min heap of the deadlines of the pending requests, entries of answered requests are dropped when they reach the top
+	TArray<FPendingRequestDeadline> PendingRequestDeadlines;
+	FDelegateHandle PendingRequestTimerHandle;
+	uint64 NextMessageID = 1;
+
+	struct FOutboundMessage
+	{
+		FString MessageID;
+		FString MessageType;
+		FString Content;
+		double QueueTime;
+		// 0 when the message doesn't expire
+		double ExpireTime;
+	};
+
+	// messages sent while reconnecting, in send order
+	TArray<FOutboundMessage> OutboundQueue;
+	TMap<FString, float> OutboundMessageTTLs;
+	int32 MaxOutboundQueueSize = DefaultMaxOutboundQueueSize;
+	FLobbyOutboundQueueStats OutboundQueueStats;
+	FOutboundQueueFull OutboundQueueFull;
+
+	struct FDelayedMessage
+	{
+		FString MessageID;
+		FString Content;
+		double DelayTime;
+	};
+
+	struct FRateLimiter
+	{
+		float Rate = 0.f;
+		int32 Burst = 1;
+		double Tokens = 0.0;
+		double LastRefillTime = 0.0;
+		// messages waiting for a token, in send order
+		TArray<FDelayedMessage> Delayed;
+		FLobbyRateLimitStats Stats;
+
+		void Refill(double Now);
+	};
+
+	FRateLimiter RateLimiters[static_cast<int32>(ELobbyMessageCategory::Count)];
+	FDelegateHandle RateLimitTimerHandle;
+	// handler of each message type, built once in the constructor
+	TMap<FName, TFunction<void(const FLobbyMessageParser&)>> MessageHandlers;
+	// handlers set with SetMessageHandler, looked up before the SDK ones
+	TMap<FName, FMessageHandler> MessageHandlerOverrides;
 	
     // Party 
     FPartyInfoResponse PartyInfoResponse;
@@ -13,6 +13,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -22,11 +23,12 @@ namespace Api
 class ACCELBYTEUE4SDK_API Order
 {
 public:
-	Order(const Credentials& Credentials, const Settings& Settings);
+	Order(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~Order();
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 public:
 	/**
 	 * @brief Create order to purchase something from the store. 
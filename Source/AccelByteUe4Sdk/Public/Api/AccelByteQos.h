@@ -13,6 +13,9 @@
 
 namespace AccelByte
 {
+class Credentials;
+class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -22,7 +25,7 @@ namespace Api
 class ACCELBYTEUE4SDK_API Qos
 {
 public:
-	Qos();
+	Qos(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~Qos();
 
 	/**
@@ -35,6 +38,10 @@ public:
 
 	TArray<TPair<FString, float>> Latencies;
 private:
+	const Credentials& Credentials;
+	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
+
 	Qos(Qos const&) = delete;
 	Qos(Qos&&) = delete;
 };
@@ -13,6 +13,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -22,7 +23,7 @@ namespace Api
 class ACCELBYTEUE4SDK_API QosManager
 {
 public:
-	QosManager(const Credentials& Credentials, const Settings& Settings);
+	QosManager(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~QosManager();
 
 	/**
@@ -35,6 +36,7 @@ public:
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 
 	QosManager() = delete;
 	QosManager(QosManager const&) = delete;
@@ -14,6 +14,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -24,11 +25,12 @@ namespace Api
 class ACCELBYTEUE4SDK_API SessionBrowser 
 {
 public:
-	SessionBrowser(const Credentials& Credentials, const Settings& Settings);
+	SessionBrowser(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~SessionBrowser();
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 
 public:
 	/**
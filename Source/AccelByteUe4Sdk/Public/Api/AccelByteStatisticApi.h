@@ -13,6 +13,7 @@ namespace AccelByte
 {
 	class Credentials;
 	class Settings;
+	class FHttpRetryScheduler;
 	namespace Api
 	{
 
@@ -22,11 +23,12 @@ namespace AccelByte
 		class ACCELBYTEUE4SDK_API Statistic
 		{
 		public:
-			Statistic(const Credentials& Credentials, const Settings& Settings);
+			Statistic(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 			~Statistic();
 		private:
 			const Credentials& Credentials;
 			const Settings& Settings;
+			FHttpRetryScheduler& HttpRef;
 
 public:
 	/**
@@ -13,6 +13,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 
 namespace Api
 {
@@ -23,12 +24,13 @@ class ACCELBYTEUE4SDK_API UGC
 {
 
 public:
-	UGC(const Credentials& Credentials, const Settings& Settings);
+	UGC(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~UGC();
 
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 
 public:
 	/** @brief Create a content and get the payload url to upload the content 
@@ -14,6 +14,7 @@ namespace AccelByte
 {
 	class Credentials;
 	class Settings;
+	class FHttpRetryScheduler;
 	namespace Api
 	{
 		class Entitlement;
@@ -24,11 +25,12 @@ namespace AccelByte
 		class ACCELBYTEUE4SDK_API User
 		{
 		public:
-			User(Credentials& Credentials, Settings& Settings);
+			User(Credentials& Credentials, Settings& Settings, FHttpRetryScheduler& HttpRef);
 			~User();
 		private:
 			Credentials& Creds;
 			Settings& Settings;
+			FHttpRetryScheduler& HttpRef;
 		public:
 			/**
 			* @brief delegate for handling upgrade headless account notification.
@@ -15,6 +15,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -24,11 +25,12 @@ namespace Api
 class ACCELBYTEUE4SDK_API UserProfile
 {
 public:
-	UserProfile(const Credentials& Credentials, const Settings& Settings);
+	UserProfile(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~UserProfile();
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 public:
 	/**
 	 * @brief Get user's own profile information. If it doesn't exist, that will be an error.
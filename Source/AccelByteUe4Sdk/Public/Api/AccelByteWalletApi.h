@@ -13,6 +13,7 @@ namespace AccelByte
 {
 class Credentials;
 class Settings;
+class FHttpRetryScheduler;
 namespace Api
 {
 
@@ -22,11 +23,12 @@ namespace Api
 class ACCELBYTEUE4SDK_API Wallet
 {
 public:
-	Wallet(const Credentials& Credentials, const Settings& Settings);
+	Wallet(const Credentials& Credentials, const Settings& Settings, FHttpRetryScheduler& HttpRef);
 	~Wallet();
 private:
 	const Credentials& Credentials;
 	const Settings& Settings;
+	FHttpRetryScheduler& HttpRef;
 public:
 	/**
 	 * @brief Get user's wallet information for a specific currency code.
@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Models/AccelByteOauth2Models.h"
+#include "Core/AccelByteHttpAuthorization.h"
 #include "Runtime/Core/Public/Containers/Ticker.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Engine.h"
@@ -30,6 +31,7 @@ public:
 
 public:
 	Credentials();
+	~Credentials();
 
 	void ForgetAll();
 	void SetClientCredentials(const FString& ClientId, const FString& ClientSecret);
@@ -41,6 +43,17 @@ public:
 	const FOauth2Token& GetAuthToken() const;
 	const FString& GetRefreshToken() const;
 	const FString& GetAccessToken() const;
+
+	/**
+	 * @brief Get the prebuilt "Bearer <access token>" header value, rebuilt only when the token changes.
+	 */
+	FString GetAuthorizationHeader() const;
+
+	/**
+	 * @brief Get the shared authorization header state, used by the HTTP retry scheduler to re-sign requests after a token refresh.
+	 */
+	const FHttpAuthorizationRef& GetAuthorization() const;
+
 	const FString& GetUserId() const;
 	const FString& GetPlatformUserId() const;
 	const FString& GetUserDisplayName() const;
@@ -48,6 +61,11 @@ public:
 	const FString& GetUserEmailAddress() const;
 	ESessionState GetSessionState() const;
 
+	/**
+	 * @brief Get a weak pointer that expires when these credentials are destroyed, for callbacks of requests that may outlive them.
+	 */
+	TWeakPtr<Credentials, ESPMode::ThreadSafe> AsWeak();
+
 	void Startup();
 	void Shutdown();
 
@@ -55,6 +73,7 @@ private:
 	FString ClientId;
 	FString ClientSecret;
 	FOauth2Token AuthToken;
+	FHttpAuthorizationRef Authorization;
 	
 	double UserSessionExpire;
 	FString UserEmailAddress;
@@ -65,6 +84,14 @@ private:
 	double UserRefreshBackoff;
 
 	FDelegateHandle PollRefreshTokenHandle;
+
+	// doesn't own this object, only hands out weak pointers to it
+	TSharedRef<Credentials, ESPMode::ThreadSafe> Self;
+
+	bool RefreshTokenNow();
+
+	Credentials(const Credentials&) = delete;
+	Credentials& operator=(const Credentials&) = delete;
 };
 
 } // Namespace AccelByte
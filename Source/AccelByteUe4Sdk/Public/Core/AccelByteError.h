@@ -7,6 +7,9 @@
 #include "CoreMinimal.h"
 #include "Http.h"
 #include "JsonUtilities.h"
+#include "AccelByteJsonDecoder.h"
+#include "AccelByteHttpJournal.h"
+#include "Async/Async.h"
 
 #include <unordered_map>
 
@@ -332,7 +335,9 @@ namespace AccelByte
 		InvalidResponse = 14004,
 		NetworkError = 14005,
 		IsNotLoggedIn = 14006,
+		HttpRequestJournaled = 14007,
 		WebSocketConnectFailed = 14201,
+		WebSocketRequestTimeout = 14202,
 		//
 		//GameServer-side Error Code List
 		//
@@ -395,7 +400,7 @@ namespace AccelByte
 		}
 		else
 		{
-			Code = (int32)ErrorCodes::NetworkError;
+			Code = FHttpRequestJournal::IsJournaled(Request) ? (int32)ErrorCodes::HttpRequestJournaled : (int32)ErrorCodes::NetworkError;
 		}
 
 		auto it = ErrorMessages::Default.find(Code);
@@ -452,11 +457,49 @@ namespace AccelByte
 		OnSuccess.ExecuteIfBound();
 	}
 
+	template<typename T>
+	inline void DecodeHttpResult(FHttpResponsePtr Response, TArray<T>& OutResult)
+	{
+		if (!FJsonStructDecoder::Decode(Response->GetContent(), OutResult))
+		{
+			OutResult.Reset();
+			FJsonObjectConverter::JsonArrayStringToUStruct(Response->GetContentAsString(), &OutResult, 0, 0);
+		}
+	}
+
+	template<typename T>
+	inline void DecodeHttpResult(FHttpResponsePtr Response, T& OutResult)
+	{
+		if (!FJsonStructDecoder::Decode(Response->GetContent(), OutResult))
+		{
+			// malformed body or unknown enum value, let the DOM parser salvage what it can like before
+			OutResult = T();
+			FJsonObjectConverter::JsonObjectStringToUStruct(Response->GetContentAsString(), &OutResult, 0, 0);
+		}
+	}
+
+	/**
+	 * @brief Decode the body on the calling thread, timed when the parse counters are enabled.
+	 */
+	template<typename T>
+	inline void DecodeHttpResultTimed(FHttpResponsePtr Response, T& OutResult)
+	{
+		if (!FAsyncJsonDecoding::IsParseStatsEnabled())
+		{
+			DecodeHttpResult(Response, OutResult);
+			return;
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		DecodeHttpResult(Response, OutResult);
+		FAsyncJsonDecoding::RecordParse(FAsyncJsonDecoding::GetCompletingRouteTemplate(Response->GetURL()), Response->GetContent().Num(), FPlatformTime::Seconds() - StartTime, false);
+	}
+
 	template<typename T>
 	inline void HandleHttpResultOk(FHttpResponsePtr Response, const THandler<TArray<T>>& OnSuccess)
 	{
 		TArray<T> Result;
-		FJsonObjectConverter::JsonArrayStringToUStruct(Response->GetContentAsString(), &Result, 0, 0);
+		DecodeHttpResultTimed(Response, Result);
 
 		OnSuccess.ExecuteIfBound(Result);
 	}
@@ -471,7 +514,7 @@ namespace AccelByte
 	inline void HandleHttpResultOk(FHttpResponsePtr Response, const THandler<T>& OnSuccess)
 	{
 		typename std::remove_const<typename std::remove_reference<T>::type>::type Result;
-		FJsonObjectConverter::JsonObjectStringToUStruct(Response->GetContentAsString(), &Result, 0, 0);
+		DecodeHttpResultTimed(Response, Result);
 
 		OnSuccess.ExecuteIfBound(Result);
 	}
@@ -519,6 +562,83 @@ namespace AccelByte
 		OnSuccess.ExecuteIfBound(*JsonObject.Get());
 	}
 
+	/**
+	 * @brief Decode the body on a worker thread and call the handler back on the game thread, see FAsyncJsonDecoding.
+	 *
+	 * @return false when the body is handled synchronously instead, i.e. async decoding is disabled, the body is below
+	 * the size threshold or the handler type has no JSON struct result.
+	 */
+	template<typename ResultType, typename HandlerType>
+	inline bool DecodeHttpResultAsync(FHttpResponsePtr Response, const HandlerType& OnSuccess)
+	{
+		if (!FAsyncJsonDecoding::ShouldDecodeAsync(Response->GetContent().Num()))
+		{
+			return false;
+		}
+
+		// the handler is copied, called and destroyed on the game thread, the worker only moves the unique owner along
+		// so no reference to it is left behind when the worker task is destroyed
+		TUniquePtr<HandlerType> Handler = MakeUnique<HandlerType>(OnSuccess);
+		// the scheduler only knows the endpoint while it calls the handlers, so it is read before leaving the game thread
+		FString RouteTemplate = FAsyncJsonDecoding::IsParseStatsEnabled() ? FAsyncJsonDecoding::GetCompletingRouteTemplate(Response->GetURL()) : FString();
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Response, Handler = MoveTemp(Handler), RouteTemplate = MoveTemp(RouteTemplate)]() mutable
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			TUniquePtr<ResultType> Result = MakeUnique<ResultType>();
+			DecodeHttpResult(Response, *Result);
+			if (!RouteTemplate.IsEmpty())
+			{
+				FAsyncJsonDecoding::RecordParse(RouteTemplate, Response->GetContent().Num(), FPlatformTime::Seconds() - StartTime, true);
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [Handler = MoveTemp(Handler), Result = MoveTemp(Result)]()
+			{
+				Handler->ExecuteIfBound(*Result);
+			});
+		});
+
+		return true;
+	}
+
+	inline bool HandleHttpResultOkAsync(FHttpResponsePtr Response, const FVoidHandler& OnSuccess)
+	{
+		return false;
+	}
+
+	template<typename T>
+	inline bool HandleHttpResultOkAsync(FHttpResponsePtr Response, const THandler<TArray<T>>& OnSuccess)
+	{
+		return DecodeHttpResultAsync<TArray<T>>(Response, OnSuccess);
+	}
+
+	template<>
+	inline bool HandleHttpResultOkAsync<uint8>(FHttpResponsePtr Response, const THandler<TArray<uint8>>& OnSuccess)
+	{
+		return false;
+	}
+
+	template<typename T>
+	inline bool HandleHttpResultOkAsync(FHttpResponsePtr Response, const THandler<T>& OnSuccess)
+	{
+		return DecodeHttpResultAsync<typename std::remove_const<typename std::remove_reference<T>::type>::type>(Response, OnSuccess);
+	}
+
+	template<>
+	inline bool HandleHttpResultOkAsync<FString>(FHttpResponsePtr Response, const THandler<FString>& OnSuccess)
+	{
+		return false;
+	}
+
+	inline bool HandleHttpResultOkAsync(FHttpResponsePtr Response, const THandler<FAccelByteModelsPartyDataNotif>& OnSuccess)
+	{
+		return false;
+	}
+
+	inline bool HandleHttpResultOkAsync(FHttpResponsePtr Response, const THandler<FJsonObject>& OnSuccess)
+	{
+		return false;
+	}
+
 	template<typename T>
 	FHttpRequestCompleteDelegate CreateHttpResultHandler(const T& OnSuccess, const FErrorHandler& OnError)
 	{
@@ -528,11 +648,14 @@ namespace AccelByte
 		{
 			if (Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
 			{
-				HandleHttpResultOk(Response, OnSuccess);
+				if (!HandleHttpResultOkAsync(Response, OnSuccess))
+				{
+					HandleHttpResultOk(Response, OnSuccess);
+				}
 				return;
 			}
 
-			if (!bFinished)
+			if (!bFinished && !FHttpRequestJournal::IsJournaled(Request))
 			{
 				OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::NetworkError), "Request not sent.");
 				return;
@@ -554,12 +677,15 @@ namespace AccelByte
 		{
 			if (Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
 			{
-				HandleHttpResultOk(Response, OnSuccess);
+				if (!HandleHttpResultOkAsync(Response, OnSuccess))
+				{
+					HandleHttpResultOk(Response, OnSuccess);
+				}
 				return;
 			}
 
 
-			if (!bFinished)
+			if (!bFinished && !FHttpRequestJournal::IsJournaled(Request))
 			{
                 OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::NetworkError), "Request not sent.", FJsonObject{});
                 return;
@@ -0,0 +1,115 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Http.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Asks the owning credentials to refresh the token now.
+ * Returns false when it can't, e.g. not logged in or backing off after a failed refresh.
+ */
+DECLARE_DELEGATE_RetVal(bool, FHttpAuthorizationRefreshDelegate);
+
+/**
+ * @brief Authorization header value of one token generation, never modified once published.
+ */
+typedef TSharedRef<const FString, ESPMode::ThreadSafe> FHttpAuthorizationHeaderRef;
+
+/**
+ * @brief Authorization header of a credentials object, formatted once per access token instead of once per request.
+ * Every new token bumps the generation, so a request signed with an older token can be detected and re-signed.
+ * Owned by the credentials through a shared reference and shared with the HTTP retry scheduler.
+ * It also tells the scheduler when a token refresh is in progress, so requests can wait for the new token
+ * instead of failing with 401. The header and its generation can be read from any thread, the rest is game thread only.
+ */
+class ACCELBYTEUE4SDK_API FHttpAuthorization
+{
+public:
+	/**
+	 * @brief Build the "Bearer <token>" header of a new access token and start a new generation.
+	 */
+	void SetAccessToken(const FString& AccessToken);
+
+	/**
+	 * @brief Clear the header and start a new generation, e.g. on logout.
+	 */
+	void Reset();
+
+	/**
+	 * @brief Header value to send, empty when there's no token. A new token publishes a new value,
+	 * the returned one keeps the token it was read with.
+	 */
+	FHttpAuthorizationHeaderRef GetHeader() const;
+
+	/**
+	 * @brief Header value and the generation it belongs to, read together.
+	 */
+	FHttpAuthorizationHeaderRef GetHeader(uint32& OutGeneration) const;
+
+	/**
+	 * @brief Generation of the current header, 0 before the first token.
+	 */
+	uint32 GetGeneration() const;
+
+	bool HasToken() const;
+
+	/**
+	 * @brief Set the current header on a request that was signed with an older generation.
+	 *
+	 * @param Request Request to sign.
+	 * @param InOutGeneration Generation the request was signed with, updated when it is re-signed.
+	 *
+	 * @return true when the request was re-signed.
+	 */
+	bool Resign(const FHttpRequestPtr& Request, uint32& InOutGeneration) const;
+
+	/**
+	 * @brief Mark a token refresh as started, called by the credentials.
+	 */
+	void BeginRefresh();
+
+	/**
+	 * @brief Mark the token refresh as ended without a new token, e.g. it failed. SetAccessToken ends it too.
+	 */
+	void EndRefresh();
+
+	bool IsRefreshing() const;
+
+	/**
+	 * @brief Set the delegate the credentials refresh their token with, see RequestRefresh.
+	 */
+	void SetRefreshHandler(const FHttpAuthorizationRefreshDelegate& Handler);
+
+	/**
+	 * @brief Start a refresh unless one is already in progress, e.g. after a request failed with 401.
+	 *
+	 * @return true when a refresh is in progress after the call, so OnRefreshEnded will be broadcast.
+	 */
+	bool RequestRefresh();
+
+	/**
+	 * @brief Broadcast when a refresh ends, with or without a new token.
+	 */
+	FSimpleMulticastDelegate& OnRefreshEnded();
+
+private:
+	void Publish(const FHttpAuthorizationHeaderRef& NewHeader);
+
+	mutable FCriticalSection HeaderLock;
+	FHttpAuthorizationHeaderRef Header = MakeShared<FString, ESPMode::ThreadSafe>();
+	uint32 Generation = 0;
+	bool bRefreshing = false;
+	FHttpAuthorizationRefreshDelegate RefreshHandler;
+	FSimpleMulticastDelegate RefreshEnded;
+};
+
+typedef TSharedRef<FHttpAuthorization, ESPMode::ThreadSafe> FHttpAuthorizationRef;
+typedef TSharedPtr<FHttpAuthorization, ESPMode::ThreadSafe> FHttpAuthorizationPtr;
+
+}
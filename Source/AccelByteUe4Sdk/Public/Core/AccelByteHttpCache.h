@@ -0,0 +1,184 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Http.h"
+#include "Containers/List.h"
+#include "Containers/Queue.h"
+#include "Async/Future.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Result of looking up a request in the response cache.
+ */
+enum class EHttpCacheLookup : uint8
+{
+	Miss,	// nothing cached, send the request as is
+	Fresh,	// cached response is within its TTL, no need to send the request
+	Stale	// cached response expired, the request was turned into a conditional one
+};
+
+/**
+ * @brief Counters of the HTTP response cache.
+ */
+struct ACCELBYTEUE4SDK_API FHttpCacheStats
+{
+	// Requests served from the cache without a round trip.
+	int64 Hits = 0;
+	// Conditional requests answered with 304 Not Modified.
+	int64 Revalidations = 0;
+	int64 Misses = 0;
+	int64 Evictions = 0;
+	// Response bytes handed to callers from the cache, including revalidated ones.
+	int64 BytesServed = 0;
+	int64 MemoryBytes = 0;
+	int32 Entries = 0;
+
+	double GetHitRatio() const
+	{
+		const int64 Total = Hits + Revalidations + Misses;
+		return Total > 0 ? static_cast<double>(Hits + Revalidations) / Total : 0.0;
+	}
+};
+
+/**
+ * @brief LRU cache of GET responses with per endpoint TTL and ETag / Last-Modified revalidation.
+ * Only requests matching a TTL rule are cached, optionally persisted to disk so they survive a restart.
+ * Lookups only read memory, the disk is read and written on worker threads.
+ */
+class ACCELBYTEUE4SDK_API FHttpResponseCache
+{
+public:
+	static const int64 DefaultMemoryBudget;
+
+	/**
+	 * @brief Cache GET responses of an endpoint. Only register endpoints whose response doesn't depend on the caller,
+	 * the cache is keyed on URL and shared between users.
+	 *
+	 * @param UrlPrefix Every request URL starting with it is cached, the longest matching prefix wins.
+	 * @param TtlSeconds Seconds a response is served without asking the server, 0 or less stops caching the endpoint.
+	 */
+	void SetTtl(const FString& UrlPrefix, double TtlSeconds);
+
+	/**
+	 * @brief Get the TTL of the endpoint the URL belongs to, 0 when it is not cached.
+	 */
+	double GetTtl(const FString& Url) const;
+
+	/**
+	 * @brief Replace the TTL rules with the ones of another cache, cached responses are not copied. Safe to call from any thread.
+	 */
+	void CopyTtls(const FHttpResponseCache& Other);
+
+	/**
+	 * @brief Set the maximum size of the cached responses kept in memory, least recently used ones are evicted first.
+	 */
+	void SetMemoryBudget(int64 Bytes);
+
+	/**
+	 * @brief Persist cached responses under the directory, empty disables the disk cache.
+	 * The responses persisted by a previous session are loaded on a worker thread and served once they are loaded.
+	 */
+	void SetDiskCacheDirectory(const FString& Directory);
+
+	/**
+	 * @brief Set how long new and revalidated responses are collected before they are written to disk together.
+	 */
+	void SetDiskFlushDelay(double Seconds);
+
+	bool IsCacheable(const FHttpRequestPtr& Request) const;
+
+	/**
+	 * @brief Look up a cacheable request. A stale entry with a validator adds If-None-Match / If-Modified-Since to the request.
+	 *
+	 * @param Request Request about to be sent.
+	 * @param OutResponse Cached response when the result is Fresh, the response being revalidated when it is Stale.
+	 */
+	EHttpCacheLookup Lookup(const FHttpRequestPtr& Request, FHttpResponsePtr& OutResponse);
+
+	/**
+	 * @brief Update the cache with the response of a cacheable request.
+	 *
+	 * @param RevalidatedResponse Response Lookup returned for a Stale request, served on 304 Not Modified even when it was
+	 * evicted while the request was in flight.
+	 *
+	 * @return Response to hand to the caller, the cached one when the server answered 304 Not Modified.
+	 */
+	FHttpResponsePtr OnResponse(const FHttpRequestPtr& Request, const FHttpResponsePtr& Response, const FHttpResponsePtr& RevalidatedResponse = nullptr);
+
+	/**
+	 * @brief Write the responses waiting for the disk flush, blocks until they are written.
+	 */
+	void Close();
+
+	/**
+	 * @brief Drop every cached response from memory and disk.
+	 */
+	void Clear();
+
+	const FHttpCacheStats& GetStats() const;
+
+private:
+	struct FCacheEntry
+	{
+		FString Url;
+		FHttpResponsePtr Response;
+		FString ETag;
+		FString LastModified;
+		FDateTime ExpiresAt;
+		int64 Size = 0;
+		TDoubleLinkedList<FString>::TDoubleLinkedListNode* LruNode = nullptr;
+	};
+
+	// response read from the disk cache by a worker
+	struct FDiskEntry
+	{
+		FString Url;
+		int32 ResponseCode = 0;
+		TArray<FString> Headers;
+		TArray<uint8> Content;
+		FString ETag;
+		FString LastModified;
+		FDateTime ExpiresAt;
+	};
+
+	typedef TQueue<FDiskEntry, EQueueMode::Spsc> FDiskEntryQueue;
+
+	FCacheEntry* FindEntry(const FString& Url);
+	FCacheEntry& AddEntry(const FString& Url, const FHttpResponsePtr& CachedResponse, const FString& ETag, const FString& LastModified, const FDateTime& ExpiresAt);
+	void RemoveEntry(const FString& Url);
+	void Touch(FCacheEntry& Entry);
+	void TrimToBudget();
+
+	FString GetDiskPath(const FString& Url) const;
+	void LoadDiskCache();
+	void MergeDiskEntries();
+	void MarkDirty(const FCacheEntry& Entry);
+	void ScheduleDiskFlush();
+	void FlushToDisk();
+	void WaitForDiskWrite();
+	static bool ReadDiskEntry(const FString& Path, FDiskEntry& OutEntry);
+	static TArray<uint8> SerializeEntry(const FCacheEntry& Entry);
+
+	TMap<FString, FCacheEntry> Entries;
+	TDoubleLinkedList<FString> LruList;
+	TArray<TPair<FString, double>> Ttls;
+	// SetTtl is game thread only, the lock lets CopyTtls read the rules from another thread
+	mutable FRWLock TtlLock;
+	int64 MemoryBudget = DefaultMemoryBudget;
+	FString DiskCacheDirectory;
+	// filled by the worker loading the disk cache, replaced when the directory changes or the cache is cleared
+	TSharedRef<FDiskEntryQueue, ESPMode::ThreadSafe> LoadedDiskEntries = MakeShared<FDiskEntryQueue, ESPMode::ThreadSafe>();
+	TSet<FString> DirtyUrls;
+	TFuture<void> PendingDiskWrite;
+	double DiskFlushDelay = 1.0;
+	FDelegateHandle DiskFlushHandle;
+	FHttpCacheStats Stats;
+};
+
+}
@@ -0,0 +1,139 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Http.h"
+#include "Core/AccelByteHttpAuthorization.h"
+
+namespace AccelByte
+{
+
+enum class EHttpVerb : uint8
+{
+	Get,
+	Post,
+	Put,
+	Patch,
+	Delete
+};
+
+/**
+ * @brief Verb and path template of a REST endpoint, relative to the base URL of its service.
+ * Placeholders are written as {name}, e.g. TEXT("/v1/public/namespaces/{namespace}/users/{userId}/statitems").
+ */
+struct FHttpEndpoint
+{
+	const EHttpVerb Verb;
+	const TCHAR* const PathTemplate;
+
+	constexpr FHttpEndpoint(EHttpVerb InVerb, const TCHAR* InPathTemplate)
+		: Verb(InVerb)
+		, PathTemplate(InPathTemplate)
+	{
+	}
+};
+
+/**
+ * @brief Builds the HTTP request of an endpoint in a single URL buffer.
+ * Path parameters must be given in the order they appear in the template, query parameters after them.
+ * Content-Type and Accept default to application/json.
+ * API classes pass the builder to FHttpRetryScheduler::ProcessRequest, which builds and sends the request.
+ */
+class ACCELBYTEUE4SDK_API FHttpRequestBuilder
+{
+public:
+	/**
+	 * @param InEndpoint Endpoint descriptor, usually a constexpr in the API translation unit.
+	 * @param BaseUrl Base URL of the service, e.g. Settings.StatisticServerUrl.
+	 */
+	FHttpRequestBuilder(const FHttpEndpoint& InEndpoint, const FString& BaseUrl);
+
+	/**
+	 * @brief Fill the next {Name} placeholder of the path template. The value is inserted as is, encode it if needed.
+	 */
+	FHttpRequestBuilder& Path(const TCHAR* Name, const FString& Value);
+
+	/**
+	 * @brief Append a query parameter, skipped when the value is empty.
+	 */
+	FHttpRequestBuilder& Query(const TCHAR* Name, const FString& Value);
+	FHttpRequestBuilder& Query(const TCHAR* Name, int32 Value);
+	FHttpRequestBuilder& Query(const TCHAR* Name, uint32 Value);
+	FHttpRequestBuilder& Query(const TCHAR* Name, bool Value);
+
+	/**
+	 * @brief Append a comma separated query parameter, skipped when there are no values.
+	 * Every value is URL encoded, pass them unencoded.
+	 */
+	FHttpRequestBuilder& Query(const TCHAR* Name, const TArray<FString>& Values);
+
+	/**
+	 * @brief Sign the request with the cached header of credentials, e.g. Credentials.GetAuthorization().
+	 * The header is formatted once per access token by the credentials, not once per request.
+	 */
+	FHttpRequestBuilder& Authorization(const FHttpAuthorizationRef& InAuthorization);
+
+	/**
+	 * @brief Set the Authorization header to a bearer access token that isn't owned by credentials.
+	 */
+	FHttpRequestBuilder& Bearer(const FString& AccessToken);
+
+	/**
+	 * @brief Set the Authorization header to a prebuilt value, e.g. a Basic client header.
+	 */
+	FHttpRequestBuilder& Authorization(const FString& HeaderValue);
+
+	FHttpRequestBuilder& Header(const FString& Name, const FString& Value);
+	FHttpRequestBuilder& ContentType(const FString& Value);
+	FHttpRequestBuilder& Accept(const FString& Value);
+	FHttpRequestBuilder& Content(const FString& Body);
+	FHttpRequestBuilder& Content(FString&& Body);
+	FHttpRequestBuilder& Content(const TArray<uint8>& Body);
+	FHttpRequestBuilder& Content(TArray<uint8>&& Body);
+	FHttpRequestBuilder& Progress(const FHttpRequestProgressDelegate& OnProgress);
+
+	const FHttpEndpoint& GetEndpoint() const;
+	const FString& GetUrl();
+
+	/**
+	 * @brief Get the verb, the path of the base URL and the path template, e.g. "GET /iam/v3/public/namespaces/{namespace}/users/{userId}".
+	 * Unlike the URL it holds no parameter values, so it can key per endpoint metrics.
+	 */
+	FString GetRouteTemplate() const;
+
+	/**
+	 * @brief Credentials the request is signed with, invalid when it isn't signed by Authorization(FHttpAuthorizationRef).
+	 */
+	const FHttpAuthorizationPtr& GetAuthorization() const;
+
+	/**
+	 * @brief Generation of the authorization header set by the last Build(), see FHttpAuthorization::GetGeneration.
+	 */
+	uint32 GetAuthorizationGeneration() const;
+
+	FHttpRequestPtr Build();
+
+private:
+	void FinishPath();
+
+	const FHttpEndpoint Endpoint;
+	const TCHAR* TemplateCursor;
+	FString Url;
+	const int32 BaseUrlLength;
+	bool bHasQuery = false;
+	FHttpAuthorizationPtr AuthorizationRef;
+	uint32 AuthorizationGeneration = 0;
+	FString AuthorizationHeader;
+	const FString* ContentTypeHeader;
+	const FString* AcceptHeader;
+	TArray<TPair<FString, FString>, TInlineAllocator<2>> ExtraHeaders;
+	FString StringContent;
+	TArray<uint8> BinaryContent;
+	bool bBinaryContent = false;
+	FHttpRequestProgressDelegate ProgressDelegate;
+};
+
+}
@@ -0,0 +1,178 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Http.h"
+#include "Core/AccelByteHttpAuthorization.h"
+#include "Async/Future.h"
+
+class IFileHandle;
+
+namespace AccelByte
+{
+
+class FHttpRetryScheduler;
+
+/**
+ * @brief How journaled writes to the same URL are compacted.
+ */
+enum class EHttpJournalMode : uint8
+{
+	Supersede,	// only the last write to a URL is kept, e.g. a record replaced as a whole or an achievement unlock
+	Append		// every write is replayed in order, e.g. stat increments. A write whose response was lost may be applied twice.
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FHttpJournalQueuedDelegate, const FString& /*Url*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FHttpJournalReplayedDelegate, const FString& /*Url*/, int32 /*ResponseCode*/);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FHttpJournalFailedDelegate, const FString& /*Url*/, int32 /*ResponseCode*/, const FString& /*ResponseContent*/);
+
+/**
+ * @brief Opt-in durable outbox of an HTTP retry scheduler, see FHttpRetryScheduler::GetJournal.
+ * A write matching a journal rule that finishes without any response, i.e. the network was down until its retry deadline,
+ * is appended to a journal file and replayed in order once the host answers again and the authorization has a token.
+ * The caller's error handler gets ErrorCodes::HttpRequestJournaled instead of a network error, so it can tell the write
+ * will still be applied and must not send it again, the outcome of the replay is reported by the journal delegates.
+ * Journal files belong to one principal, open one per signed-in user. Game thread only.
+ */
+class ACCELBYTEUE4SDK_API FHttpRequestJournal
+{
+public:
+	static const double DefaultReplayInterval;
+
+	explicit FHttpRequestJournal(FHttpRetryScheduler& Scheduler);
+	~FHttpRequestJournal();
+
+	/**
+	 * @brief Journal writes whose verb and URL match the pattern, e.g. for CloudSave::ReplaceUserRecord
+	 * AddRule(TEXT("PUT */v1/namespaces/*/users/*/records/*"), EHttpJournalMode::Supersede).
+	 *
+	 * @param Pattern Verb, a space and the URL, with * wildcards.
+	 * @param Mode How writes to the same URL are compacted.
+	 */
+	void AddRule(const FString& Pattern, EHttpJournalMode Mode);
+
+	/**
+	 * @brief Open a journal file, load and compact its pending writes and start replaying them.
+	 *
+	 * @param FilePath Journal file, created when missing, e.g. under FPaths::ProjectSavedDir() named after the user id.
+	 * @param Authorization Authorization the replayed writes are signed with, e.g. Credentials.GetAuthorization().
+	 *
+	 * @return false when the file can't be opened for writing.
+	 */
+	bool Open(const FString& FilePath, const FHttpAuthorizationRef& Authorization);
+
+	/**
+	 * @brief Write the buffered records to disk and close the file. Pending writes stay in the file for the next Open.
+	 */
+	void Close();
+
+	bool IsOpen() const;
+
+	/**
+	 * @brief Called by the scheduler for every finished request, journals lost writes and drops the journaled writes
+	 * a newer successful write superseded.
+	 *
+	 * @return true when the request was journaled for replay.
+	 */
+	bool OnRequestFinished(const FHttpRequestPtr& Request, const FHttpResponsePtr& Response);
+
+	/**
+	 * @brief Whether the request was journaled for replay, only known while the scheduler calls its completion delegates.
+	 */
+	static bool IsJournaled(const FHttpRequestPtr& Request);
+
+	/**
+	 * @brief Try to replay the pending writes now instead of at the next replay interval.
+	 */
+	void Replay();
+
+	int32 GetPendingCount() const;
+
+	/**
+	 * @brief Set the seconds between replay attempts while the host doesn't answer, doubled up to 8 times on every failure.
+	 */
+	void SetReplayInterval(double Seconds);
+
+	/**
+	 * @brief Set how long appended records are buffered before they are written and flushed to disk together.
+	 * The write and the flush run on a worker thread.
+	 */
+	void SetFlushDelay(double Seconds);
+
+	FHttpJournalQueuedDelegate& OnQueued();
+	FHttpJournalReplayedDelegate& OnReplayed();
+	FHttpJournalFailedDelegate& OnReplayFailed();
+
+private:
+	friend class FHttpRetryScheduler;
+
+	// request whose completion delegates the scheduler is calling, when it was journaled
+	static const IHttpRequest* CompletingJournaledRequest;
+
+	struct FRule
+	{
+		FString Pattern;
+		EHttpJournalMode Mode;
+	};
+
+	struct FEntry
+	{
+		uint64 Id = 0;
+		EHttpJournalMode Mode = EHttpJournalMode::Supersede;
+		FString Verb;
+		FString Url;
+		TArray<FString> Headers;
+		TArray<uint8> Content;
+	};
+
+	enum class ERecordType : uint8
+	{
+		Add = 1,
+		Remove = 2
+	};
+
+	const FRule* FindRule(const FString& Verb, const FString& Url) const;
+	void AddEntry(FEntry&& Entry);
+	void RemoveEntry(int32 Index);
+	void AppendRecord(ERecordType Type, const FEntry& Entry);
+	void Load(const TArray<uint8>& Data);
+	bool Rewrite();
+	void FlushToDisk();
+	void WaitForWrite();
+	void ScheduleFlush();
+	void ScheduleReplay(double Delay);
+	void OnReplayComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccessful);
+
+	FHttpRetryScheduler& Scheduler;
+	TArray<FRule> Rules;
+	FString FilePath;
+	// shared with the worker writing the last flush
+	TSharedPtr<IFileHandle, ESPMode::ThreadSafe> FileHandle;
+	TFuture<void> PendingWrite;
+	FHttpAuthorizationPtr Authorization;
+
+	TArray<FEntry> Entries;
+	uint64 NextId = 1;
+	int32 RemovedRecordCount = 0;
+	TArray<uint8> PendingBytes;
+
+	FHttpRequestPtr ReplayRequest;
+	uint64 ReplayEntryId = 0;
+	int32 ReplayFailures = 0;
+	double ReplayInterval = DefaultReplayInterval;
+	double FlushDelay = 0.25;
+	FDelegateHandle FlushHandle;
+	FDelegateHandle ReplayHandle;
+
+	FHttpJournalQueuedDelegate QueuedDelegate;
+	FHttpJournalReplayedDelegate ReplayedDelegate;
+	FHttpJournalFailedDelegate ReplayFailedDelegate;
+
+	FHttpRequestJournal(const FHttpRequestJournal&) = delete;
+	FHttpRequestJournal& operator=(const FHttpRequestJournal&) = delete;
+};
+
+}
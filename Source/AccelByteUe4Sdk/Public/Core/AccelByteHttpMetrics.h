@@ -0,0 +1,166 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Http.h"
+#include "Templates/Atomic.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Log-linear latency histogram, 16 buckets per power of two, so percentiles are within about 6% of the recorded values.
+ * Values are kept in microseconds up to about 2 minutes, longer ones land in the last bucket.
+ */
+class ACCELBYTEUE4SDK_API FHttpLatencyHistogram
+{
+public:
+	void Record(double Seconds);
+
+	/**
+	 * @brief Get the value below which the given percent of the recorded values fall, e.g. 99 for p99.
+	 *
+	 * @return Seconds, 0 when nothing was recorded.
+	 */
+	double GetPercentile(double Percent) const;
+
+	int64 GetCount() const;
+	double GetMean() const;
+	double GetMax() const;
+	void Reset();
+
+private:
+	static int32 GetBucketIndex(uint64 Microseconds);
+	static uint64 GetBucketUpperBound(int32 Index);
+
+	// allocated on the first record, most endpoints of a session are never called
+	TArray<int64> Buckets;
+	int64 Count = 0;
+	double Total = 0.0;
+	double Max = 0.0;
+};
+
+/**
+ * @brief Counters of one endpoint, keyed on verb and route template, e.g. "GET /iam/v3/public/namespaces/{namespace}/users/{userId}".
+ */
+struct ACCELBYTEUE4SDK_API FHttpEndpointMetrics
+{
+	// Finished requests, a request counts once however many times it was retried.
+	int64 RequestCount = 0;
+	int64 RetryCount = 0;
+	// Requests finished with a connection error, a timeout or a 4xx / 5xx response.
+	int64 ErrorCount = 0;
+	// Request content of every attempt and the content of the final response.
+	int64 BytesSent = 0;
+	int64 BytesReceived = 0;
+	double TotalQueueWait = 0.0;
+	double MaxQueueWait = 0.0;
+	// From ProcessRequest to the caller's delegate, retries included.
+	FHttpLatencyHistogram Latency;
+	// From the start of the last attempt to its first received bytes. Reported by the HTTP module's progress callback,
+	// so the resolution is one HTTP manager tick.
+	FHttpLatencyHistogram TimeToFirstByte;
+	// Final response code of the requests, 0 when there was no response.
+	TMap<int32, int64> ResponseCodes;
+
+	double GetAverageQueueWait() const
+	{
+		return RequestCount > 0 ? TotalQueueWait / RequestCount : 0.0;
+	}
+};
+
+/**
+ * @brief Flattened copy of an endpoint's metrics handed to the snapshot delegate, times in seconds.
+ */
+struct ACCELBYTEUE4SDK_API FHttpEndpointMetricsSnapshot
+{
+	FString Route;
+	int64 RequestCount = 0;
+	int64 RetryCount = 0;
+	int64 ErrorCount = 0;
+	int64 BytesSent = 0;
+	int64 BytesReceived = 0;
+	double AverageQueueWait = 0.0;
+	double MaxQueueWait = 0.0;
+	double LatencyP50 = 0.0;
+	double LatencyP95 = 0.0;
+	double LatencyP99 = 0.0;
+	double LatencyMax = 0.0;
+	double TimeToFirstByteP50 = 0.0;
+	double TimeToFirstByteP95 = 0.0;
+	double TimeToFirstByteP99 = 0.0;
+	TMap<int32, int64> ResponseCodes;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FHttpMetricsSnapshotDelegate, const TArray<FHttpEndpointMetricsSnapshot>&);
+
+/**
+ * @brief Per endpoint metrics of the requests of an HTTP retry scheduler, see FHttpRetryScheduler::GetMetrics.
+ * Game thread only.
+ */
+class ACCELBYTEUE4SDK_API FHttpMetrics
+{
+public:
+	~FHttpMetrics();
+
+	/**
+	 * @brief Enabled by default, disabling it stops recording but keeps what was recorded.
+	 */
+	void SetEnabled(bool bEnabled);
+	bool IsEnabled() const;
+
+	/**
+	 * @brief Record a finished request.
+	 *
+	 * @param Request The request.
+	 * @param RouteTemplate Endpoint of the request, see FHttpRequestBuilder::GetRouteTemplate. When empty it is guessed from
+	 * the verb and URL, see HttpRequest::GetRouteTemplate.
+	 * @param Response Final response, null when there was none.
+	 * @param Attempts Number of times the request was sent.
+	 * @param QueueWait Seconds spent waiting for a free slot over every attempt.
+	 * @param Latency Seconds from ProcessRequest to completion.
+	 * @param TimeToFirstByte Seconds to the first received bytes of the last attempt, negative when unknown.
+	 */
+	void Record(const FHttpRequestPtr& Request, const FString& RouteTemplate, const FHttpResponsePtr& Response, int32 Attempts, double QueueWait, double Latency, double TimeToFirstByte);
+
+	/**
+	 * @brief Get the metrics of an endpoint, null when it wasn't called.
+	 *
+	 * @param Route Verb and route template, e.g. "GET /iam/v3/public/namespaces/{namespace}/users/{userId}", or OtherRoute.
+	 */
+	const FHttpEndpointMetrics* Find(const FString& Route) const;
+
+	const TMap<FString, FHttpEndpointMetrics>& GetEndpoints() const;
+
+	void TakeSnapshot(TArray<FHttpEndpointMetricsSnapshot>& OutSnapshot) const;
+
+	void Reset();
+
+	/**
+	 * @brief Broadcast a snapshot of every endpoint to OnSnapshot periodically.
+	 *
+	 * @param Seconds Period of the snapshots, 0 or less stops them.
+	 * @param bResetAfterSnapshot Start over after each snapshot, so every snapshot covers one period only.
+	 */
+	void SetSnapshotInterval(float Seconds, bool bResetAfterSnapshot = false);
+
+	FHttpMetricsSnapshotDelegate& OnSnapshot();
+
+	/**
+	 * @brief Route of the requests recorded once MaxRoutes routes exist, so guessed routes that kept an ID can't grow the map without bound.
+	 */
+	static const FString OtherRoute;
+	static constexpr int32 MaxRoutes = 256;
+
+private:
+	// read by FHttpRetryScheduler::CopyPolicies from any thread
+	TAtomic<bool> bEnabled{ true };
+	TMap<FString, FHttpEndpointMetrics> Endpoints;
+	FHttpMetricsSnapshotDelegate SnapshotDelegate;
+	FDelegateHandle SnapshotHandle;
+};
+
+}
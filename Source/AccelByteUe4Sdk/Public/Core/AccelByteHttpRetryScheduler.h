@@ -9,6 +9,13 @@
 
 #include "HttpRetrySystem.h"
 #include "Runtime/Core/Public/Containers/Ticker.h"
+#include "Runtime/Core/Public/Containers/Queue.h"
+#include "AccelByteHttpCache.h"
+#include "AccelByteHttpMetrics.h"
+#include "AccelByteHttpTrace.h"
+#include "AccelByteHttpJournal.h"
+#include "AccelByteHttpAuthorization.h"
+#include "AccelByteHttpEndpoint.h"
 
 #include "Runtime/Core/Public/Misc/AutomationTest.h"
 #include "HttpModule.h"
@@ -37,39 +44,407 @@ namespace AccelByte
 namespace HttpRequest
 {
 	bool IsFinished(const FHttpRequestPtr& Request);
+
+	/**
+	 * @brief Get scheme, host and port part of the URL, e.g. https://demo.accelbyte.io
+	 */
+	FString GetUrlHost(const FString& Url);
+
+	/**
+	 * @brief Get the path of the URL with IDs replaced by placeholders, so requests to the same endpoint share one key,
+	 * e.g. /iam/v3/public/namespaces/{namespace}/users/{id}.
+	 */
+	FString GetRouteTemplate(const FString& Url);
 }
 
+/**
+ * @brief Priority classes of the HTTP retry scheduler. Queued requests are started in this order when a slot is freed.
+ */
+enum class EHttpRequestPriority : uint8
+{
+	Auth,
+	Matchmaking,
+	Gameplay,
+	Telemetry,
+	Max
+};
+
+/**
+ * @brief How the retry delay is randomized, so clients failing at the same time don't retry in lockstep.
+ */
+enum class EHttpRetryJitter : uint8
+{
+	None,			// plain capped exponential backoff
+	Full,			// random between 0 and the capped exponential delay
+	Equal,			// half of the capped exponential delay plus a random half
+	Decorrelated	// random between the initial delay and 3 times the previous delay
+};
+
+/**
+ * @brief Retry policy of a single request, or the default of a service.
+ */
+struct ACCELBYTEUE4SDK_API FHttpRetryPolicy
+{
+	// Maximum number of attempts including the first one, 0 or less means limited by TotalTimeout only.
+	int32 MaxAttempts = 0;
+	double InitialDelay = 1.0;
+	double MaximumDelay = 30.0;
+	// Seconds from the first attempt until the request is given up, 0 or less means limited by MaxAttempts only.
+	double TotalTimeout = 60.0;
+	EHttpRetryJitter Jitter = EHttpRetryJitter::Equal;
+	// Non idempotent requests are only retried when the server tells it didn't process them (429, 503).
+	bool bIdempotent = true;
+	// Sent without waiting for, or taking, one of the in-flight slots of its service.
+	bool bBypassAdmission = false;
+
+	/**
+	 * @brief Policy for writes that must not be applied twice, e.g. order creation or wallet debit.
+	 */
+	static FHttpRetryPolicy NonIdempotent();
+
+	/**
+	 * @brief Policy for small lookups where a late answer is useless, gives up after a few seconds.
+	 */
+	static FHttpRetryPolicy LatencySensitive();
+
+	/**
+	 * @brief Policy for uploads and downloads that may take minutes on a slow link, e.g. cloud storage slots.
+	 * Has no total deadline and doesn't hold an in-flight slot that smaller calls to the service are waiting for.
+	 */
+	static FHttpRetryPolicy Transfer();
+};
+
+/**
+ * @brief State of a per host circuit breaker.
+ */
+enum class EHttpCircuitState : uint8
+{
+	Closed,		// requests flow normally
+	Open,		// host is failing, requests are held back or failed fast
+	HalfOpen	// a single probe request is allowed to test the host
+};
+
+/**
+ * @brief Circuit breaker tuning of the HTTP retry scheduler.
+ */
+struct ACCELBYTEUE4SDK_API FHttpCircuitBreakerConfig
+{
+	// Consecutive failures (5xx, 429, connection error) before the circuit opens. 0 or less disables the breaker.
+	int32 FailureThreshold = 5;
+	// Seconds the circuit stays open before a probe is allowed, doubled every time the probe fails.
+	double OpenDuration = 5.0;
+	double MaxOpenDuration = 60.0;
+	// Seconds to hold other requests while a probe is in flight.
+	double HalfOpenHoldDelay = 1.0;
+	// Finish requests to an open host with a network error instead of holding them until the circuit closes.
+	bool bFailFast = false;
+};
+
+/**
+ * @brief Admission counters of a single priority class.
+ */
+struct ACCELBYTEUE4SDK_API FHttpRequestQueueStats
+{
+	int32 QueueDepth = 0;
+	int32 MaxQueueDepth = 0;
+	int64 TotalQueued = 0;
+	int64 TotalStarted = 0;
+	double TotalWaitTime = 0.0;
+	double MaxWaitTime = 0.0;
+
+	double GetAverageWaitTime() const
+	{
+		return TotalStarted > 0 ? TotalWaitTime / TotalStarted : 0.0;
+	}
+};
+
+/**
+ * @brief Counters of identical GET requests joined to one in flight.
+ */
+struct ACCELBYTEUE4SDK_API FHttpCoalescingStats
+{
+	// GET requests that were attached to an identical in-flight request, i.e. round trips saved.
+	int64 Hits = 0;
+	// GET requests that had to go to the network.
+	int64 Misses = 0;
+};
+
 class ACCELBYTEUE4SDK_API FHttpRetryScheduler
 {
 public:
 	static const int InitialDelay;
 	static const int MaximumDelay;
 	static const int TotalTimeout;
+	static const int DefaultMaxInFlightRequests;
+	static const int DefaultMaxParkedRequests;
+
+	bool ProcessRequest(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, EHttpRequestPriority Priority = EHttpRequestPriority::Gameplay);
+	bool ProcessRequest(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, const FHttpRetryPolicy& RetryPolicy, EHttpRequestPriority Priority = EHttpRequestPriority::Gameplay);
+
+	/**
+	 * @brief Build the request of an endpoint and process it, this is how the API classes send their requests.
+	 */
+	bool ProcessRequest(FHttpRequestBuilder& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, EHttpRequestPriority Priority = EHttpRequestPriority::Gameplay);
+	bool ProcessRequest(FHttpRequestBuilder& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, const FHttpRetryPolicy& RetryPolicy, EHttpRequestPriority Priority = EHttpRequestPriority::Gameplay);
 
-	bool ProcessRequest(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime);
 	bool PollRetry(double CurrentTime);
 
+	/**
+	 * @brief Number of requests owned by the scheduler, either in flight, queued or waiting for their next retry.
+	 */
+	int32 GetPendingTaskCount() const;
+
+	/**
+	 * @brief Set the maximum in-flight requests per host for services without their own limit.
+	 *
+	 * @param MaxInFlight Maximum concurrent requests, 0 or less means unlimited.
+	 */
+	void SetDefaultMaxInFlightRequests(int32 MaxInFlight);
+
+	/**
+	 * @brief Set the maximum in-flight requests of a service, e.g. Settings.CloudSaveServerUrl.
+	 *
+	 * @param ServiceUrl Base URL of the service, every request starting with it shares the limit.
+	 * @param MaxInFlight Maximum concurrent requests, 0 or less means unlimited.
+	 */
+	void SetMaxInFlightRequests(const FString& ServiceUrl, int32 MaxInFlight);
+
+	/**
+	 * @brief Get queue depth and wait time counters of a priority class.
+	 */
+	const FHttpRequestQueueStats& GetQueueStats(EHttpRequestPriority Priority) const;
+
+	/**
+	 * @brief Set the retry policy used by requests that don't pass their own and don't match any service policy.
+	 */
+	void SetDefaultRetryPolicy(const FHttpRetryPolicy& RetryPolicy);
+
+	/**
+	 * @brief Set the retry policy of a service, e.g. a longer deadline for Settings.CloudStorageServerUrl.
+	 *
+	 * @param ServiceUrl Base URL of the service, every request starting with it uses the policy.
+	 * @param RetryPolicy Policy used when the request doesn't pass its own.
+	 */
+	void SetRetryPolicy(const FString& ServiceUrl, const FHttpRetryPolicy& RetryPolicy);
+
+	/**
+	 * @brief Get the retry policy a request to the URL would use when it doesn't pass its own.
+	 */
+	FHttpRetryPolicy GetRetryPolicy(const FString& Url) const;
+
+	void SetCircuitBreakerConfig(const FHttpCircuitBreakerConfig& Config);
+
+	/**
+	 * @brief Get circuit breaker state of the host the URL points to.
+	 */
+	EHttpCircuitState GetCircuitState(const FString& Url) const;
+
+	/**
+	 * @brief Join GET requests with the same URL and Authorization header to the one already in flight.
+	 * The joined request is never sent, its delegate gets the response of the in-flight one. Enabled by default.
+	 */
+	void SetCoalescingEnabled(bool bEnabled);
+
+	const FHttpCoalescingStats& GetCoalescingStats() const;
+
+	/**
+	 * @brief Cache of GET responses served before the request reaches the network, see FHttpResponseCache::SetTtl.
+	 */
+	FHttpResponseCache& GetResponseCache();
+
+	/**
+	 * @brief Per endpoint request counts, retries, bytes, queue wait and latency histograms of the requests of this scheduler.
+	 */
+	FHttpMetrics& GetMetrics();
+
+	/**
+	 * @brief Ring buffer of the last requests of this scheduler, see FHttpTraceConfig to enable it.
+	 */
+	FHttpTraceRecorder& GetTraceRecorder();
+
+	/**
+	 * @brief Durable outbox of the writes of this scheduler lost to the network, nothing is journaled until it has rules and is opened.
+	 */
+	FHttpRequestJournal& GetJournal();
+
+	/**
+	 * @brief Track requests signed with the header of this authorization, e.g. Credentials.GetAuthorization().
+	 * When the token changes while such a request waits for a retry, the retry is sent with the new header.
+	 * Only requests built by FHttpRequestBuilder::Authorization(FHttpAuthorizationRef) are tracked, raw requests aren't.
+	 */
+	void AddAuthorization(const FHttpAuthorizationRef& Authorization);
+
+	void RemoveAuthorization(const FHttpAuthorizationRef& Authorization);
+
+	/**
+	 * @brief Set how many requests may wait for a token refresh of their authorization, see FHttpAuthorization::IsRefreshing.
+	 * Requests above the limit are sent with the current token. 0 disables parking.
+	 */
+	void SetMaxParkedRequests(int32 MaxParked);
+
+	/**
+	 * @brief Number of requests waiting for a token refresh.
+	 */
+	int32 GetParkedRequestCount() const;
+
+	/**
+	 * @brief Copy limits, retry policies, circuit breaker config, coalescing, parking, response cache TTLs and metrics settings of another scheduler.
+	 * Tasks, circuit state, authorizations, cached responses, recorded metrics, the trace recorder and the journal are not copied.
+	 * Safe to call from any thread: the setters, the lookups and the service table lock against this copy.
+	 */
+	void CopyPolicies(const FHttpRetryScheduler& Other);
+
 	void Startup();
-	void Shutdown();
+
+	/**
+	 * @brief Cancel every pending request.
+	 *
+	 * @param bFlushRequests Give in-flight requests one blocking flush of the HTTP manager first. It flushes every request
+	 * of the process, so schedulers that go away while the game keeps running, e.g. the one of an FApiClient, should skip it.
+	 */
+	void Shutdown(bool bFlushRequests = true);
 
 private:
+	friend class FHttpRequestJournal;
+
 	class FHttpRetryTask
 	{
 	public:
 		const FHttpRequestPtr Request;
 		const FHttpRequestCompleteDelegate CompleteDelegate;
 		const double RequestTime;
-		float NextDelay;
+		const FHttpRetryPolicy RetryPolicy;
+		int32 Attempts;
+		double NextDelay;
 		double NextRetryTime;
 		bool ScheduledRetry;
+		bool bFinished;
+		const EHttpRequestPriority Priority;
+		FString ServiceKey;
+		FString Host;
+		// route of the endpoint the request was built from, empty for prebuilt requests
+		FString RouteTemplate;
+		double QueuedTime;
+		bool bQueued;
+		bool bHoldsSlot;
+		bool bIsProbe;
+		bool bCacheable;
+		// cached response a conditional request revalidates, kept so a 304 can be served even if it is evicted meanwhile
+		FHttpResponsePtr RevalidatedResponse;
+		FString CoalescingKey;
+		TArray<FHttpRequestCompleteDelegate> CoalescedDelegates;
+		FHttpAuthorizationPtr Authorization;
+		uint32 AuthorizationGeneration;
+		bool bParked;
+		bool bReplayedAfterRefresh;
+		double StartTime;
+		double AttemptStartTime;
+		double FirstByteTime;
+		double QueueWaitTime;
+		bool bTraceSampled;
+
+		FHttpRetryTask(const FHttpRequestPtr& HttpRequest, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, const FHttpRetryPolicy& RetryPolicy, EHttpRequestPriority Priority);
+		bool CanRetry(int32 ResponseCode) const;
+		void ScheduleNextRetry(double CurrentTime, double RetryAfter);
+		double GetTimeoutTime() const;
+	};
+
+	enum class ETimerType : uint8
+	{
+		Retry,
+		Timeout
+	};
+
+	/**
+	 * @brief Deadline entry of the timer heap. Entries are never removed eagerly, stale ones are skipped when they expire.
+	 */
+	struct FHttpRetryTimer
+	{
+		double Time;
+		ETimerType Type;
+		TWeakPtr<FHttpRetryTask> Task;
+
+		FHttpRetryTimer(double Time, ETimerType Type, const TSharedRef<FHttpRetryTask>& Task)
+			: Time(Time)
+			, Type(Type)
+			, Task(Task)
+		{
+		}
 
-		FHttpRetryTask(const FHttpRequestPtr& HttpRequest, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, double NextDelay);
-		void ScheduleNextRetry(double CurrentTime);
+		bool operator<(const FHttpRetryTimer& Other) const
+		{
+			return Time < Other.Time;
+		}
 	};
 
+	/**
+	 * @brief Admission state of a host or service, requests above the limit wait in per priority FIFO queues.
+	 */
+	struct FHttpServiceQueue
+	{
+		int32 MaxInFlight = 0;
+		int32 InFlight = 0;
+		TQueue<TSharedPtr<FHttpRetryTask>, EQueueMode::Spsc> Queues[static_cast<int32>(EHttpRequestPriority::Max)];
+	};
+
+	struct FHttpCircuitBreaker
+	{
+		EHttpCircuitState State = EHttpCircuitState::Closed;
+		int32 ConsecutiveFailures = 0;
+		double OpenUntil = 0.0;
+		double OpenDuration = 0.0;
+		bool bProbeInFlight = false;
+	};
+
+	bool AcquireCircuit(const TSharedRef<FHttpRetryTask>& Task, double CurrentTime, double& OutHoldUntil);
+	void RecordHostResult(const TSharedRef<FHttpRetryTask>& Task, bool bFailed, double RetryAfter, double CurrentTime);
+	void HoldTask(const TSharedRef<FHttpRetryTask>& Task, double HoldUntil);
+	void PushTimer(const FHttpRetryTimer& Timer);
+	void ArmPollRetry(double DueTime);
+
+	FString GetServiceKey(const FString& Url) const;
+	TSharedRef<FHttpServiceQueue> FindOrAddService(const FString& ServiceKey);
+	bool StartOrEnqueueTask(const TSharedRef<FHttpRetryTask>& Task, double CurrentTime);
+	bool StartTask(const TSharedRef<FHttpRetryTask>& Task, FHttpServiceQueue& Service, double CurrentTime);
+	void ReleaseSlot(const TSharedRef<FHttpRetryTask>& Task, double CurrentTime);
+	void OnRequestComplete(const TSharedRef<FHttpRetryTask>& Task, double CurrentTime);
+	void OnTimerExpired(const FHttpRetryTimer& Timer, double CurrentTime);
+	void ScheduleRetry(const TSharedRef<FHttpRetryTask>& Task, double CurrentTime, double RetryAfter);
+	void FinishTask(const TSharedRef<FHttpRetryTask>& Task);
+	void DeliverCachedResponse(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, const FHttpResponsePtr& Response);
+	bool CoalesceRequest(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, const FHttpAuthorizationPtr& Authorization, uint32 AuthorizationGeneration, FString& OutCoalescingKey);
+	bool ProcessTask(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, const FHttpRetryPolicy& RetryPolicy, EHttpRequestPriority Priority, const FHttpAuthorizationPtr& Authorization, uint32 AuthorizationGeneration, const FString& RouteTemplate);
+	void TrackAuthorization(const TSharedRef<FHttpRetryTask>& Task, const FHttpAuthorizationPtr& Authorization, uint32 AuthorizationGeneration) const;
+	bool IsAuthorizationTracked(const FHttpAuthorization* Authorization) const;
+	bool ParkTask(const TSharedRef<FHttpRetryTask>& Task);
+	void ReleaseParkedTasks();
+	bool ReplayUnauthorized(const TSharedRef<FHttpRetryTask>& Task, double CurrentTime);
+
 private:
-	TArray<TSharedRef<FHttpRetryTask>> RetryList;
+	TMap<const IHttpRequest*, TSharedRef<FHttpRetryTask>> TaskMap;
+	TArray<FHttpRetryTimer> TimerHeap;
+	TMap<FString, TSharedRef<FHttpServiceQueue>> Services;
+	TArray<TPair<FString, int32>> ServiceLimits;
+	TArray<TPair<FString, FHttpRetryPolicy>> ServiceRetryPolicies;
+	FHttpRetryPolicy DefaultRetryPolicy;
+	int32 MaxInFlightPerHost = DefaultMaxInFlightRequests;
+	FHttpRequestQueueStats QueueStats[static_cast<int32>(EHttpRequestPriority::Max)];
+	TMap<FString, FHttpCircuitBreaker> CircuitBreakers;
+	FHttpCircuitBreakerConfig CircuitBreakerConfig;
+	TMap<FString, TWeakPtr<FHttpRetryTask>> InFlightGetRequests;
+	FHttpCoalescingStats CoalescingStats;
+	bool bCoalescingEnabled = true;
+	FHttpResponseCache ResponseCache;
+	FHttpMetrics Metrics;
+	FHttpTraceRecorder TraceRecorder;
+	FHttpRequestJournal Journal{ *this };
+	TArray<FHttpAuthorizationRef> Authorizations;
+	TArray<TSharedRef<FHttpRetryTask>> ParkedTasks;
+	int32 MaxParkedRequests = DefaultMaxParkedRequests;
 	FDelegateHandle PollRetryHandle;
+	double PollRetryDueTime = 0.0;
+	// guards the policies, service limits and service table, CopyPolicies may run on another thread than the setters and requests
+	mutable FRWLock PolicyLock;
 
 protected:
 	enum class EHttpRetrySchedulerState
@@ -0,0 +1,108 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Http.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Settings of the HTTP trace recorder. Disabled by default.
+ */
+struct ACCELBYTEUE4SDK_API FHttpTraceConfig
+{
+	bool bEnabled = false;
+	// Number of requests kept, the oldest are overwritten.
+	int32 Capacity = 2048;
+	// Share of the requests recorded, decided when the request is processed. 1 records every request.
+	float SampleRate = 1.0f;
+	// Record failed requests (no response, 4xx, 5xx) even when they were not sampled.
+	bool bAlwaysRecordErrors = true;
+	// Request and response content bytes kept per record, 0 keeps no content.
+	int32 MaxBodyBytes = 0;
+	bool bRecordHeaders = false;
+	// Headers recorded with their value replaced, compared case insensitively.
+	TArray<FString> RedactedHeaders = { TEXT("Authorization"), TEXT("Cookie"), TEXT("Set-Cookie"), TEXT("X-Api-Key") };
+	// Requests whose route contains one of these never keep their content, e.g. logins and token grants.
+	TArray<FString> RedactedBodyRoutes = { TEXT("/oauth"), TEXT("/token"), TEXT("/login"), TEXT("/password") };
+};
+
+/**
+ * @brief Ring buffer of compact records of the last requests of an HTTP retry scheduler, see FHttpRetryScheduler::GetTraceRecorder.
+ * URLs are reduced to route templates, so user IDs and query strings are never recorded. Game thread only.
+ *
+ * Dump file layout, written with FArchive in little endian:
+ * uint32 magic 'ABTR', int32 version, int32 route count, FString routes, int32 record count, then per record from oldest
+ * to newest: int64 UTC ticks, uint16 route index, uint16 status (0 without response), uint8 attempts, uint32 latency in
+ * microseconds, uint32 bytes sent, uint32 bytes received, TArray<uint8> UTF-8 headers, TArray<uint8> request content,
+ * TArray<uint8> response content.
+ */
+class ACCELBYTEUE4SDK_API FHttpTraceRecorder
+{
+public:
+	static const uint32 DumpMagic;
+	static const int32 DumpVersion;
+
+	void SetConfig(const FHttpTraceConfig& Config);
+	const FHttpTraceConfig& GetConfig() const;
+
+	/**
+	 * @brief Decide if a request being processed is recorded when it finishes.
+	 */
+	bool ShouldSample() const;
+
+	/**
+	 * @brief Record a finished request.
+	 *
+	 * @param RouteTemplate Endpoint of the request, see FHttpRequestBuilder::GetRouteTemplate. When empty it is guessed from
+	 * the verb and URL, see HttpRequest::GetRouteTemplate.
+	 * @param bSampled Result of ShouldSample when the request was processed, unsampled requests are only kept when they failed.
+	 * @param Attempts Number of times the request was sent.
+	 * @param Latency Seconds from ProcessRequest to completion.
+	 */
+	void Record(const FHttpRequestPtr& Request, const FString& RouteTemplate, const FHttpResponsePtr& Response, bool bSampled, int32 Attempts, double Latency);
+
+	int32 GetRecordCount() const;
+
+	void Clear();
+
+	/**
+	 * @brief Write the recorded requests to a file, e.g. when the player files a bug report.
+	 *
+	 * @return false when the file couldn't be written.
+	 */
+	bool DumpToFile(const FString& FilePath) const;
+
+private:
+	struct FRecord
+	{
+		int64 Ticks = 0;
+		uint16 RouteIndex = 0;
+		uint16 Status = 0;
+		uint8 Attempts = 0;
+		uint32 LatencyMicroseconds = 0;
+		uint32 BytesSent = 0;
+		uint32 BytesReceived = 0;
+		TArray<uint8> Headers;
+		TArray<uint8> RequestContent;
+		TArray<uint8> ResponseContent;
+	};
+
+	uint16 FindOrAddRoute(const FString& Route);
+	bool IsRedactedHeader(const FString& Name) const;
+	void CopyHeaders(const TArray<FString>& Headers, const TCHAR* Prefix, TArray<uint8>& OutHeaders) const;
+	void CopyContent(const TArray<uint8>& Content, TArray<uint8>& OutContent) const;
+
+	FHttpTraceConfig Config;
+	TArray<FRecord> Records;
+	// next slot to write once the buffer is full
+	int32 NextRecord = 0;
+	TArray<FString> Routes;
+	TMap<FString, uint16> RouteIndices;
+};
+
+}
@@ -0,0 +1,132 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Class.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Parse counters of one endpoint.
+ */
+struct ACCELBYTEUE4SDK_API FJsonParseStats
+{
+	int64 Count = 0;
+	// Parses run on a worker thread instead of the game thread.
+	int64 AsyncCount = 0;
+	int64 TotalBytes = 0;
+	double TotalTime = 0.0;
+	double MaxTime = 0.0;
+
+	double GetAverageTime() const
+	{
+		return Count > 0 ? TotalTime / Count : 0.0;
+	}
+};
+
+/**
+ * @brief Opt-in decoding of large response bodies on task graph worker threads, and per endpoint parse time counters.
+ * The typed result is handed back to the game thread before the success handler is called.
+ */
+class ACCELBYTEUE4SDK_API FAsyncJsonDecoding
+{
+public:
+	static const int32 DefaultSizeThreshold;
+
+	static void SetEnabled(bool bEnabled);
+
+	/**
+	 * @brief Bodies of at least this many bytes are parsed on a worker thread when enabled.
+	 */
+	static void SetSizeThreshold(int32 Bytes);
+
+	static bool ShouldDecodeAsync(int32 ContentLength);
+
+	/**
+	 * @brief Time the parses of the success handlers per endpoint, off by default so handlers don't pay for the counters.
+	 */
+	static void SetParseStatsEnabled(bool bEnabled);
+
+	static bool IsParseStatsEnabled();
+
+	/**
+	 * @brief Route template of the request whose completion delegates the scheduler is calling, guessed from the URL
+	 * of a response that didn't come through the scheduler.
+	 */
+	static FString GetCompletingRouteTemplate(const FString& Url);
+
+	/**
+	 * @brief Add a parse to the counters of an endpoint. Thread safe.
+	 */
+	static void RecordParse(const FString& RouteTemplate, int32 Bytes, double Seconds, bool bAsync);
+
+	/**
+	 * @brief Get a copy of the parse counters keyed by route template, e.g. GET /social/v1/public/namespaces/{namespace}/users/{userId}/statitems.
+	 */
+	static TMap<FString, FJsonParseStats> GetParseStats();
+
+	static void ResetParseStats();
+
+	/**
+	 * @brief Write the parse counters of every endpoint to the log, slowest first.
+	 */
+	static void DumpParseStats();
+
+private:
+	friend class FHttpRetryScheduler;
+
+	// route template of the request whose completion delegates the scheduler is calling
+	static const FString* CompletingRouteTemplate;
+};
+
+/**
+ * @brief Decodes a UTF-8 JSON body straight into a USTRUCT, driven by its property metadata.
+ * No FString copy of the body and no FJsonObject tree is built, values are written into the properties as they are read.
+ * Values the decoder doesn't handle natively (object wrappers, sets, type mismatches) are handed to FJsonObjectConverter
+ * one at a time, so the result is the same as FJsonObjectConverter::JsonObjectStringToUStruct.
+ */
+class ACCELBYTEUE4SDK_API FJsonStructDecoder
+{
+public:
+	/**
+	 * @brief Decode a JSON object into a struct.
+	 *
+	 * @param Utf8Data JSON text, doesn't need to be null terminated.
+	 * @param Length Number of bytes of Utf8Data.
+	 * @param StructDefinition Reflection data of the struct, e.g. FAccelByteModelsItemInfo::StaticStruct().
+	 * @param OutStruct Struct to fill, properties missing in the JSON are left untouched.
+	 *
+	 * @return false when the JSON is malformed or names a value its enum doesn't have, OutStruct may be partially filled.
+	 */
+	static bool DecodeStruct(const uint8* Utf8Data, int32 Length, const UStruct* StructDefinition, void* OutStruct);
+
+	/**
+	 * @brief Decode a JSON array of objects.
+	 *
+	 * @param AddElement Called for every element, returns the default constructed struct to fill.
+	 */
+	static bool DecodeStructArray(const uint8* Utf8Data, int32 Length, const UStruct* StructDefinition, TFunctionRef<void*()> AddElement);
+
+	template<typename T>
+	static bool Decode(const TArray<uint8>& Utf8Json, T& OutStruct)
+	{
+		return DecodeStruct(Utf8Json.GetData(), Utf8Json.Num(), T::StaticStruct(), &OutStruct);
+	}
+
+	template<typename T>
+	static bool Decode(const TArray<uint8>& Utf8Json, TArray<T>& OutArray)
+	{
+		OutArray.Reset();
+
+		return DecodeStructArray(Utf8Json.GetData(), Utf8Json.Num(), T::StaticStruct(), [&OutArray]() -> void*
+		{
+			return &OutArray[OutArray.AddDefaulted()];
+		});
+	}
+};
+
+}
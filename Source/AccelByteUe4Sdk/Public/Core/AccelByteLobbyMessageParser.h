@@ -0,0 +1,81 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Class.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Single pass reader of a lobby websocket frame, one "key: value" field per line.
+ * The frame is split into field spans once, fields are decoded straight into a USTRUCT driven by its property metadata,
+ * without building JSON text or an FJsonObject tree. Values are read the way Lobby::LobbyMessageToJson + FJsonObjectConverter
+ * read them: scalars are strings, "[a, "b"]" are arrays, "{...}" values are JSON.
+ * The parser keeps a reference to the frame, it must outlive the parser.
+ */
+class ACCELBYTEUE4SDK_API FLobbyMessageParser
+{
+public:
+	explicit FLobbyMessageParser(const FString& Message);
+
+	/**
+	 * @brief Value of the type field, e.g. partyInfoResponse.
+	 */
+	const FString& GetType() const;
+
+	/**
+	 * @brief The raw frame.
+	 */
+	const FString& GetMessage() const;
+
+	bool HasField(const TCHAR* Key) const;
+
+	/**
+	 * @brief Get a field value with JSON escapes resolved, empty when missing.
+	 */
+	FString GetStringField(const TCHAR* Key) const;
+
+	int32 GetIntegerField(const TCHAR* Key) const;
+
+	/**
+	 * @brief Decode the fields of the frame into a struct, fields without a property are skipped.
+	 *
+	 * @param StructDefinition Reflection data of the struct, e.g. FAccelByteModelsPartyJoinNotice::StaticStruct().
+	 * @param OutStruct Struct to fill, properties missing in the frame are left untouched.
+	 *
+	 * @return false when a value is malformed, OutStruct may be partially filled.
+	 */
+	bool DecodeStruct(const UStruct* StructDefinition, void* OutStruct) const;
+
+	template<typename T>
+	bool Decode(T& OutStruct) const
+	{
+		return DecodeStruct(T::StaticStruct(), &OutStruct);
+	}
+
+private:
+	struct FSpan
+	{
+		int32 Start = 0;
+		int32 Len = 0;
+	};
+
+	struct FField
+	{
+		FSpan Key;
+		FSpan Value;
+	};
+
+	const FField* FindField(const TCHAR* Key) const;
+
+	const FString& Message;
+	// frames rarely have more than a dozen fields
+	TArray<FField, TInlineAllocator<16>> Fields;
+	FString Type;
+};
+
+}
@@ -25,6 +25,9 @@
 #include "Api/AccelByteAchievementApi.h"
 #include "Api/AccelByteSessionBrowserApi.h"
 #include "Api/AccelByteUGCApi.h"
+#include "Api/AccelByteUserApi.h"
+#include "Api/AccelByteUserProfileApi.h"
+#include "Api/AccelByteOrderApi.h"
 
 #include "GameServerApi/AccelByteServerOauth2Api.h"
 #include "GameServerApi/AccelByteServerDSMApi.h"
@@ -42,40 +45,163 @@ using namespace AccelByte;
 namespace AccelByte
 {
 
+class FApiClient;
+
+/**
+ * @brief API object of an FApiClient, constructed on first access so a client only pays for the services it calls.
+ */
+template<typename T>
+class TLazyApi
+{
+public:
+	explicit TLazyApi(FApiClient& InClient)
+		: Client(InClient)
+	{
+	}
+
+	T& Get();
+
+	T* operator->()
+	{
+		return &Get();
+	}
+
+	bool IsConstructed() const
+	{
+		return Instance.IsValid();
+	}
+
+private:
+	FApiClient& Client;
+	TUniquePtr<T> Instance;
+
+	TLazyApi(const TLazyApi&) = delete;
+	TLazyApi& operator=(const TLazyApi&) = delete;
+};
+
+/**
+ * @brief Set of API objects sharing one user's credentials, e.g. ApiClient->Lobby->Connect().
+ * API objects are constructed on first access and send their requests through the client's own scheduler,
+ * so thousands of clients can live in one process without sharing request state.
+ */
 class ACCELBYTEUE4SDK_API FApiClient
 {
+private:
+	// declared first, the scheduler reference below is bound to it
+	TUniquePtr<FHttpRetryScheduler> OwnedHttpRetryScheduler;
+
 public:
+	/**
+	 * @brief Client with its own HTTP retry scheduler, using the limits and retry policies of FRegistry::HttpRetryScheduler. Game thread only.
+	 */
+	FApiClient();
+
+	/**
+	 * @brief Client sending through a scheduler shared with other clients, e.g. one shard of a bot swarm. Game thread only.
+	 *
+	 * @param SharedHttpRetryScheduler Started scheduler that outlives the client.
+	 * @param InSettings Settings of the environment the client talks to.
+	 */
+	FApiClient(FHttpRetryScheduler& SharedHttpRetryScheduler, AccelByte::Settings& InSettings);
+
+	~FApiClient();
+
+	/**
+	 * @brief Disconnect lobby, flush telemetry and stop the token refresh of the client. Game thread only.
+	 */
+	void Shutdown();
+
+	/**
+	 * @brief Whether nothing of the client is in flight: no queued request, no token refresh and no lobby connection. Game thread only.
+	 * A client sending through a shared scheduler is only idle when nothing is queued on that scheduler.
+	 */
+	bool IsIdle();
+
 	Credentials Credentials;
-	Api::User User{ Credentials, FRegistry::Settings };
-	Api::UserProfile UserProfile{ Credentials, FRegistry::Settings };
-	Api::Category Category{ Credentials, FRegistry::Settings };
-	Api::Entitlement Entitlement{ Credentials, FRegistry::Settings };
-	Api::Order Order{ Credentials, FRegistry::Settings };
-	Api::Item Item{ Credentials, FRegistry::Settings };
-	Api::Wallet Wallet{ Credentials, FRegistry::Settings };
-	Api::Fulfillment Fulfillment{ Credentials, FRegistry::Settings };
-	Api::CloudStorage CloudStorage{ Credentials, FRegistry::Settings };
-	Api::Lobby Lobby{ Credentials, FRegistry::Settings };
-	Api::GameProfile GameProfile{ Credentials, FRegistry::Settings };
-	Api::Statistic Statistic{ Credentials, FRegistry::Settings };
-	Api::QosManager QosManager{ Credentials, FRegistry::Settings };
-	Api::Qos Qos;
-	Api::Leaderboard Leaderboard{ Credentials, FRegistry::Settings };
-	Api::CloudSave CloudSave{ Credentials, FRegistry::Settings };
-	Api::GameTelemetry GameTelemetry{ Credentials, FRegistry::Settings };
-	Api::Agreement Agreement{ Credentials, FRegistry::Settings };
-	Api::Achievement Achievement{ Credentials, FRegistry::Settings };
-	Api::SessionBrowser SessionBrowser{ Credentials, FRegistry::Settings };
-	Api::UGC UGC{ Credentials, FRegistry::Settings };
+	AccelByte::Settings& Settings;
+	FHttpRetryScheduler& HttpRetryScheduler;
+
+	TLazyApi<Api::User> User{ *this };
+	TLazyApi<Api::UserProfile> UserProfile{ *this };
+	TLazyApi<Api::Category> Category{ *this };
+	TLazyApi<Api::Entitlement> Entitlement{ *this };
+	TLazyApi<Api::Order> Order{ *this };
+	TLazyApi<Api::Item> Item{ *this };
+	TLazyApi<Api::Wallet> Wallet{ *this };
+	TLazyApi<Api::Fulfillment> Fulfillment{ *this };
+	TLazyApi<Api::CloudStorage> CloudStorage{ *this };
+	TLazyApi<Api::Lobby> Lobby{ *this };
+	TLazyApi<Api::GameProfile> GameProfile{ *this };
+	TLazyApi<Api::Statistic> Statistic{ *this };
+	TLazyApi<Api::QosManager> QosManager{ *this };
+	TLazyApi<Api::Qos> Qos{ *this };
+	TLazyApi<Api::Leaderboard> Leaderboard{ *this };
+	TLazyApi<Api::CloudSave> CloudSave{ *this };
+	TLazyApi<Api::GameTelemetry> GameTelemetry{ *this };
+	TLazyApi<Api::Agreement> Agreement{ *this };
+	TLazyApi<Api::Achievement> Achievement{ *this };
+	TLazyApi<Api::SessionBrowser> SessionBrowser{ *this };
+	TLazyApi<Api::UGC> UGC{ *this };
+
+private:
+	FApiClient(const FApiClient&) = delete;
+	FApiClient& operator=(const FApiClient&) = delete;
 };
 
+template<typename T>
+T& TLazyApi<T>::Get()
+{
+	if (!Instance.IsValid())
+	{
+		Instance = MakeUnique<T>(Client.Credentials, Client.Settings, Client.HttpRetryScheduler);
+	}
+
+	return *Instance;
+}
+
+typedef TSharedPtr<FApiClient, ESPMode::ThreadSafe> FApiClientPtr;
+
+/**
+ * @brief Registry of API clients by key, e.g. one per simulated player. Existing clients can be looked up and removed from any thread.
+ * Clients are spread over shards with their own read-write lock, so lookups of existing clients only take a read lock.
+ */
 class ACCELBYTEUE4SDK_API FMultiRegistry
 {
 public:
-	static TSharedPtr<FApiClient> GetApiClient(FString key);
+	/**
+	 * @brief Get the client of the key, created on first call with the client credentials of FRegistry::Settings.
+	 * The first call for a key must be on the game thread.
+	 */
+	static FApiClientPtr GetApiClient(FString key);
+
+	/**
+	 * @brief Remove the client of the key. It is shut down on the game thread and destroyed there once the caller drops its references.
+	 *
+	 * @return false when there is no client with the key.
+	 */
+	static bool RemoveApiClient(const FString& Key);
+
+	/**
+	 * @brief Remove clients nobody else references, that weren't requested for IdleSeconds and that are idle, see FApiClient::IsIdle. Game thread only.
+	 *
+	 * @return Number of removed clients.
+	 */
+	static int32 RemoveIdleApiClients(double IdleSeconds);
+
+	/**
+	 * @brief Remove idle clients periodically, see RemoveIdleApiClients. 0 or less stops it. Game thread only.
+	 */
+	static void SetIdleApiClientTimeout(double IdleSeconds);
+
+	static int32 GetApiClientCount();
+
+	/**
+	 * @brief Stop idle eviction and shut down every client, called when the module shuts down. Game thread only.
+	 */
+	static void Shutdown();
 
 private:
-	static TMap<FString, TSharedPtr<FApiClient>> ApiClientInstances;
+	static FDelegateHandle IdleEvictionHandle;
 
 	FMultiRegistry() = delete;
 	FMultiRegistry(const FMultiRegistry& other) = delete;
@@ -15,6 +15,7 @@ namespace AccelByte
 {
 
 class FHttpRetryScheduler;
+class FTimerService;
 
 namespace Api
 {
@@ -53,47 +54,112 @@ namespace GameServerApi
 	class ServerMatchmaking;
 	class ServerLobby;
 	class ServerCloudSave;
+	class ServerBatch;
 }
 
+/**
+ * @brief Service of FRegistry, constructed and started on first access, e.g. FRegistry::Lobby->Connect().
+ * Converts to a reference of the service, so code that passed or bound FRegistry::Lobby as Api::Lobby& keeps compiling;
+ * member calls written as FRegistry::Lobby.Connect() become FRegistry::Lobby->Connect() or FRegistry::Lobby.Get().Connect().
+ * Game thread only.
+ */
+template<typename T>
+class TLazyService
+{
+public:
+	typedef TUniquePtr<T> (*FFactory)();
+
+	explicit TLazyService(FFactory InFactory)
+		: Factory(InFactory)
+	{
+	}
+
+	T& Get()
+	{
+		if (!Instance.IsValid())
+		{
+			Instance = Factory();
+		}
+
+		return *Instance;
+	}
+
+	T* operator->()
+	{
+		return &Get();
+	}
+
+	T& operator*()
+	{
+		return Get();
+	}
+
+	operator T&()
+	{
+		return Get();
+	}
+
+	bool IsConstructed() const
+	{
+		return Instance.IsValid();
+	}
+
+private:
+	const FFactory Factory;
+	TUniquePtr<T> Instance;
+
+	TLazyService(const TLazyService&) = delete;
+	TLazyService& operator=(const TLazyService&) = delete;
+};
+
 class ACCELBYTEUE4SDK_API FRegistry
 {
 public:
+	static FTimerService TimerService;
 	static Settings Settings;
 	static Credentials Credentials;
 	static ServerSettings ServerSettings;
 	static ServerCredentials ServerCredentials;
 	static FHttpRetryScheduler HttpRetryScheduler;
-	static Api::User User;
-	static Api::UserProfile UserProfile;
-	static Api::Category Category;
-	static Api::Entitlement Entitlement;
-	static Api::Order Order;
-	static Api::Item Item;
-	static Api::Wallet Wallet;
-	static Api::Fulfillment Fulfillment;
-	static Api::CloudStorage CloudStorage;
-	static Api::Lobby Lobby;
-	static Api::GameProfile GameProfile;
-	static Api::Statistic Statistic;
-	static Api::QosManager QosManager;
-	static Api::Qos Qos;
-	static Api::Leaderboard Leaderboard;
-	static Api::CloudSave CloudSave;
-	static Api::GameTelemetry GameTelemetry;
-	static Api::Agreement Agreement;
-	static Api::Achievement Achievement;
-	static Api::SessionBrowser SessionBrowser;
-	static Api::UGC UGC;
-	static GameServerApi::ServerOauth2 ServerOauth2;
-	static GameServerApi::ServerDSM ServerDSM;
-	static GameServerApi::ServerStatistic ServerStatistic;
-	static GameServerApi::ServerEcommerce ServerEcommerce;
-	static GameServerApi::ServerQosManager ServerQosManager;
-	static GameServerApi::ServerGameTelemetry ServerGameTelemetry;
-	static GameServerApi::ServerAchievement ServerAchievement;
-	static GameServerApi::ServerMatchmaking ServerMatchmaking;
-	static GameServerApi::ServerLobby ServerLobby;
-	static GameServerApi::ServerCloudSave ServerCloudSave;
+	static TLazyService<Api::User> User;
+	static TLazyService<Api::UserProfile> UserProfile;
+	static TLazyService<Api::Category> Category;
+	static TLazyService<Api::Entitlement> Entitlement;
+	static TLazyService<Api::Order> Order;
+	static TLazyService<Api::Item> Item;
+	static TLazyService<Api::Wallet> Wallet;
+	static TLazyService<Api::Fulfillment> Fulfillment;
+	static TLazyService<Api::CloudStorage> CloudStorage;
+	static TLazyService<Api::Lobby> Lobby;
+	static TLazyService<Api::GameProfile> GameProfile;
+	static TLazyService<Api::Statistic> Statistic;
+	static TLazyService<Api::QosManager> QosManager;
+	static TLazyService<Api::Qos> Qos;
+	static TLazyService<Api::Leaderboard> Leaderboard;
+	static TLazyService<Api::CloudSave> CloudSave;
+	static TLazyService<Api::GameTelemetry> GameTelemetry;
+	static TLazyService<Api::Agreement> Agreement;
+	static TLazyService<Api::Achievement> Achievement;
+	static TLazyService<Api::SessionBrowser> SessionBrowser;
+	static TLazyService<Api::UGC> UGC;
+	static TLazyService<GameServerApi::ServerOauth2> ServerOauth2;
+	static TLazyService<GameServerApi::ServerDSM> ServerDSM;
+	static TLazyService<GameServerApi::ServerStatistic> ServerStatistic;
+	static TLazyService<GameServerApi::ServerEcommerce> ServerEcommerce;
+	static TLazyService<GameServerApi::ServerQosManager> ServerQosManager;
+	static TLazyService<GameServerApi::ServerGameTelemetry> ServerGameTelemetry;
+	static TLazyService<GameServerApi::ServerAchievement> ServerAchievement;
+	static TLazyService<GameServerApi::ServerMatchmaking> ServerMatchmaking;
+	static TLazyService<GameServerApi::ServerLobby> ServerLobby;
+	static TLazyService<GameServerApi::ServerCloudSave> ServerCloudSave;
+	static TLazyService<GameServerApi::ServerBatch> ServerBatch;
+
+	/**
+	 * @brief Construct and start services ahead of their first use, e.g. the warm-up list of the settings.
+	 *
+	 * @param ServiceNames Names of the services as they are named in FRegistry, e.g. "Lobby" or "ServerDSM".
+	 */
+	static void WarmUp(const TArray<FString>& ServiceNames);
 
 	//Static class doesn't have constructors or destructor
 	FRegistry() = delete;
@@ -1,4 +1,4 @@
-// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// Copyright (c) 2019 - 2021 AccelByte Inc. All Rights Reserved.
 // This is licensed software from AccelByte Inc, for limitations
 // and restrictions contact your company contract manager.
 
@@ -9,14 +9,48 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAccelByte, Log, All);
 
+/**
+ * @brief Log to LogAccelByte at Log verbosity. The arguments are not evaluated when the category is filtered out.
+ */
+#define ACCELBYTE_LOG(Format, ...) \
+	do \
+	{ \
+		if (UE_LOG_ACTIVE(LogAccelByte, Log) && UObjectInitialized()) \
+		{ \
+			UE_LOG(LogAccelByte, Log, Format, ##__VA_ARGS__); \
+		} \
+	} while (0)
+
+/**
+ * @brief Log the name of the enclosing function, converted once per call site instead of on every call.
+ */
+#define ACCELBYTE_LOG_FUNCTION() \
+	do \
+	{ \
+		if (UE_LOG_ACTIVE(LogAccelByte, Log) && UObjectInitialized()) \
+		{ \
+			static const FString AccelByteFunctionName(ANSI_TO_TCHAR(__FUNCTION__)); \
+			UE_LOG(LogAccelByte, Log, TEXT("%s"), *AccelByteFunctionName); \
+		} \
+	} while (0)
+
 namespace AccelByte 
 {
 
 class ACCELBYTEUE4SDK_API FReport
 {
 public:
+	/**
+	 * @brief Maximum number of content bytes written to the log by the Verbose HTTP dumps, the rest is only counted.
+	 */
+	static const int32 MaxLoggedContentBytes;
+
 	static void LogHttpRequest(const FHttpRequestPtr& Request);
-	static void LogHttpResponse(FHttpRequestPtr Request, FHttpResponsePtr Response);
-	static void Log(FString Message);
+	static void LogHttpResponse(const FHttpRequestPtr& Request, const FHttpResponsePtr& Response);
+
+	/**
+	 * @brief Log a message built by the caller. Prefer ACCELBYTE_LOG, which doesn't build the message when logging is filtered out.
+	 */
+	static void Log(const FString& Message);
 };
-}
\ No newline at end of file
+}
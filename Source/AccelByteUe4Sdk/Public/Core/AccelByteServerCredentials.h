@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Models/AccelByteOauth2Models.h"
+#include "Core/AccelByteHttpAuthorization.h"
 #include "Runtime/Core/Public/Containers/Ticker.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Engine.h"
@@ -30,6 +31,7 @@ public:
 
 public:
 	ServerCredentials();
+	~ServerCredentials();
 
 	void ForgetAll();
 	void SetClientCredentials(const FString& ClientId, const FString& ClientSecret);
@@ -45,6 +47,16 @@ public:
 	 * @brief Get access token expiration in UTC.
 	 */
 	const FString& GetClientAccessToken() const;
+
+	/**
+	 * @brief Get the prebuilt "Bearer <client access token>" header value, rebuilt only when the token changes.
+	 */
+	FString GetClientAuthorizationHeader() const;
+
+	/**
+	 * @brief Get the shared authorization header state, used by the HTTP retry scheduler to re-sign requests after a token refresh.
+	 */
+	const FHttpAuthorizationRef& GetClientAuthorization() const;
 	const FString& GetClientNamespace() const;
 	const double GetExpireTime() const;
 	const double GetRefreshTime() const;
@@ -55,6 +67,7 @@ private:
 	FString ClientId;
 	FString ClientSecret;
 	FString ClientAccessToken;
+	FHttpAuthorizationRef ClientAuthorization;
 	FString ClientNamespace;
 
 	double ClientExpireTime;
@@ -67,6 +80,7 @@ private:
 
 	FDelegateHandle PollRefreshTokenHandle;
 	void RemoveFromTicker(FDelegateHandle& handle);
+	bool RefreshTokenNow();
 };
 
 } // Namespace AccelByte
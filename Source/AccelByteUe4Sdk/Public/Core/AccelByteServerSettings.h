@@ -91,6 +91,10 @@ public:
 
 	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte Server | Settings")
 	FString CloudSaveServerUrl;
+
+	/** Services built when the module starts, as named in FRegistry, e.g. ServerDSM or ServerMatchmaking. The others are built on first use. */
+	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte Server | Settings")
+	TArray<FString> WarmUpServices;
 };
 
 
@@ -115,6 +115,42 @@ public:
 	
 	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte Client | Settings")
 	FString AppId;
+
+	/** Maximum concurrent HTTP requests per host, requests above it are queued by priority. 0 means unlimited, the default so requests are sent as before unless a limit is configured. */
+	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte Client | Http")
+	int32 HttpMaxInFlightRequests = 0;
+
+	/** Join identical GET requests (same URL and access token) to the one already in flight instead of sending them again. */
+	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte Client | Http")
+	bool bHttpCoalesceGetRequests = true;
+
+	/** Seconds store catalog, UGC tag and type responses are served from the HTTP cache before revalidating. 0 disables caching them. */
+	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte Client | Http")
+	float HttpCatalogCacheTtl = 300.0f;
+
+	/** Maximum kilobytes of cached responses kept in memory. */
+	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte Client | Http")
+	int32 HttpCacheMemoryBudgetKB = 4096;
+
+	/** Persist cached responses under Saved/AccelByte/HttpCache so they survive a restart. */
+	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte Client | Http")
+	bool bHttpDiskCacheEnabled = false;
+
+	/** Parse large response bodies on worker threads, the success handlers are still called on the game thread. */
+	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte Client | Http")
+	bool bHttpAsyncJsonDecoding = false;
+
+	/** Response bodies of at least this many bytes are parsed on a worker thread when async decoding is enabled. */
+	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte Client | Http")
+	int32 HttpAsyncJsonDecodingThreshold = 65536;
+
+	/** Time response body parses per endpoint, see FAsyncJsonDecoding::GetParseStats. */
+	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte Client | Http")
+	bool bHttpJsonParseStats = false;
+
+	/** Services built when the module starts, as named in FRegistry, e.g. Lobby or GameTelemetry. The others are built on first use. */
+	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte Client | Settings")
+	TArray<FString> WarmUpServices;
 };
 
 
@@ -0,0 +1,103 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Shared timer service of the SDK. Every deadline lives in one min-heap driven by a single core ticker entry
+ * that is only scheduled for the earliest deadline, so idle timers cost nothing between their due times.
+ * Times are FPlatformTime::Seconds() based. Game thread only.
+ */
+class ACCELBYTEUE4SDK_API FTimerService
+{
+public:
+	/**
+	 * @brief Call the delegate every Period seconds until it returns false or the timer is removed, like FTicker::AddTicker.
+	 *
+	 * @param Delegate Called with the seconds elapsed since the previous call.
+	 * @param Period Seconds between calls, 0 means every frame.
+	 */
+	FDelegateHandle AddTicker(const FTickerDelegate& Delegate, float Period);
+
+	/**
+	 * @brief Call the delegate once at the given time.
+	 *
+	 * @param DueTime Time to call the delegate at, a time in the past calls it on the next frame.
+	 */
+	FDelegateHandle AddTimer(double DueTime, const FSimpleDelegate& Delegate);
+
+	/**
+	 * @brief Move the next call of a timer or ticker.
+	 *
+	 * @return false when the timer doesn't exist anymore.
+	 */
+	bool RescheduleTimer(const FDelegateHandle& Handle, double DueTime);
+
+	/**
+	 * @brief Remove a timer or ticker and reset the handle. Safe to call from inside the timer's own delegate.
+	 */
+	void RemoveTimer(FDelegateHandle& Handle);
+
+	bool IsTimerActive(const FDelegateHandle& Handle) const;
+
+	int32 GetTimerCount() const;
+
+	/**
+	 * @brief Call every delegate due at CurrentTime. Driven by the core ticker, public so headless hosts can pump it.
+	 */
+	void Tick(double CurrentTime);
+
+	/**
+	 * @brief Remove every timer and the core ticker entry.
+	 */
+	void Shutdown();
+
+private:
+	struct FTimer
+	{
+		double DueTime = 0.0;
+		double LastTime = 0.0;
+		float Period = 0.0f;
+		bool bRepeat = false;
+		FTickerDelegate TickerDelegate;
+		FSimpleDelegate TimerDelegate;
+	};
+
+	/**
+	 * @brief Heap entry, stale when the timer was removed or rescheduled since it was pushed.
+	 */
+	struct FDeadline
+	{
+		double Time;
+		FDelegateHandle Handle;
+
+		FDeadline(double Time, const FDelegateHandle& Handle)
+			: Time(Time)
+			, Handle(Handle)
+		{
+		}
+
+		bool operator<(const FDeadline& Other) const
+		{
+			return Time < Other.Time;
+		}
+	};
+
+	FDelegateHandle AddEntry(FTimer&& Timer);
+	void UpdateCoreTicker(double CurrentTime);
+	bool OnCoreTick(float DeltaTime);
+
+	TMap<FDelegateHandle, FTimer> Timers;
+	TArray<FDeadline> Deadlines;
+	FDelegateHandle CoreTickerHandle;
+	double CoreTickerDueTime = 0.0;
+};
+
+}
@@ -0,0 +1,134 @@
+// Copyright (c) 2021 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Timespan.h"
+#include "Containers/Queue.h"
+#include "Core/AccelByteError.h"
+#include "GameServerApi/AccelByteServerStatisticApi.h"
+#include "GameServerApi/AccelByteServerAchievementApi.h"
+#include "GameServerApi/AccelByteServerEcommerceApi.h"
+#include "GameServerApi/AccelByteServerCloudSaveApi.h"
+
+namespace AccelByte
+{
+class ServerCredentials;
+class ServerSettings;
+namespace GameServerApi
+{
+
+/**
+ * @brief Batches the per-user calls a server makes for many players at once, e.g. at the end of a match.
+ * Stat increments are collected for a short window and merged into bulk requests, the calls without a bulk endpoint
+ * are sent with a bounded number of requests in flight. Every caller still gets its own handlers called.
+ * Game thread only, and it must outlive the operations it was given.
+ */
+class ACCELBYTEUE4SDK_API ServerBatch
+{
+public:
+	ServerBatch(const ServerCredentials& Credentials, const ServerSettings& Settings);
+	~ServerBatch();
+
+	/**
+	 * @brief Set how long stat increments are collected before they are sent. By default 200 milliseconds.
+	 *
+	 * @param Window The collection window, zero sends them on the next frame.
+	 */
+	void SetFlushWindow(FTimespan Window);
+
+	/**
+	 * @brief Set the number of stat items sent in one bulk request, reaching it sends the collected increments right away.
+	 * By default 100.
+	 *
+	 * @param Size The maximum number of stat items of a bulk request.
+	 */
+	void SetMaxBatchSize(int32 Size);
+
+	/**
+	 * @brief Set the number of requests of this batcher in flight at the same time. By default 8.
+	 *
+	 * @param Count The maximum number of requests in flight.
+	 */
+	void SetMaxConcurrentRequests(int32 Count);
+
+	/**
+	 * @brief Increment stat items of a user, merged with the increments of other users into one bulk request.
+	 *
+	 * @param UserId The id of the user.
+	 * @param Data Array of increased value and stat code.
+	 * @param OnSuccess This will be called when the operation succeeded. The result is the results of this user's stat items only.
+	 * @param OnError This will be called when the operation failed.
+	 */
+	void IncrementUserStatItems(const FString& UserId, const TArray<FAccelByteModelsBulkStatItemInc>& Data, const THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>>& OnSuccess, const FErrorHandler& OnError);
+
+	/**
+	 * @brief Unlock an achievement of a user, see ServerAchievement::UnlockAchievement.
+	 */
+	void UnlockAchievement(const FString& UserId, const FString& AchievementCode, const FVoidHandler& OnSuccess, const FErrorHandler& OnError);
+
+	/**
+	 * @brief Grant entitlements to a user, see ServerEcommerce::GrantUserEntitlements.
+	 */
+	void GrantUserEntitlements(const FString& UserId, const TArray<FAccelByteModelsEntitlementGrant>& EntitlementGrant, const THandler<TArray<FAccelByteModelsStackableEntitlementInfo>>& OnSuccess, const FErrorHandler& OnError);
+
+	/**
+	 * @brief Save a record of a user, see ServerCloudSave::SaveUserRecord. The record is copied.
+	 */
+	void SaveUserRecord(const FString& Key, const FString& UserId, const FJsonObject& RecordRequest, bool bIsPublic, const FVoidHandler& OnSuccess, const FErrorHandler& OnError);
+
+	/**
+	 * @brief Send the collected stat increments now instead of at the end of the window.
+	 */
+	void Flush();
+
+	/**
+	 * @brief Get the number of operations that are collected or waiting for a free request slot.
+	 */
+	int32 GetPendingCount() const;
+
+private:
+	typedef TFunction<void(const FSimpleDelegate& OnComplete)> FRequestJob;
+
+	struct FStatIncrementJob
+	{
+		FString UserId;
+		TArray<FAccelByteModelsBulkStatItemInc> Data;
+		THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>> OnSuccess;
+		FErrorHandler OnError;
+	};
+
+	void ScheduleFlush();
+	void EnqueueStatIncrements(TArray<FStatIncrementJob>&& Jobs, int32 ItemCount);
+	static void SplitStatIncrementResults(const TArray<FStatIncrementJob>& Jobs, const TArray<FAccelByteModelsBulkStatItemOperationResult>& Results);
+	void EnqueueRequest(FRequestJob&& Job);
+	void StartRequests();
+	void OnRequestComplete();
+
+	ServerBatch() = delete;
+	ServerBatch(ServerBatch const&) = delete;
+	ServerBatch(ServerBatch&&) = delete;
+
+	ServerStatistic Statistic;
+	ServerAchievement Achievement;
+	ServerEcommerce Ecommerce;
+	ServerCloudSave CloudSave;
+
+	FTimespan FlushWindow = FTimespan::FromMilliseconds(200);
+	int32 MaxBatchSize = 100;
+	int32 MaxConcurrentRequests = 8;
+
+	TArray<FStatIncrementJob> PendingStatIncrements;
+	int32 PendingStatItemCount = 0;
+	FDelegateHandle FlushHandle;
+
+	TQueue<FRequestJob> RequestQueue;
+	int32 QueuedRequestCount = 0;
+	int32 InFlightCount = 0;
+	bool bStartingRequests = false;
+};
+
+} // Namespace GameServerApi
+} // Namespace AccelByte
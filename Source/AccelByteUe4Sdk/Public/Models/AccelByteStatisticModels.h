@@ -95,6 +95,9 @@ struct ACCELBYTEUE4SDK_API FAccelByteModelsBulkStatItemOperationResult
 		FString StatCode;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Statistic | Models | BulkStatItemIncResult")
 		bool Success;
+	// Only set by the endpoints operating on many users.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Statistic | Models | BulkStatItemIncResult")
+		FString UserId;
 
 };
 